@@ -23,26 +23,10 @@
 
 #include "resource_manager.hpp"
 
-AccessMap::AccessMap() {
-    size = ResourceManager_MapSize.x;
+AccessMap::AccessMap() : map(ResourceManager_MapSize.x, ResourceManager_MapSize.y) { map.Clear(); }
 
-    map = new (std::nothrow) uint8_t*[ResourceManager_MapSize.x];
+AccessMap::~AccessMap() = default;
 
-    for (int32_t i = 0; i < ResourceManager_MapSize.x; ++i) {
-        map[i] = new (std::nothrow) uint8_t[ResourceManager_MapSize.y];
-
-        memset(map[i], 0, ResourceManager_MapSize.y);
-    }
-}
-
-AccessMap::~AccessMap() {
-    for (int32_t i = 0; i < size; ++i) {
-        delete[] map[i];
-    }
-
-    delete[] map;
-}
-
-uint8_t** AccessMap::GetMap() const { return map; }
+uint8_t** AccessMap::GetMap() const { return map.GetMap(); }
 
 uint8_t* AccessMap::GetMapColumn(int32_t index) const { return map[index]; }
@@ -22,11 +22,10 @@
 #ifndef ACCESSMAP_HPP
 #define ACCESSMAP_HPP
 
-#include <cstdint>
+#include "grid2d.hpp"
 
 class AccessMap {
-    uint8_t **map;
-    int16_t size;
+    Grid2D<uint8_t> map;
 
 public:
     AccessMap();
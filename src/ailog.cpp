@@ -21,18 +21,65 @@
 
 #include "ailog.hpp"
 
+#include <SDL_atomic.h>
+#include <SDL_mutex.h>
+#include <SDL_thread.h>
+#include <SDL_timer.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
 #include "gnw.h"
 #include "resource_manager.hpp"
-#include "smartstring.hpp"
 
 #define AILOG_FILE_LIMIT UINT16_MAX
-
-std::ofstream AiLog::AiLog_File;
-SDL_mutex* AiLog::AiLog_Mutex;
-int32_t AiLog::AiLog_SectionCount;
-int32_t AiLog::AiLog_EntryCount;
-
-inline void AiLog::AiLog_InitMutex() {
+#define AILOG_RING_LINES 1024
+/* room for the 500 byte task status dumps of WriteStatusLog plus the message text and section indentation */
+#define AILOG_LINE_SIZE 640
+#define AILOG_TRUNCATION_MARK "..."
+#define AILOG_WRITER_PERIOD 10
+
+/* single producer single consumer queue of formatted lines, the producer is the owning thread and the consumer is
+ * the writer thread
+ */
+struct AiLogRing {
+    char lines[AILOG_RING_LINES][AILOG_LINE_SIZE];
+    SDL_atomic_t head;
+    SDL_atomic_t tail;
+    SDL_atomic_t is_owned;
+    AiLogRing* next;
+};
+
+/* releases the ring of a thread on thread exit so that a later thread can reuse it */
+class AiLogRingOwner {
+public:
+    AiLogRing* ring{nullptr};
+
+    ~AiLogRingOwner() {
+        if (ring) {
+            SDL_AtomicSet(&ring->is_owned, 0);
+        }
+    }
+};
+
+static std::ofstream AiLog_File;
+static SDL_mutex* AiLog_Mutex;
+static SDL_atomic_t AiLog_Enabled;
+static SDL_atomic_t AiLog_WriterActive;
+static SDL_atomic_t AiLog_ProducerCount;
+static SDL_Thread* AiLog_Writer;
+static AiLogRing* AiLog_Rings;
+static int32_t AiLog_EntryCount;
+static thread_local AiLogRingOwner AiLog_RingOwner;
+static thread_local int32_t AiLog_SectionCount;
+
+static void AiLog_InitMutex();
+static AiLogRing* AiLog_GetRing();
+static bool AiLog_Drain();
+static int AiLog_WriterFunction(void* data);
+
+void AiLog_InitMutex() {
     if (!AiLog_Mutex) {
         AiLog_Mutex = SDL_CreateMutex();
 
@@ -42,137 +89,241 @@ inline void AiLog::AiLog_InitMutex() {
     }
 }
 
-AiLog::AiLog(const char* format, ...) {
-    AiLog_InitMutex();
+AiLogRing* AiLog_GetRing() {
+    if (!AiLog_RingOwner.ring) {
+        SDL_LockMutex(AiLog_Mutex);
 
-    SDL_LockMutex(AiLog_Mutex);
+        for (AiLogRing* ring = AiLog_Rings; ring; ring = ring->next) {
+            if (SDL_AtomicCAS(&ring->is_owned, 0, 1)) {
+                AiLog_RingOwner.ring = ring;
+                break;
+            }
+        }
 
-    if (AiLog_File.is_open()) {
-        time_stamp = timer_get();
+        if (!AiLog_RingOwner.ring) {
+            AiLogRing* ring = new (std::nothrow) AiLogRing();
 
-        va_list args;
+            if (!ring) {
+                ResourceManager_ExitGame(EXIT_CODE_INSUFFICIENT_MEMORY);
+            }
 
-        va_start(args, format);
-        VSprintf(format, args);
-        va_end(args);
-    }
+            SDL_AtomicSet(&ring->is_owned, 1);
 
-    ++AiLog_SectionCount;
+            ring->next = AiLog_Rings;
+            AiLog_Rings = ring;
 
-    SDL_UnlockMutex(AiLog_Mutex);
+            AiLog_RingOwner.ring = ring;
+        }
+
+        SDL_UnlockMutex(AiLog_Mutex);
+    }
+
+    return AiLog_RingOwner.ring;
 }
 
-AiLog::~AiLog() {
-    AiLog_InitMutex();
+bool AiLog_Drain() {
+    bool result{false};
 
     SDL_LockMutex(AiLog_Mutex);
 
-    --AiLog_SectionCount;
+    AiLogRing* rings = AiLog_Rings;
+
+    SDL_UnlockMutex(AiLog_Mutex);
 
-    if (AiLog_File.is_open()) {
-        auto elapsed_time{timer_elapsed_time(time_stamp)};
+    for (AiLogRing* ring = rings; ring; ring = ring->next) {
+        const uint32_t head = SDL_AtomicGet(&ring->head);
+        uint32_t tail = SDL_AtomicGet(&ring->tail);
 
-        if (elapsed_time >= TIMER_FPS_TO_MS(50)) {
-            NoLockLog("log section complete, %li msecs elapsed", elapsed_time);
+        for (; tail != head; ++tail) {
+            if (AiLog_File.is_open()) {
+                AiLog_File << ring->lines[tail % AILOG_RING_LINES];
 
-        } else {
-            NoLockLog("log section complete");
+                ++AiLog_EntryCount;
+            }
+
+            result = true;
         }
 
+        SDL_AtomicSet(&ring->tail, tail);
+    }
+
+    if (result && AiLog_File.is_open()) {
+        AiLog_File.flush();
+
         if (AiLog_EntryCount > AILOG_FILE_LIMIT) {
             auto filepath{(ResourceManager_FilePathGamePref / "ai_log.txt").lexically_normal()};
 
-            AiLog::AiLog_File.close();
-            AiLog::AiLog_File.open(filepath.string().c_str());
-            AiLog::AiLog_EntryCount = 0;
+            AiLog_File.close();
+            AiLog_File.open(filepath.string().c_str());
+            AiLog_EntryCount = 0;
         }
     }
 
-    SDL_UnlockMutex(AiLog_Mutex);
+    return result;
 }
 
-void AiLog::VSprintf(const char* format, va_list args) {
-    AiLog_File << SmartString().Sprintf(200, "\n%3i: ", AiLog_SectionCount + 1).GetCStr();
-
-    if (AiLog_SectionCount > 0) {
-        AiLog_File << SmartString().Sprintf(200, "%*s", AiLog_SectionCount, "").GetCStr();
+int AiLog_WriterFunction(void* /* unused */) {
+    while (SDL_AtomicGet(&AiLog_WriterActive)) {
+        if (!AiLog_Drain()) {
+            SDL_Delay(AILOG_WRITER_PERIOD);
+        }
     }
 
-    AiLog_File << SmartString().VSprintf(200, format, args).GetCStr();
-    AiLog_File.flush();
+    AiLog_Drain();
 
-    ++AiLog_EntryCount;
+    return 0;
 }
 
-void AiLog::Log(const char* format, ...) {
-    AiLog_InitMutex();
-
-    SDL_LockMutex(AiLog_Mutex);
+AiLog::AiLog(const char* format, ...) : time_stamp(0), is_active(false) {
+    if (AiLog_IsEnabled()) {
+        time_stamp = timer_get();
 
-    if (AiLog_File.is_open()) {
         va_list args;
 
         va_start(args, format);
-        VSprintf(format, args);
+        Write(format, args);
         va_end(args);
-    }
 
-    SDL_UnlockMutex(AiLog_Mutex);
+        ++AiLog_SectionCount;
+        is_active = true;
+    }
 }
 
-void AiLog::NoLockLog(const char* format, ...) {
-    va_list args;
+AiLog::~AiLog() {
+    if (is_active) {
+        --AiLog_SectionCount;
+
+        if (AiLog_IsEnabled()) {
+            auto elapsed_time{timer_elapsed_time(time_stamp)};
 
-    va_start(args, format);
-    VSprintf(format, args);
-    va_end(args);
+            if (elapsed_time >= TIMER_FPS_TO_MS(50)) {
+                Log("log section complete, %li msecs elapsed", elapsed_time);
+
+            } else {
+                Log("log section complete");
+            }
+        }
+    }
 }
 
-void AiLog::VLog(const char* format, va_list args) {
-    AiLog_InitMutex();
+void AiLog::Write(const char* format, va_list args) {
+    // AiLog_Close() waits for registered producers before the final drain, so no line is left behind in a ring
+    SDL_AtomicIncRef(&AiLog_ProducerCount);
 
-    SDL_LockMutex(AiLog_Mutex);
+    if (!AiLog_IsEnabled()) {
+        SDL_AtomicDecRef(&AiLog_ProducerCount);
 
-    if (AiLog_File.is_open()) {
-        VSprintf(format, args);
+        return;
     }
 
-    SDL_UnlockMutex(AiLog_Mutex);
+    AiLogRing* ring = AiLog_GetRing();
+    const uint32_t head = SDL_AtomicGet(&ring->head);
+
+    // the writer thread frees up space, the line is dropped if the log gets closed meanwhile
+    while (head - static_cast<uint32_t>(SDL_AtomicGet(&ring->tail)) >= AILOG_RING_LINES) {
+        if (!AiLog_IsEnabled()) {
+            SDL_AtomicDecRef(&AiLog_ProducerCount);
+
+            return;
+        }
+
+        SDL_Delay(1);
+    }
+
+    char* line = ring->lines[head % AILOG_RING_LINES];
+    int32_t length = snprintf(line, AILOG_LINE_SIZE, "\n%3i: %*s", AiLog_SectionCount + 1, AiLog_SectionCount, "");
+
+    if (length > 0 && length < AILOG_LINE_SIZE) {
+        const int32_t text_length = vsnprintf(&line[length], AILOG_LINE_SIZE - length, format, args);
+
+        /* lines that do not fit are cut off visibly */
+        if (text_length >= AILOG_LINE_SIZE - length) {
+            memcpy(&line[AILOG_LINE_SIZE - sizeof(AILOG_TRUNCATION_MARK)], AILOG_TRUNCATION_MARK,
+                   sizeof(AILOG_TRUNCATION_MARK));
+        }
+    }
+
+    SDL_AtomicSet(&ring->head, head + 1);
+
+    SDL_AtomicDecRef(&AiLog_ProducerCount);
+}
+
+void AiLog::Log(const char* format, ...) {
+    if (AiLog_IsEnabled()) {
+        va_list args;
+
+        va_start(args, format);
+        Write(format, args);
+        va_end(args);
+    }
+}
+
+void AiLog::VLog(const char* format, va_list args) {
+    if (AiLog_IsEnabled()) {
+        Write(format, args);
+    }
 }
 
 void AiLog_Open() {
-    AiLog::AiLog_InitMutex();
+    AiLog_InitMutex();
 
-    SDL_LockMutex(AiLog::AiLog_Mutex);
+    SDL_LockMutex(AiLog_Mutex);
 
-    if (!AiLog::AiLog_File.is_open()) {
+    if (!AiLog_File.is_open()) {
         auto filepath{(ResourceManager_FilePathGamePref / "ai_log.txt").lexically_normal()};
 
-        AiLog::AiLog_File.open(filepath.string().c_str());
-        AiLog::AiLog_EntryCount = 0;
+        AiLog_File.open(filepath.string().c_str());
+        AiLog_EntryCount = 0;
+
+        if (AiLog_File.is_open()) {
+            SDL_AtomicSet(&AiLog_WriterActive, 1);
+
+            AiLog_Writer = SDL_CreateThread(&AiLog_WriterFunction, "AiLogWriter", nullptr);
+
+            if (AiLog_Writer) {
+                SDL_AtomicSet(&AiLog_Enabled, 1);
+
+            } else {
+                AiLog_File.close();
+            }
+        }
     }
 
-    SDL_UnlockMutex(AiLog::AiLog_Mutex);
+    SDL_UnlockMutex(AiLog_Mutex);
 }
 
 void AiLog_Close() {
-    AiLog::AiLog_InitMutex();
+    AiLog_InitMutex();
 
-    SDL_LockMutex(AiLog::AiLog_Mutex);
+    SDL_LockMutex(AiLog_Mutex);
 
-    AiLog::AiLog_File.close();
+    SDL_AtomicSet(&AiLog_Enabled, 0);
 
-    SDL_UnlockMutex(AiLog::AiLog_Mutex);
-}
+    // producers that passed the enabled check before it was cleared finish their line first, they may need the
+    // mutex to get a ring
+    SDL_UnlockMutex(AiLog_Mutex);
 
-[[nodiscard]] bool AiLog_IsEnabled() noexcept {
-    AiLog::AiLog_InitMutex();
+    while (SDL_AtomicGet(&AiLog_ProducerCount) > 0) {
+        SDL_Delay(1);
+    }
 
-    SDL_LockMutex(AiLog::AiLog_Mutex);
+    SDL_LockMutex(AiLog_Mutex);
 
-    auto result{AiLog::AiLog_File.is_open()};
+    if (AiLog_Writer) {
+        SDL_Thread* writer = AiLog_Writer;
 
-    SDL_UnlockMutex(AiLog::AiLog_Mutex);
+        AiLog_Writer = nullptr;
+        SDL_AtomicSet(&AiLog_WriterActive, 0);
 
-    return result;
+        // the writer needs the mutex to drain the rings
+        SDL_UnlockMutex(AiLog_Mutex);
+        SDL_WaitThread(writer, nullptr);
+        SDL_LockMutex(AiLog_Mutex);
+    }
+
+    AiLog_File.close();
+
+    SDL_UnlockMutex(AiLog_Mutex);
 }
+
+[[nodiscard]] bool AiLog_IsEnabled() noexcept { return SDL_AtomicGet(&AiLog_Enabled) != 0; }
@@ -22,29 +22,36 @@
 #ifndef AILOG_HPP
 #define AILOG_HPP
 
-#include <SDL_mutex.h>
-
+#include <cstdarg>
 #include <cstdint>
-#include <fstream>
 
-class AiLog {
-    static std::ofstream AiLog_File;
-    static SDL_mutex *AiLog_Mutex;
-    static int32_t AiLog_SectionCount;
-    static int32_t AiLog_EntryCount;
+#ifdef AILOG_DISABLED
+#define AILOG(name, ...) AiLog name
+#define AILOG_LOG(name, ...) ((void)0)
+#else
+/// Opens a log section. The log message arguments are not evaluated while the AI log is closed.
+#define AILOG(name, ...) AiLog name = AiLog_IsEnabled() ? AiLog(__VA_ARGS__) : AiLog()
+#define AILOG_LOG(name, ...)           \
+    do {                               \
+        if (AiLog_IsEnabled()) {       \
+            (name).Log(__VA_ARGS__);   \
+        }                              \
+    } while (0)
+#endif
 
+/// Scoped AI log section. Lines are formatted by the logging thread into a thread local ring buffer and written to
+/// ai_log.txt by a background writer thread, so a log statement never waits for file I/O unless the ring is full.
+class AiLog {
     uint32_t time_stamp;
+    bool is_active;
 
-    static void AiLog_InitMutex();
-    void VSprintf(const char *format, va_list args);
-    void NoLockLog(const char *format, ...);
-
-    friend void AiLog_Open();
-    friend void AiLog_Close();
-    friend bool AiLog_IsEnabled() noexcept;
+    static void Write(const char *format, va_list args);
 
 public:
+    AiLog() noexcept : time_stamp(0), is_active(false) {}
     AiLog(const char *format, ...);
+    AiLog(const AiLog &other) = delete;
+    AiLog &operator=(const AiLog &other) = delete;
     ~AiLog();
 
     void Log(const char *format, ...);
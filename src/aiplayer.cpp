@@ -24,6 +24,7 @@
 #include "access.hpp"
 #include "ai.hpp"
 #include "aiattack.hpp"
+#include "aiprofiler.hpp"
 #include "builder.hpp"
 #include "circumferencewalker.hpp"
 #include "continent.hpp"
@@ -48,14 +49,20 @@
 #include "taskscavenge.hpp"
 #include "tasksurvey.hpp"
 #include "taskupdateterrain.hpp"
+#include "threatkernels.hpp"
 #include "units_manager.hpp"
 #include "zonewalker.hpp"
 
 #define AIPLAYER_THREAT_MAP_CACHE_ENTRIES 10
+#define AIPLAYER_THREAT_EVENT_RANGE 4
 
 AiPlayer AiPlayer_Teams[PLAYER_TEAM_MAX - 1];
 TerrainMap AiPlayer_TerrainMap;
 ThreatMap AiPlayer_ThreatMaps[AIPLAYER_THREAT_MAP_CACHE_ENTRIES];
+uint32_t AiPlayer_ThreatMapBuildCount;
+
+static const ResourceID AiPlayer_RiskGroups[] = {INVALID_ID, TANK,     SURVEYOR, FIGHTER,
+                                                 COMMANDO,   COMMANDO, SUBMARNE, CLNTRANS};
 
 void AiPlayer::AddBuilding(UnitInfo* unit) { FindManager(Point(unit->grid_x, unit->grid_y))->AddUnit(*unit); }
 
@@ -512,52 +519,6 @@ int32_t AiPlayer::GetTotalProjectedDamage(UnitInfo* unit, int32_t caution_level,
     return result;
 }
 
-void AiPlayer::UpdateMap(int16_t** map, Point position, int32_t range, int32_t damage_potential, bool normalize) {
-    Point site;
-    Point limit;
-    int32_t distance = range * range;
-    int32_t map_offset;
-    int16_t* map_address{nullptr};
-
-    site.x = std::max(position.x - range, 0) - 1;
-    site.y = 0;
-
-    limit.x = std::min(position.x + range, ResourceManager_MapSize.x - 1);
-    limit.y = 0;
-
-    for (;;) {
-        ++site.y;
-
-        if (site.y > limit.y) {
-            ++site.x;
-
-            if (site.x > limit.x) {
-                return;
-            }
-
-            map_offset = (site.x - position.x) * (site.x - position.x);
-
-            site.y = range;
-
-            while (site.y >= 0 && (site.y * site.y + map_offset) > distance) {
-                --site.y;
-            }
-
-            limit.y = std::min(site.y + position.y, ResourceManager_MapSize.y - 1);
-            site.y = std::max(position.y - site.y, 0);
-
-            map_address = &map[site.x][site.y];
-        }
-
-        if (normalize && *map_address < 0) {
-            *map_address = 0;
-        }
-
-        *map_address += damage_potential;
-        ++map_address;
-    }
-}
-
 void AiPlayer::UpdateThreatMaps(ThreatMap* threat_map, UnitInfo* unit, Point position, int32_t range, int32_t attack,
                                 int32_t shots, int32_t& ammo, bool normalize) {
     if (shots > ammo) {
@@ -581,15 +542,214 @@ void AiPlayer::UpdateThreatMaps(ThreatMap* threat_map, UnitInfo* unit, Point pos
             } while (walker.FindNext());
 
         } else {
-            UpdateMap(threat_map->damage_potential_map, position, range, damage_potential, normalize);
-            UpdateMap(threat_map->shots_map, position, range, shots, false);
+            ThreatMap::UpdateMap(threat_map->damage_potential_map.GetMap(), position, range, damage_potential,
+                                 normalize);
+            ThreatMap::UpdateMap(threat_map->shots_map.GetMap(), position, range, shots, false);
         }
     }
 }
 
 void AiPlayer::InvalidateThreatMaps() {
     for (auto& map : AiPlayer_ThreatMaps) {
-        map.SetRiskLevel(0);
+        if (map.caution_level == CAUTION_LEVEL_AVOID_REACTION_FIRE && map.risk_level) {
+            /* incremental maps are brought up to date on next use */
+            map.is_dirty = true;
+
+        } else {
+            map.SetRiskLevel(0);
+        }
+    }
+}
+
+void AiPlayer::InvalidateThreatMaps(UnitInfo* unit) {
+    Rect bounds;
+
+    GetThreatEventBounds(unit, &bounds);
+
+    for (auto& map : AiPlayer_ThreatMaps) {
+        if (map.caution_level == CAUTION_LEVEL_AVOID_REACTION_FIRE && map.risk_level) {
+            /* only the contribution of the spotted unit is evaluated again on next use */
+            map.MarkUnit(unit);
+            map.AddDirtyBounds(&bounds);
+
+        } else {
+            map.SetRiskLevel(0);
+        }
+    }
+}
+
+void AiPlayer::WithdrawThreats(UnitInfo* unit) {
+    Rect bounds;
+
+    GetThreatEventBounds(unit, &bounds);
+
+    for (auto& map : AiPlayer_ThreatMaps) {
+        if (map.caution_level == CAUTION_LEVEL_AVOID_REACTION_FIRE && map.risk_level) {
+            map.RemoveContribution(unit);
+            map.AddDirtyBounds(&bounds);
+        }
+    }
+}
+
+void AiPlayer::GetThreatEventBounds(UnitInfo* unit, Rect* bounds) {
+    /* spotted mines and disabled units are applied to the finalized maps in the vicinity of their position */
+    bounds->ulx = unit->grid_x - AIPLAYER_THREAT_EVENT_RANGE;
+    bounds->uly = unit->grid_y - AIPLAYER_THREAT_EVENT_RANGE;
+    bounds->lrx = unit->grid_x + AIPLAYER_THREAT_EVENT_RANGE + 1;
+    bounds->lry = unit->grid_y + AIPLAYER_THREAT_EVENT_RANGE + 1;
+}
+
+bool AiPlayer::GetThreatContribution(UnitInfo* unit, Point position, bool* teams, ThreatContribution* contribution) {
+    bool result{false};
+
+    /* mirrors DetermineThreats() and UpdateThreatMaps() for the reaction fire caution level */
+    if (!(unit->speed > 0 && !teams[unit->team])) {
+        UnitValues* base_values = unit->GetBaseValues();
+        int32_t unit_shots = std::min<int32_t>(unit->shots, unit->ammo);
+        int32_t damage_potential = base_values->GetAttribute(ATTRIB_ATTACK) * unit_shots;
+
+        if (damage_potential > 0) {
+            /* padding is cleared as well since descriptors are compared with memcmp */
+            memset(static_cast<void*>(contribution), 0, sizeof(*contribution));
+
+            contribution->unit = unit;
+            contribution->position = position;
+            contribution->damage_potential = damage_potential;
+            contribution->range = base_values->GetAttribute(ATTRIB_RANGE);
+            contribution->shots = unit_shots;
+
+            if (unit->GetUnitType() == SUBMARNE || unit->GetUnitType() == CORVETTE) {
+                contribution->surface_types = SURFACE_TYPE_WATER | SURFACE_TYPE_COAST;
+            }
+
+            result = true;
+        }
+    }
+
+    return result;
+}
+
+void AiPlayer::CollectThreatContributions(ResourceID risk_group_unit, bool is_for_attacking, bool* teams,
+                                          ObjectArray<ThreatContribution>* contributions) {
+    ThreatContribution contribution;
+
+    if (is_for_attacking) {
+        if (ini_get_setting(INI_OPPONENT) >= OPPONENT_TYPE_MASTER &&
+            ini_get_setting(INI_CHEATING_COMPUTER) >= COMPUTER_CHEATING_LEVEL_SHAMELESS) {
+            SmartList<UnitInfo>* unit_lists[] = {&UnitsManager_StationaryUnits, &UnitsManager_MobileLandSeaUnits,
+                                                 &UnitsManager_MobileAirUnits};
+
+            for (SmartList<UnitInfo>* units : unit_lists) {
+                for (SmartList<UnitInfo>::Iterator it = units->Begin(); it != units->End(); ++it) {
+                    if (IsAbleToAttack(&*it, risk_group_unit, player_team) && (*it).team != player_team &&
+                        GetThreatContribution(&*it, Point((*it).grid_x, (*it).grid_y), teams, &contribution)) {
+                        contributions->Append(&contribution);
+                    }
+                }
+            }
+
+        } else {
+            for (SmartList<SpottedUnit>::Iterator it = spotted_units.Begin(); it != spotted_units.End(); ++it) {
+                UnitInfo* unit = (*it).GetUnit();
+
+                if (IsAbleToAttack(unit, risk_group_unit, player_team) &&
+                    GetThreatContribution(unit, Point(unit->grid_x, unit->grid_y), teams, &contribution)) {
+                    contributions->Append(&contribution);
+                }
+            }
+        }
+
+    } else {
+        for (SmartList<SpottedUnit>::Iterator it = spotted_units.Begin(); it != spotted_units.End(); ++it) {
+            if (IsAbleToAttack((*it).GetUnit(), risk_group_unit, player_team) &&
+                GetThreatContribution((*it).GetUnit(), (*it).GetLastPosition(), teams, &contribution)) {
+                contributions->Append(&contribution);
+            }
+        }
+    }
+}
+
+bool AiPlayer::GetThreatContribution(ThreatMap* threat_map, UnitInfo* unit, bool* teams,
+                                     ThreatContribution* contribution) {
+    bool result{false};
+
+    /* mirrors CollectThreatContributions() for a single unit */
+    if (IsAbleToAttack(unit, AiPlayer_RiskGroups[threat_map->risk_level], player_team) && unit->team != player_team) {
+        if (threat_map->for_attacking && ini_get_setting(INI_OPPONENT) >= OPPONENT_TYPE_MASTER &&
+            ini_get_setting(INI_CHEATING_COMPUTER) >= COMPUTER_CHEATING_LEVEL_SHAMELESS) {
+            result = GetThreatContribution(unit, Point(unit->grid_x, unit->grid_y), teams, contribution);
+
+        } else {
+            for (SmartList<SpottedUnit>::Iterator it = spotted_units.Begin(); it != spotted_units.End(); ++it) {
+                if ((*it).GetUnit() == unit) {
+                    Point position = threat_map->for_attacking ? Point(unit->grid_x, unit->grid_y)
+                                                               : (*it).GetLastPosition();
+
+                    result = GetThreatContribution(unit, position, teams, contribution);
+                    break;
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
+void AiPlayer::SyncThreatMap(ThreatMap* threat_map) {
+    AiProfiler profiler("threat map", "sync", AiPlayer_RiskGroups[threat_map->risk_level], player_team);
+    ThreatContribution contribution;
+    bool teams[PLAYER_TEAM_MAX];
+    Rect bounds;
+
+    AiAttack_GetTargetTeams(player_team, teams);
+
+    if (threat_map->is_dirty) {
+        ObjectArray<ThreatContribution> contributions;
+
+        CollectThreatContributions(AiPlayer_RiskGroups[threat_map->risk_level], threat_map->for_attacking, teams,
+                                   &contributions);
+
+        threat_map->InitIncremental();
+
+        for (int32_t i = 0; i < contributions.GetCount(); ++i) {
+            threat_map->UpdateContribution(contributions[i]->unit, contributions[i]);
+        }
+
+        bounds.ulx = 0;
+        bounds.uly = 0;
+        bounds.lrx = ResourceManager_MapSize.x;
+        bounds.lry = ResourceManager_MapSize.y;
+
+        threat_map->AddDirtyBounds(&bounds);
+
+    } else {
+        /* units are keyed by address, so each delta withdraws exactly the contribution recorded for the unit */
+        for (SmartList<UnitInfo>::Iterator it = threat_map->dirty_units.Begin(); it != threat_map->dirty_units.End();
+             ++it) {
+            if (GetThreatContribution(threat_map, &*it, teams, &contribution)) {
+                threat_map->UpdateContribution(&*it, &contribution);
+
+            } else {
+                threat_map->UpdateContribution(&*it, nullptr);
+            }
+        }
+
+        threat_map->dirty_units.Clear();
+    }
+
+    threat_map->is_dirty = false;
+
+    if (threat_map->CommitDirtyBounds(&bounds)) {
+        FinalizeThreatMap(threat_map, &bounds);
+
+        /* the window is finalized against zero armor while the rest of the map is rebased to the cached armor */
+        if (threat_map->armor) {
+            for (int32_t x = bounds.ulx; x < bounds.lrx; ++x) {
+                ThreatKernels_RebaseSpan(&threat_map->damage_potential_map[x][bounds.uly],
+                                         &threat_map->shots_map[x][bounds.uly], bounds.lry - bounds.uly,
+                                         -threat_map->armor);
+            }
+        }
     }
 }
 
@@ -605,7 +765,7 @@ void AiPlayer::DetermineDefenses(SmartList<UnitInfo>* units, int16_t** map) {
             if (unit_range > 0) {
                 int32_t attack_power = (-(*it).GetBaseValues()->GetAttribute(ATTRIB_ATTACK)) * (*it).shots;
 
-                UpdateMap(map, Point((*it).grid_x, (*it).grid_y), unit_range, attack_power, false);
+                ThreatMap::UpdateMap(map, Point((*it).grid_x, (*it).grid_y), unit_range, attack_power, false);
             }
         }
     }
@@ -613,7 +773,7 @@ void AiPlayer::DetermineDefenses(SmartList<UnitInfo>* units, int16_t** map) {
 
 void AiPlayer::DetermineThreats(UnitInfo* unit, Point position, int32_t caution_level, bool* teams,
                                 ThreatMap* air_force_map, ThreatMap* ground_forces_map) {
-    if ((unit->flags & MOBILE_AIR_UNIT) && air_force_map->shots_map) {
+    if ((unit->flags & MOBILE_AIR_UNIT) && air_force_map->shots_map.IsInited()) {
         ground_forces_map = air_force_map;
     }
 
@@ -700,23 +860,13 @@ void AiPlayer::DetermineThreats(UnitInfo* unit, Point position, int32_t caution_
     }
 }
 
-void AiPlayer::SumUpMaps(int16_t** map1, int16_t** map2) {
-    for (int32_t x = 0; x < ResourceManager_MapSize.x; ++x) {
-        for (int32_t y = 0; y < ResourceManager_MapSize.y; ++y) {
-            map1[x][y] += map2[x][y];
-        }
-    }
+void AiPlayer::SumUpMaps(Grid2D<int16_t>& map1, Grid2D<int16_t>& map2) {
+    ThreatKernels_SumSpan(map1.GetData(), map2.GetData(), map1.GetSize());
 }
 
 void AiPlayer::NormalizeThreatMap(ThreatMap* threat_map) {
-    for (int32_t x = 0; x < ResourceManager_MapSize.x; ++x) {
-        for (int32_t y = 0; y < ResourceManager_MapSize.y; ++y) {
-            if (threat_map->damage_potential_map[x][y] < 0) {
-                threat_map->damage_potential_map[x][y] = 0;
-                threat_map->shots_map[x][y] = 0;
-            }
-        }
-    }
+    ThreatKernels_NormalizeSpan(threat_map->damage_potential_map.GetData(), threat_map->shots_map.GetData(),
+                                threat_map->damage_potential_map.GetSize());
 }
 
 bool AiPlayer::IsAbleToAttack(UnitInfo* attacker, ResourceID target_type, uint16_t team) {
@@ -744,6 +894,121 @@ bool AiPlayer::IsAbleToAttack(UnitInfo* attacker, ResourceID target_type, uint16
     return result;
 }
 
+void AiPlayer::FinalizeThreatMap(ThreatMap* threat_map, const Rect* bounds) {
+    int32_t team_count = 0;
+    int16_t enemies[PLAYER_TEAM_MAX];
+    int8_t* heat_maps_stealth_sea[PLAYER_TEAM_MAX];
+
+    for (int32_t team = PLAYER_TEAM_RED; team < PLAYER_TEAM_MAX; ++team) {
+        if (team != player_team && UnitsManager_TeamInfo[team].team_type != TEAM_TYPE_NONE) {
+            enemies[team_count] = team;
+            ++team_count;
+        }
+    }
+
+    if (threat_map->risk_level == 7) {
+        for (int32_t team = 0; team < team_count; ++team) {
+            heat_maps_stealth_sea[team] = UnitsManager_TeamInfo[enemies[team]].heat_map_stealth_sea;
+        }
+
+        for (int32_t x = bounds->ulx; x < bounds->lrx; ++x) {
+            for (int32_t y = bounds->uly; y < bounds->lry; ++y) {
+                if (ResourceManager_MapSurfaceMap[y * ResourceManager_MapSize.x + x] == SURFACE_TYPE_WATER) {
+                    bool is_found = false;
+
+                    for (int32_t team = 0; team < team_count; ++team) {
+                        if (heat_maps_stealth_sea[team][y * ResourceManager_MapSize.x + x]) {
+                            is_found = true;
+                            break;
+                        }
+                    }
+
+                    if (!is_found) {
+                        threat_map->damage_potential_map[x][y] = 0x00;
+                    }
+                }
+            }
+        }
+    }
+
+    for (int32_t team = 0; team < team_count; ++team) {
+        int8_t* active_heat_map = UnitsManager_TeamInfo[enemies[team]].heat_map_complete;
+
+        if (threat_map->risk_level == 6) {
+            active_heat_map = UnitsManager_TeamInfo[enemies[team]].heat_map_stealth_sea;
+
+        } else if (threat_map->risk_level == 5 || threat_map->risk_level == 4) {
+            active_heat_map = UnitsManager_TeamInfo[enemies[team]].heat_map_stealth_land;
+        }
+
+        for (int32_t x = bounds->ulx; x < bounds->lrx; ++x) {
+            for (int32_t y = bounds->uly; y < bounds->lry; ++y) {
+                if (active_heat_map && active_heat_map[y * ResourceManager_MapSize.x + x]) {
+                    threat_map->damage_potential_map[x][y] |= 0x8000;
+                }
+            }
+        }
+    }
+
+    if (threat_map->risk_level == 4) {
+        int16_t** active_damage_potential_map = threat_map->damage_potential_map.GetMap();
+
+        for (SmartList<SpottedUnit>::Iterator it = spotted_units.Begin(); it != spotted_units.End(); ++it) {
+            if ((*it).GetUnit()->GetOrder() == ORDER_DISABLE) {
+                ZoneWalker walker((*it).GetLastPosition(), 4);
+
+                do {
+                    if (IsInsideBounds(bounds, *walker.GetCurrentLocation())) {
+                        active_damage_potential_map[walker.GetGridX()][walker.GetGridY()] |= 0x8000;
+                    }
+
+                } while (walker.FindNext());
+            }
+        }
+    }
+
+    for (int32_t x = bounds->ulx; x < bounds->lrx; ++x) {
+        for (int32_t y = bounds->uly; y < bounds->lry; ++y) {
+            if (threat_map->damage_potential_map[x][y] & 0x8000) {
+                threat_map->damage_potential_map[x][y] &= ~0x8000;
+
+            } else {
+                threat_map->damage_potential_map[x][y] = 0x00;
+            }
+        }
+    }
+
+    if (threat_map->risk_level != 3 && threat_map->risk_level != 2 && mine_map) {
+        for (int32_t x = bounds->ulx; x < bounds->lrx; ++x) {
+            for (int32_t y = bounds->uly; y < bounds->lry; ++y) {
+                threat_map->damage_potential_map[x][y] += mine_map[x][y];
+
+                if (mine_map[x][y] > 0) {
+                    ++threat_map->shots_map[x][y];
+                }
+            }
+        }
+    }
+
+    if (threat_map->risk_level != 3) {
+        for (SmartList<SpottedUnit>::Iterator it = spotted_units.Begin(); it != spotted_units.End(); ++it) {
+            UnitInfo* unit = (*it).GetUnit();
+
+            if ((unit->GetUnitType() == LANDMINE || unit->GetUnitType() == SEAMINE) &&
+                IsInsideBounds(bounds, Point(unit->grid_x, unit->grid_y))) {
+                threat_map->damage_potential_map[unit->grid_x][unit->grid_y] +=
+                    unit->GetBaseValues()->GetAttribute(ATTRIB_ATTACK);
+                ++threat_map->shots_map[unit->grid_x][unit->grid_y];
+            }
+        }
+    }
+}
+
+bool AiPlayer::IsInsideBounds(const Rect* bounds, Point position) {
+    return position.x >= bounds->ulx && position.x < bounds->lrx && position.y >= bounds->uly &&
+           position.y < bounds->lry;
+}
+
 ThreatMap* AiPlayer::GetThreatMap(int32_t risk_level, int32_t caution_level, bool is_for_attacking) {
     ThreatMap* result;
 
@@ -769,6 +1034,10 @@ ThreatMap* AiPlayer::GetThreatMap(int32_t risk_level, int32_t caution_level, boo
                     ++AiPlayer_ThreatMaps[j].id;
                 }
 
+                if (result->IsModified()) {
+                    SyncThreatMap(result);
+                }
+
                 return result;
             }
         }
@@ -781,7 +1050,14 @@ ThreatMap* AiPlayer::GetThreatMap(int32_t risk_level, int32_t caution_level, boo
             }
         }
 
-        AiPlayer_ThreatMaps[index].Init();
+        ++AiPlayer_ThreatMapBuildCount;
+
+        if (caution_level == CAUTION_LEVEL_AVOID_REACTION_FIRE) {
+            AiPlayer_ThreatMaps[index].InitIncremental();
+
+        } else {
+            AiPlayer_ThreatMaps[index].Init();
+        }
 
         AiPlayer_ThreatMaps[index].risk_level = risk_level;
         AiPlayer_ThreatMaps[index].armor = 0;
@@ -794,9 +1070,15 @@ ThreatMap* AiPlayer::GetThreatMap(int32_t risk_level, int32_t caution_level, boo
             ++AiPlayer_ThreatMaps[i].id;
         }
 
+        if (caution_level == CAUTION_LEVEL_AVOID_REACTION_FIRE) {
+            SyncThreatMap(&AiPlayer_ThreatMaps[index]);
+
+            return &AiPlayer_ThreatMaps[index];
+        }
+
+        ResourceID risk_group_unit = AiPlayer_RiskGroups[risk_level];
+        AiProfiler profiler("threat map", "build", risk_group_unit, player_team);
         ThreatMap air_force_threat_map;
-        const ResourceID risk_group[] = {INVALID_ID, TANK, SURVEYOR, FIGHTER, COMMANDO, COMMANDO, SUBMARNE, CLNTRANS};
-        ResourceID risk_group_unit = risk_group[risk_level];
         bool teams[PLAYER_TEAM_MAX];
 
         AiAttack_GetTargetTeams(player_team, teams);
@@ -806,8 +1088,8 @@ ThreatMap* AiPlayer::GetThreatMap(int32_t risk_level, int32_t caution_level, boo
         }
 
         if (caution_level > CAUTION_LEVEL_AVOID_REACTION_FIRE) {
-            DetermineDefenses(&air_force, air_force_threat_map.damage_potential_map);
-            DetermineDefenses(&ground_forces, AiPlayer_ThreatMaps[index].damage_potential_map);
+            DetermineDefenses(&air_force, air_force_threat_map.damage_potential_map.GetMap());
+            DetermineDefenses(&ground_forces, AiPlayer_ThreatMaps[index].damage_potential_map.GetMap());
         }
 
         if (is_for_attacking) {
@@ -862,110 +1144,9 @@ ThreatMap* AiPlayer::GetThreatMap(int32_t risk_level, int32_t caution_level, boo
             SumUpMaps(AiPlayer_ThreatMaps[index].shots_map, air_force_threat_map.shots_map);
         }
 
-        int32_t team_count = 0;
-        int16_t enemies[PLAYER_TEAM_MAX];
-        int8_t* heat_maps_stealth_sea[PLAYER_TEAM_MAX];
-
-        for (int32_t team = PLAYER_TEAM_RED; team < PLAYER_TEAM_MAX; ++team) {
-            if (team != player_team && UnitsManager_TeamInfo[team].team_type != TEAM_TYPE_NONE) {
-                enemies[team_count] = team;
-                ++team_count;
-            }
-        }
-
-        if (risk_level == 7) {
-            for (int32_t team = 0; team < team_count; ++team) {
-                heat_maps_stealth_sea[team] = UnitsManager_TeamInfo[enemies[team]].heat_map_stealth_sea;
-            }
+        Rect bounds = {0, 0, ResourceManager_MapSize.x, ResourceManager_MapSize.y};
 
-            for (int32_t x = 0; x < ResourceManager_MapSize.x; ++x) {
-                for (int32_t y = 0; y < ResourceManager_MapSize.y; ++y) {
-                    if (ResourceManager_MapSurfaceMap[y * ResourceManager_MapSize.x + x] == SURFACE_TYPE_WATER) {
-                        bool is_found = false;
-
-                        for (int32_t team = 0; team < team_count; ++team) {
-                            if (heat_maps_stealth_sea[team][y * ResourceManager_MapSize.x + x]) {
-                                is_found = true;
-                                break;
-                            }
-                        }
-
-                        if (!is_found) {
-                            AiPlayer_ThreatMaps[index].damage_potential_map[x][y] = 0x00;
-                        }
-                    }
-                }
-            }
-        }
-
-        for (int32_t team = 0; team < team_count; ++team) {
-            int8_t* active_heat_map = UnitsManager_TeamInfo[enemies[team]].heat_map_complete;
-
-            if (risk_level == 6) {
-                active_heat_map = UnitsManager_TeamInfo[enemies[team]].heat_map_stealth_sea;
-
-            } else if (risk_level == 5 || risk_level == 4) {
-                active_heat_map = UnitsManager_TeamInfo[enemies[team]].heat_map_stealth_land;
-            }
-
-            for (int32_t x = 0; x < ResourceManager_MapSize.x; ++x) {
-                for (int32_t y = 0; y < ResourceManager_MapSize.y; ++y) {
-                    if (active_heat_map && active_heat_map[y * ResourceManager_MapSize.x + x]) {
-                        AiPlayer_ThreatMaps[index].damage_potential_map[x][y] |= 0x8000;
-                    }
-                }
-            }
-        }
-
-        if (risk_level == 4) {
-            int16_t** active_damage_potential_map = AiPlayer_ThreatMaps[index].damage_potential_map;
-
-            for (SmartList<SpottedUnit>::Iterator it = spotted_units.Begin(); it != spotted_units.End(); ++it) {
-                if ((*it).GetUnit()->GetOrder() == ORDER_DISABLE) {
-                    ZoneWalker walker((*it).GetLastPosition(), 4);
-
-                    do {
-                        active_damage_potential_map[walker.GetGridX()][walker.GetGridY()] |= 0x8000;
-
-                    } while (walker.FindNext());
-                }
-            }
-        }
-
-        for (int32_t x = 0; x < ResourceManager_MapSize.x; ++x) {
-            for (int32_t y = 0; y < ResourceManager_MapSize.y; ++y) {
-                if (AiPlayer_ThreatMaps[index].damage_potential_map[x][y] & 0x8000) {
-                    AiPlayer_ThreatMaps[index].damage_potential_map[x][y] &= ~0x8000;
-
-                } else {
-                    AiPlayer_ThreatMaps[index].damage_potential_map[x][y] = 0x00;
-                }
-            }
-        }
-
-        if (risk_level != 3 && risk_level != 2 && mine_map) {
-            for (int32_t x = 0; x < ResourceManager_MapSize.x; ++x) {
-                for (int32_t y = 0; y < ResourceManager_MapSize.y; ++y) {
-                    AiPlayer_ThreatMaps[index].damage_potential_map[x][y] += mine_map[x][y];
-
-                    if (mine_map[x][y] > 0) {
-                        ++AiPlayer_ThreatMaps[index].shots_map[x][y];
-                    }
-                }
-            }
-        }
-
-        if (risk_level != 3) {
-            for (SmartList<SpottedUnit>::Iterator it = spotted_units.Begin(); it != spotted_units.End(); ++it) {
-                UnitInfo* unit = (*it).GetUnit();
-
-                if (unit->GetUnitType() == LANDMINE || unit->GetUnitType() == SEAMINE) {
-                    AiPlayer_ThreatMaps[index].damage_potential_map[unit->grid_x][unit->grid_y] +=
-                        unit->GetBaseValues()->GetAttribute(ATTRIB_ATTACK);
-                    ++AiPlayer_ThreatMaps[index].shots_map[unit->grid_x][unit->grid_y];
-                }
-            }
-        }
+        FinalizeThreatMap(&AiPlayer_ThreatMaps[index], &bounds);
 
         result = &AiPlayer_ThreatMaps[index];
 
@@ -3049,7 +3230,7 @@ void AiPlayer::Init(uint16_t team) {
     }
 
     for (int32_t i = 0; i < AIPLAYER_THREAT_MAP_CACHE_ENTRIES; ++i) {
-        AiPlayer_ThreatMaps[i].SetRiskLevel(0);
+        AiPlayer_ThreatMaps[i].Reset();
     }
 
     spotted_units.Clear();
@@ -3761,7 +3942,7 @@ int16_t** AiPlayer::GetDamagePotentialMap(UnitInfo* unit, int32_t caution_level,
     if (threat_map) {
         threat_map->Update(unit->GetBaseValues()->GetAttribute(ATTRIB_ARMOR));
 
-        result = threat_map->damage_potential_map;
+        result = threat_map->damage_potential_map.GetMap();
 
     } else {
         result = nullptr;
@@ -3778,7 +3959,7 @@ int16_t** AiPlayer::GetDamagePotentialMap(ResourceID unit_type, int32_t caution_
         threat_map->Update(UnitsManager_GetCurrentUnitValues(&UnitsManager_TeamInfo[player_team], unit_type)
                                ->GetAttribute(ATTRIB_ARMOR));
 
-        result = threat_map->damage_potential_map;
+        result = threat_map->damage_potential_map.GetMap();
 
     } else {
         result = nullptr;
@@ -4049,6 +4230,8 @@ void AiPlayer::RemoveUnit(UnitInfo* unit) {
                 spotted_units.Remove(*it);
             }
         }
+
+        WithdrawThreats(unit);
     }
 }
 
@@ -4057,7 +4240,7 @@ void AiPlayer::UnitSpotted(UnitInfo* unit) {
         (!(unit->flags & GROUND_COVER) || unit->GetUnitType() == LANDMINE || unit->GetUnitType() == SEAMINE)) {
         SmartList<SpottedUnit>::Iterator spotted_unit;
 
-        InvalidateThreatMaps();
+        InvalidateThreatMaps(unit);
 
         for (spotted_unit = spotted_units.Begin(); spotted_unit != spotted_units.End(); ++spotted_unit) {
             if ((*spotted_unit).GetUnit() == unit) {
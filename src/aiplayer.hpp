@@ -124,16 +124,25 @@ class AiPlayer {
     void RegisterIdleUnits();
     static int32_t GetTotalProjectedDamage(UnitInfo* unit, int32_t caution_level, uint16_t team,
                                            SmartList<UnitInfo>* units);
-    static void UpdateMap(int16_t** map, Point position, int32_t range, int32_t damage_potential, bool normalize);
     static void UpdateThreatMaps(ThreatMap* threat_map, UnitInfo* unit, Point position, int32_t range, int32_t attack,
                                  int32_t shots, int32_t& ammo, bool normalize);
     void InvalidateThreatMaps();
+    void InvalidateThreatMaps(UnitInfo* unit);
+    void WithdrawThreats(UnitInfo* unit);
+    static void GetThreatEventBounds(UnitInfo* unit, Rect* bounds);
     static void DetermineDefenses(SmartList<UnitInfo>* units, int16_t** map);
     static void DetermineThreats(UnitInfo* unit, Point position, int32_t caution_level, bool* teams,
                                  ThreatMap* air_force_map, ThreatMap* ground_forces_map);
-    static void SumUpMaps(int16_t** map1, int16_t** map2);
+    static void SumUpMaps(Grid2D<int16_t>& map1, Grid2D<int16_t>& map2);
     static void NormalizeThreatMap(ThreatMap* threat_map);
     static bool IsAbleToAttack(UnitInfo* attacker, ResourceID target_type, uint16_t team);
+    static bool GetThreatContribution(UnitInfo* unit, Point position, bool* teams, ThreatContribution* contribution);
+    bool GetThreatContribution(ThreatMap* threat_map, UnitInfo* unit, bool* teams, ThreatContribution* contribution);
+    void CollectThreatContributions(ResourceID risk_group_unit, bool is_for_attacking, bool* teams,
+                                    ObjectArray<ThreatContribution>* contributions);
+    void SyncThreatMap(ThreatMap* threat_map);
+    void FinalizeThreatMap(ThreatMap* threat_map, const Rect* bounds);
+    static bool IsInsideBounds(const Rect* bounds, Point position);
     ThreatMap* GetThreatMap(int32_t risk_level, int32_t caution_level, bool is_for_attacking);
     WeightTable GetWeightTable(ResourceID unit_type);
     void AddThreatToMineMap(int32_t grid_x, int32_t grid_y, int32_t range, int32_t damage_potential, int32_t factor);
@@ -206,5 +215,6 @@ int32_t AiPlayer_GetProjectedDamage(UnitInfo* friendly_unit, UnitInfo* enemy_uni
 
 extern AiPlayer AiPlayer_Teams[PLAYER_TEAM_MAX - 1];
 extern TerrainMap AiPlayer_TerrainMap;
+extern uint32_t AiPlayer_ThreatMapBuildCount;
 
 #endif /* AI_PLAYER_HPP */
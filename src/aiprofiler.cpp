@@ -0,0 +1,192 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "aiprofiler.hpp"
+
+#include <SDL_atomic.h>
+#include <SDL_mutex.h>
+#include <SDL_thread.h>
+#include <SDL_timer.h>
+
+#include <fstream>
+#include <vector>
+
+#include "game_manager.hpp"
+#include "inifile.hpp"
+#include "resource_manager.hpp"
+#include "smartstring.hpp"
+
+#define AIPROFILER_MAX_THREADS 16
+
+struct AiProfilerEvent {
+    const char* category;
+    const char* name;
+    ResourceID unit_type;
+    uint16_t team;
+    SDL_threadID thread;
+    uint64_t start;
+    uint64_t duration;
+};
+
+static std::vector<AiProfilerEvent> AiProfiler_Events;
+static SDL_mutex* AiProfiler_Mutex;
+static SDL_atomic_t AiProfiler_Enabled;
+static int32_t AiProfiler_TurnCounter;
+
+static const char* const AiProfiler_TeamNames[PLAYER_TEAM_MAX] = {"red team", "green team", "blue team", "gray team",
+                                                                  "alien team"};
+
+static void AiProfiler_Flush();
+
+AiProfiler::AiProfiler(const char* category, const char* name, ResourceID unit_type, uint16_t team)
+    : category(category), name(name), unit_type(unit_type), team(team), time_stamp(0) {
+    if (SDL_AtomicGet(&AiProfiler_Enabled)) {
+        time_stamp = SDL_GetPerformanceCounter();
+    }
+}
+
+AiProfiler::~AiProfiler() {
+    if (time_stamp && SDL_AtomicGet(&AiProfiler_Enabled)) {
+        const uint64_t duration = SDL_GetPerformanceCounter() - time_stamp;
+        AiProfilerEvent event{category, name, unit_type, team, SDL_ThreadID(), time_stamp, duration};
+
+        SDL_LockMutex(AiProfiler_Mutex);
+
+        AiProfiler_Events.push_back(event);
+
+        SDL_UnlockMutex(AiProfiler_Mutex);
+    }
+}
+
+static void AiProfiler_Flush() {
+    if (AiProfiler_Events.empty()) {
+        return;
+    }
+
+    SmartString filename;
+
+    filename.Sprintf(40, "ai_profile_turn_%i.json", AiProfiler_TurnCounter);
+
+    auto filepath{(ResourceManager_FilePathGamePref / filename.GetCStr()).lexically_normal()};
+    std::ofstream file(filepath.string().c_str());
+
+    if (file.is_open()) {
+        const double frequency = SDL_GetPerformanceFrequency();
+        SDL_threadID threads[AIPROFILER_MAX_THREADS];
+        uint16_t thread_count{0};
+        bool teams[PLAYER_TEAM_MAX + 1]{};
+        uint64_t origin = AiProfiler_Events[0].start;
+
+        for (const auto& event : AiProfiler_Events) {
+            if (event.start < origin) {
+                origin = event.start;
+            }
+        }
+
+        file << "{\"traceEvents\":[";
+
+        for (size_t i = 0; i < AiProfiler_Events.size(); ++i) {
+            const AiProfilerEvent& event = AiProfiler_Events[i];
+            uint16_t thread = 0;
+
+            // chrome trace viewers expect small thread ids, so they are numbered in order of appearance
+            while (thread < thread_count && threads[thread] != event.thread) {
+                ++thread;
+            }
+
+            if (thread == thread_count && thread_count < AIPROFILER_MAX_THREADS) {
+                threads[thread_count] = event.thread;
+                ++thread_count;
+            }
+
+            if (event.team <= PLAYER_TEAM_MAX) {
+                teams[event.team] = true;
+            }
+
+            file << (i ? ",\n" : "\n")
+                 << SmartString()
+                        .Sprintf(300,
+                                 "{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%i,"
+                                 "\"tid\":%i,\"args\":{\"unit\":\"%s\"}}",
+                                 event.name, event.category, ((event.start - origin) * 1000000.) / frequency,
+                                 (event.duration * 1000000.) / frequency, event.team, thread,
+                                 event.unit_type == INVALID_ID ? "" : ResourceManager_GetResourceID(event.unit_type))
+                        .GetCStr();
+        }
+
+        for (int32_t team = PLAYER_TEAM_RED; team <= PLAYER_TEAM_MAX; ++team) {
+            if (teams[team]) {
+                file << ",\n"
+                     << SmartString()
+                            .Sprintf(100,
+                                     "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%i,\"args\":{\"name\":\"%s\"}}",
+                                     team, team == PLAYER_TEAM_MAX ? "shared" : AiProfiler_TeamNames[team])
+                            .GetCStr();
+            }
+        }
+
+        file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    }
+
+    AiProfiler_Events.clear();
+}
+
+void AiProfiler_BeginTurn() {
+    const bool is_enabled = ini_get_setting(INI_AI_PROFILER) != 0;
+
+    if (!AiProfiler_Mutex) {
+        if (!is_enabled) {
+            return;
+        }
+
+        AiProfiler_Mutex = SDL_CreateMutex();
+
+        if (!AiProfiler_Mutex) {
+            ResourceManager_ExitGame(EXIT_CODE_INSUFFICIENT_MEMORY);
+        }
+    }
+
+    SDL_LockMutex(AiProfiler_Mutex);
+
+    if (AiProfiler_TurnCounter != GameManager_TurnCounter) {
+        AiProfiler_Flush();
+
+        AiProfiler_TurnCounter = GameManager_TurnCounter;
+    }
+
+    SDL_AtomicSet(&AiProfiler_Enabled, is_enabled);
+
+    SDL_UnlockMutex(AiProfiler_Mutex);
+}
+
+void AiProfiler_Close() {
+    if (AiProfiler_Mutex) {
+        SDL_LockMutex(AiProfiler_Mutex);
+
+        SDL_AtomicSet(&AiProfiler_Enabled, false);
+
+        AiProfiler_Flush();
+
+        SDL_UnlockMutex(AiProfiler_Mutex);
+    }
+}
+
+[[nodiscard]] bool AiProfiler_IsEnabled() noexcept { return SDL_AtomicGet(&AiProfiler_Enabled) != 0; }
@@ -0,0 +1,50 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef AIPROFILER_HPP
+#define AIPROFILER_HPP
+
+#include <cstdint>
+
+#include "enums.hpp"
+
+/// Scoped timing probe of the computer player. Finished scopes are collected per game turn and written to a Chrome
+/// trace event file (ai_profile_turn_N.json, load it in chrome://tracing or Perfetto) when the next turn starts. The
+/// probe does nothing unless the ai_profiler ini setting is enabled. Scopes that do not belong to a team are grouped
+/// under PLAYER_TEAM_MAX.
+class AiProfiler {
+    const char *category;
+    const char *name;
+    ResourceID unit_type;
+    uint16_t team;
+    uint64_t time_stamp;
+
+public:
+    AiProfiler(const char *category, const char *name, ResourceID unit_type = INVALID_ID,
+               uint16_t team = PLAYER_TEAM_MAX);
+    ~AiProfiler();
+};
+
+void AiProfiler_BeginTurn();
+void AiProfiler_Close();
+[[nodiscard]] bool AiProfiler_IsEnabled() noexcept;
+
+#endif /* AIPROFILER_HPP */
@@ -0,0 +1,215 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "assetloader.hpp"
+
+#include <SDL_assert.h>
+#include <SDL_cpuinfo.h>
+
+#include <new>
+
+#include "drawloadbar.hpp"
+
+#define ASSETLOADER_PROGRESS_PERIOD 20
+
+AssetLoader::AssetLoader()
+    : job_count(0), finished_job_count(0), total_weight(0), finished_weight(0), mutex(nullptr), condition(nullptr) {}
+
+AssetLoader::~AssetLoader() {
+    if (condition) {
+        SDL_DestroyCond(condition);
+    }
+
+    if (mutex) {
+        SDL_DestroyMutex(mutex);
+    }
+}
+
+int32_t AssetLoader::AddJob(JobFunction function, void *data, int32_t weight) {
+    SDL_assert(job_count < ASSETLOADER_MAX_JOBS);
+
+    Job &job = jobs[job_count];
+
+    job.function = function;
+    job.data = data;
+    job.weight = weight;
+    job.pending_count = 0;
+    job.successors = 0;
+    job.is_started = false;
+
+    total_weight += weight;
+
+    return job_count++;
+}
+
+void AssetLoader::AddDependency(int32_t job, int32_t prerequisite) {
+    SDL_assert(job >= 0 && job < job_count);
+    SDL_assert(prerequisite >= 0 && prerequisite < job);
+
+    if (!(jobs[prerequisite].successors & (1ull << job))) {
+        jobs[prerequisite].successors |= 1ull << job;
+        ++jobs[job].pending_count;
+    }
+}
+
+int32_t AssetLoader::GetJobCount() const { return job_count; }
+
+int32_t AssetLoader::TakeJob() {
+    for (int32_t i = 0; i < job_count; ++i) {
+        if (!jobs[i].is_started && jobs[i].pending_count == 0) {
+            jobs[i].is_started = true;
+
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+void AssetLoader::FinishJob(int32_t job) {
+    for (int32_t i = job + 1; i < job_count; ++i) {
+        if (jobs[job].successors & (1ull << i)) {
+            --jobs[i].pending_count;
+        }
+    }
+
+    finished_weight += jobs[job].weight;
+    ++finished_job_count;
+}
+
+int16_t AssetLoader::GetProgress(int16_t first_value, int16_t last_value) const {
+    int16_t result;
+
+    if (total_weight > 0) {
+        result = first_value + (last_value - first_value) * finished_weight / total_weight;
+
+    } else {
+        result = last_value;
+    }
+
+    return result;
+}
+
+int AssetLoader::Worker(void *data) noexcept {
+    AssetLoader *loader = reinterpret_cast<AssetLoader *>(data);
+
+    SDL_LockMutex(loader->mutex);
+
+    while (loader->finished_job_count < loader->job_count) {
+        int32_t job = loader->TakeJob();
+
+        if (job >= 0) {
+            SDL_UnlockMutex(loader->mutex);
+
+            loader->jobs[job].function(loader->jobs[job].data);
+
+            SDL_LockMutex(loader->mutex);
+
+            loader->FinishJob(job);
+
+            SDL_CondBroadcast(loader->condition);
+
+        } else {
+            SDL_CondWait(loader->condition, loader->mutex);
+        }
+    }
+
+    SDL_UnlockMutex(loader->mutex);
+
+    return 0;
+}
+
+void AssetLoader::Run(DrawLoadBar *load_bar, int16_t first_value, int16_t last_value) {
+    SDL_Thread *threads[ASSETLOADER_MAX_THREADS];
+    int32_t thread_count = 0;
+
+    if (!mutex) {
+        mutex = SDL_CreateMutex();
+        condition = SDL_CreateCond();
+    }
+
+    if (mutex && condition) {
+        int32_t count = SDL_GetCPUCount();
+
+        if (count > job_count) {
+            count = job_count;
+        }
+
+        if (count > ASSETLOADER_MAX_THREADS) {
+            count = ASSETLOADER_MAX_THREADS;
+        }
+
+        for (int32_t i = 0; i < count; ++i) {
+            threads[thread_count] = SDL_CreateThread(&AssetLoader::Worker, "AssetLoader", this);
+
+            if (threads[thread_count]) {
+                ++thread_count;
+            }
+        }
+    }
+
+    if (thread_count > 0) {
+        SDL_LockMutex(mutex);
+
+        while (finished_job_count < job_count) {
+            SDL_CondWaitTimeout(condition, mutex, ASSETLOADER_PROGRESS_PERIOD);
+
+            if (load_bar) {
+                const int16_t value = GetProgress(first_value, last_value);
+
+                SDL_UnlockMutex(mutex);
+
+                load_bar->SetValue(value);
+
+                SDL_LockMutex(mutex);
+            }
+        }
+
+        SDL_UnlockMutex(mutex);
+
+        for (int32_t i = 0; i < thread_count; ++i) {
+            SDL_WaitThread(threads[i], nullptr);
+        }
+
+    } else {
+        /* no worker threads available, run the graph in dependency order on the calling thread */
+        for (int32_t job; (job = TakeJob()) >= 0;) {
+            jobs[job].function(jobs[job].data);
+
+            FinishJob(job);
+
+            if (load_bar) {
+                load_bar->SetValue(GetProgress(first_value, last_value));
+            }
+        }
+    }
+
+    SDL_assert(finished_job_count == job_count);
+
+    if (load_bar) {
+        load_bar->SetValue(last_value);
+    }
+
+    job_count = 0;
+    finished_job_count = 0;
+    total_weight = 0;
+    finished_weight = 0;
+}
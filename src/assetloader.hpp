@@ -0,0 +1,76 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ASSETLOADER_HPP
+#define ASSETLOADER_HPP
+
+#include <SDL_mutex.h>
+#include <SDL_thread.h>
+
+#include <cstdint>
+
+#define ASSETLOADER_MAX_JOBS 64
+#define ASSETLOADER_MAX_THREADS 8
+
+class DrawLoadBar;
+
+/// Small task graph that runs independent asset loading steps on worker threads. Jobs are added up front together
+/// with their dependencies, Run executes the whole graph and returns once every job finished. The calling thread
+/// only reports progress to the load bar so that all drawing stays on the main thread. Jobs must not touch the
+/// window system or any state that another job writes.
+class AssetLoader {
+public:
+    typedef void (*JobFunction)(void *data);
+
+private:
+    struct Job {
+        JobFunction function;
+        void *data;
+        int32_t weight;
+        int32_t pending_count;
+        uint64_t successors;
+        bool is_started;
+    };
+
+    Job jobs[ASSETLOADER_MAX_JOBS];
+    int32_t job_count;
+    int32_t finished_job_count;
+    int32_t total_weight;
+    int32_t finished_weight;
+    SDL_mutex *mutex;
+    SDL_cond *condition;
+
+    static int Worker(void *data) noexcept;
+    int32_t TakeJob();
+    void FinishJob(int32_t job);
+    int16_t GetProgress(int16_t first_value, int16_t last_value) const;
+
+public:
+    AssetLoader();
+    ~AssetLoader();
+
+    int32_t AddJob(JobFunction function, void *data, int32_t weight = 1);
+    void AddDependency(int32_t job, int32_t prerequisite);
+    void Run(DrawLoadBar *load_bar, int16_t first_value, int16_t last_value);
+    int32_t GetJobCount() const;
+};
+
+#endif /* ASSETLOADER_HPP */
@@ -0,0 +1,697 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "clustermap.hpp"
+
+#include "paths.hpp"
+#include "resource_manager.hpp"
+#include "searcher.hpp"
+
+#define CLUSTERMAP_MAX_ENTRANCE_WIDTH 6
+#define CLUSTERMAP_COST_UNREACHABLE UINT16_MAX
+
+enum {
+    CLUSTERMAP_BORDER_NORTH,
+    CLUSTERMAP_BORDER_EAST,
+    CLUSTERMAP_BORDER_SOUTH,
+    CLUSTERMAP_BORDER_WEST,
+    CLUSTERMAP_BORDER_COUNT
+};
+
+struct ClusterSquare {
+    int32_t node;
+    int32_t cost;
+};
+
+static int32_t ClusterMap_GetLineDistance(Point position1, Point position2);
+
+template <class T>
+static void ClusterMap_Push(ObjectArray<T> &queue, const T &square) {
+    int32_t index = queue.GetCount();
+
+    /* the queue is a binary min heap, the cheapest square is kept at the front */
+    queue.Append(&square);
+
+    while (index > 0) {
+        const int32_t parent = (index - 1) / 2;
+
+        if (queue[parent]->cost <= square.cost) {
+            break;
+        }
+
+        *queue[index] = *queue[parent];
+        index = parent;
+    }
+
+    *queue[index] = square;
+}
+
+template <class T>
+static T ClusterMap_Pop(ObjectArray<T> &queue) {
+    const T result = *queue[0];
+    const T last = *queue[queue.GetCount() - 1];
+    const int32_t count = queue.GetCount() - 1;
+
+    queue.Remove(count);
+
+    if (count > 0) {
+        int32_t index = 0;
+
+        /* the last square sifts down from the vacated front */
+        for (;;) {
+            int32_t child = index * 2 + 1;
+
+            if (child >= count) {
+                break;
+            }
+
+            if (child + 1 < count && queue[child + 1]->cost < queue[child]->cost) {
+                ++child;
+            }
+
+            if (last.cost <= queue[child]->cost) {
+                break;
+            }
+
+            *queue[index] = *queue[child];
+            index = child;
+        }
+
+        *queue[index] = last;
+    }
+
+    return result;
+}
+
+int32_t ClusterMap_GetLineDistance(Point position1, Point position2) {
+    const int32_t distance_x = labs(position1.x - position2.x);
+    const int32_t distance_y = labs(position1.y - position2.y);
+
+    /* same estimate as used by Searcher, two cost units per straight step and three per diagonal step */
+    return (distance_x > distance_y) ? (distance_x * 2 + distance_y) : (distance_y * 2 + distance_x);
+}
+
+ClusterMap::ClusterMap()
+    : map_size(0, 0),
+      cluster_count(0, 0),
+      snapshot(nullptr),
+      clusters(nullptr),
+      vertical_borders(nullptr),
+      horizontal_borders(nullptr),
+      team(0),
+      unit_type(INVALID_ID),
+      flags(0),
+      caution_level(0),
+      time_stamp(0) {}
+
+ClusterMap::~ClusterMap() { Deinit(); }
+
+void ClusterMap::Init() {
+    map_size = ResourceManager_MapSize;
+
+    cluster_count.x = (map_size.x + CLUSTERMAP_CLUSTER_SIZE - 1) / CLUSTERMAP_CLUSTER_SIZE;
+    cluster_count.y = (map_size.y + CLUSTERMAP_CLUSTER_SIZE - 1) / CLUSTERMAP_CLUSTER_SIZE;
+
+    snapshot = new (std::nothrow) uint8_t[map_size.x * map_size.y];
+    clusters = new (std::nothrow) Cluster[cluster_count.x * cluster_count.y];
+    vertical_borders = new (std::nothrow) ObjectArray<int16_t>[(cluster_count.x - 1) * cluster_count.y + 1];
+    horizontal_borders = new (std::nothrow) ObjectArray<int16_t>[cluster_count.x * (cluster_count.y - 1) + 1];
+
+    for (int32_t i = 0; i < cluster_count.x * cluster_count.y; ++i) {
+        clusters[i].costs = nullptr;
+        clusters[i].is_dirty = true;
+    }
+}
+
+void ClusterMap::Deinit() {
+    if (clusters) {
+        for (int32_t i = 0; i < cluster_count.x * cluster_count.y; ++i) {
+            delete[] clusters[i].costs;
+        }
+    }
+
+    delete[] snapshot;
+    delete[] clusters;
+    delete[] vertical_borders;
+    delete[] horizontal_borders;
+
+    snapshot = nullptr;
+    clusters = nullptr;
+    vertical_borders = nullptr;
+    horizontal_borders = nullptr;
+
+    map_size = {0, 0};
+    cluster_count = {0, 0};
+}
+
+uint8_t ClusterMap::GetCost(int32_t grid_x, int32_t grid_y) const {
+    return snapshot[grid_x * map_size.y + grid_y] & 0x1F;
+}
+
+void ClusterMap::GetClusterBounds(int32_t cluster_index, Point &ulp, Point &lrp) const {
+    ulp.x = (cluster_index % cluster_count.x) * CLUSTERMAP_CLUSTER_SIZE;
+    ulp.y = (cluster_index / cluster_count.x) * CLUSTERMAP_CLUSTER_SIZE;
+
+    lrp.x = std::min(ulp.x + CLUSTERMAP_CLUSTER_SIZE, static_cast<int32_t>(map_size.x));
+    lrp.y = std::min(ulp.y + CLUSTERMAP_CLUSTER_SIZE, static_cast<int32_t>(map_size.y));
+}
+
+int32_t ClusterMap::GetClusterIndex(Point position) const {
+    return (position.y / CLUSTERMAP_CLUSTER_SIZE) * cluster_count.x + (position.x / CLUSTERMAP_CLUSTER_SIZE);
+}
+
+void ClusterMap::GetBorders(int32_t cluster_index, ObjectArray<int16_t> **borders) const {
+    const int32_t cluster_x = cluster_index % cluster_count.x;
+    const int32_t cluster_y = cluster_index / cluster_count.x;
+
+    borders[CLUSTERMAP_BORDER_NORTH] =
+        (cluster_y > 0) ? &horizontal_borders[(cluster_y - 1) * cluster_count.x + cluster_x] : nullptr;
+    borders[CLUSTERMAP_BORDER_EAST] =
+        (cluster_x < cluster_count.x - 1) ? &vertical_borders[cluster_y * (cluster_count.x - 1) + cluster_x] : nullptr;
+    borders[CLUSTERMAP_BORDER_SOUTH] =
+        (cluster_y < cluster_count.y - 1) ? &horizontal_borders[cluster_y * cluster_count.x + cluster_x] : nullptr;
+    borders[CLUSTERMAP_BORDER_WEST] =
+        (cluster_x > 0) ? &vertical_borders[cluster_y * (cluster_count.x - 1) + cluster_x - 1] : nullptr;
+}
+
+bool ClusterMap::UpdateBorder(ObjectArray<int16_t> *border, Point position, Point step, Point offset,
+                              int32_t length) {
+    ObjectArray<int16_t> entrances;
+    int32_t entrance_start = -1;
+
+    /* one extra iteration closes an entrance that reaches the end of the border */
+    for (int32_t i = 0; i <= length; ++i) {
+        const Point site1 = position + Point(step.x * i, step.y * i);
+        const Point site2 = site1 + offset;
+        const bool is_passable = (i < length) && GetCost(site1.x, site1.y) && GetCost(site2.x, site2.y);
+
+        if (is_passable) {
+            if (entrance_start < 0) {
+                entrance_start = i;
+            }
+
+        } else if (entrance_start >= 0) {
+            const int32_t base = step.x ? position.x : position.y;
+            int16_t portal;
+
+            if (i - entrance_start > CLUSTERMAP_MAX_ENTRANCE_WIDTH) {
+                portal = base + entrance_start;
+                entrances.Append(&portal);
+
+                portal = base + i - 1;
+                entrances.Append(&portal);
+
+            } else {
+                portal = base + (entrance_start + i - 1) / 2;
+                entrances.Append(&portal);
+            }
+
+            entrance_start = -1;
+        }
+    }
+
+    bool is_changed = entrances.GetCount() != border->GetCount();
+
+    for (int32_t i = 0; !is_changed && i < entrances.GetCount(); ++i) {
+        is_changed = *entrances[i] != *(*border)[i];
+    }
+
+    if (is_changed) {
+        border->Clear();
+
+        for (int32_t i = 0; i < entrances.GetCount(); ++i) {
+            border->Append(entrances[i]);
+        }
+    }
+
+    return is_changed;
+}
+
+void ClusterMap::UpdateCluster(int32_t cluster_index) {
+    Cluster &cluster = clusters[cluster_index];
+    ObjectArray<int16_t> *borders[CLUSTERMAP_BORDER_COUNT];
+    Point ulp;
+    Point lrp;
+
+    GetClusterBounds(cluster_index, ulp, lrp);
+    GetBorders(cluster_index, borders);
+
+    cluster.portals.Clear();
+
+    for (int32_t side = 0; side < CLUSTERMAP_BORDER_COUNT; ++side) {
+        if (borders[side]) {
+            for (int32_t i = 0; i < borders[side]->GetCount(); ++i) {
+                const int16_t coordinate = *(*borders[side])[i];
+                Point portal;
+
+                switch (side) {
+                    case CLUSTERMAP_BORDER_NORTH: {
+                        portal = Point(coordinate, ulp.y);
+                    } break;
+
+                    case CLUSTERMAP_BORDER_EAST: {
+                        portal = Point(lrp.x - 1, coordinate);
+                    } break;
+
+                    case CLUSTERMAP_BORDER_SOUTH: {
+                        portal = Point(coordinate, lrp.y - 1);
+                    } break;
+
+                    case CLUSTERMAP_BORDER_WEST: {
+                        portal = Point(ulp.x, coordinate);
+                    } break;
+                }
+
+                cluster.portals.Append(&portal);
+            }
+        }
+    }
+
+    const int32_t portal_count = cluster.portals.GetCount();
+    uint16_t costs[CLUSTERMAP_CLUSTER_SIZE * CLUSTERMAP_CLUSTER_SIZE];
+
+    delete[] cluster.costs;
+    cluster.costs = new (std::nothrow) uint16_t[portal_count * portal_count + 1];
+
+    for (int32_t i = 0; i < portal_count; ++i) {
+        EvaluateCosts(cluster_index, *cluster.portals[i], false, costs);
+
+        for (int32_t j = 0; j < portal_count; ++j) {
+            const Point position = *cluster.portals[j];
+
+            cluster.costs[i * portal_count + j] =
+                costs[(position.x - ulp.x) * CLUSTERMAP_CLUSTER_SIZE + (position.y - ulp.y)];
+        }
+    }
+
+    cluster.is_dirty = false;
+}
+
+void ClusterMap::EvaluateCosts(int32_t cluster_index, Point position, bool reverse, uint16_t *costs) const {
+    ObjectArray<PathSquare> squares;
+    PathSquare square;
+    Point ulp;
+    Point lrp;
+
+    GetClusterBounds(cluster_index, ulp, lrp);
+
+    for (int32_t i = 0; i < CLUSTERMAP_CLUSTER_SIZE * CLUSTERMAP_CLUSTER_SIZE; ++i) {
+        costs[i] = CLUSTERMAP_COST_UNREACHABLE;
+    }
+
+    costs[(position.x - ulp.x) * CLUSTERMAP_CLUSTER_SIZE + (position.y - ulp.y)] = 0;
+
+    square.point = position;
+    square.cost = 0;
+
+    ClusterMap_Push(squares, square);
+
+    while (squares.GetCount()) {
+        square = ClusterMap_Pop(squares);
+
+        if (square.cost > costs[(square.point.x - ulp.x) * CLUSTERMAP_CLUSTER_SIZE + (square.point.y - ulp.y)]) {
+            continue;
+        }
+
+        for (int32_t direction = 0; direction < 8; ++direction) {
+            const Point step = square.point + Paths_8DirPointsArray[direction];
+
+            if (step.x >= ulp.x && step.x < lrp.x && step.y >= ulp.y && step.y < lrp.y) {
+                int32_t cost = GetCost(step.x, step.y);
+
+                if (cost > 0) {
+                    /* forward costs are paid on entry of a tile, reverse costs are paid on leaving it */
+                    if (reverse) {
+                        cost = GetCost(square.point.x, square.point.y);
+                    }
+
+                    if (direction & 1) {
+                        cost = (cost * 3) / 2;
+                    }
+
+                    cost += square.cost;
+
+                    uint16_t &step_cost = costs[(step.x - ulp.x) * CLUSTERMAP_CLUSTER_SIZE + (step.y - ulp.y)];
+
+                    if (cost < step_cost) {
+                        PathSquare next_square;
+
+                        step_cost = cost;
+
+                        next_square.point = step;
+                        next_square.cost = cost;
+
+                        ClusterMap_Push(squares, next_square);
+                    }
+                }
+            }
+        }
+    }
+}
+
+int32_t ClusterMap::GetPortalPartner(int32_t cluster_index, int32_t portal_index, int32_t &partner_index) const {
+    ObjectArray<int16_t> *borders[CLUSTERMAP_BORDER_COUNT];
+    int32_t side;
+
+    GetBorders(cluster_index, borders);
+
+    for (side = 0; side < CLUSTERMAP_BORDER_COUNT; ++side) {
+        const int32_t count = borders[side] ? borders[side]->GetCount() : 0;
+
+        if (portal_index < count) {
+            break;
+        }
+
+        portal_index -= count;
+    }
+
+    SDL_assert(side < CLUSTERMAP_BORDER_COUNT);
+
+    const int32_t partner_side = (side + 2) % CLUSTERMAP_BORDER_COUNT;
+    int32_t partner_cluster;
+
+    switch (side) {
+        case CLUSTERMAP_BORDER_NORTH: {
+            partner_cluster = cluster_index - cluster_count.x;
+        } break;
+
+        case CLUSTERMAP_BORDER_EAST: {
+            partner_cluster = cluster_index + 1;
+        } break;
+
+        case CLUSTERMAP_BORDER_SOUTH: {
+            partner_cluster = cluster_index + cluster_count.x;
+        } break;
+
+        default: {
+            partner_cluster = cluster_index - 1;
+        } break;
+    }
+
+    GetBorders(partner_cluster, borders);
+
+    partner_index = portal_index;
+
+    for (int32_t i = 0; i < partner_side; ++i) {
+        partner_index += borders[i] ? borders[i]->GetCount() : 0;
+    }
+
+    return partner_cluster;
+}
+
+void ClusterMap::Update(uint8_t **map) {
+    if (map_size != ResourceManager_MapSize) {
+        Deinit();
+        Init();
+
+        for (int32_t i = 0; i < map_size.x; ++i) {
+            memcpy(&snapshot[i * map_size.y], map[i], map_size.y);
+        }
+
+    } else {
+        for (int32_t cluster_index = 0; cluster_index < GetClusterCount(); ++cluster_index) {
+            Point ulp;
+            Point lrp;
+
+            GetClusterBounds(cluster_index, ulp, lrp);
+
+            for (int32_t i = ulp.x; i < lrp.x; ++i) {
+                uint8_t *column = &snapshot[i * map_size.y + ulp.y];
+
+                if (memcmp(column, &map[i][ulp.y], lrp.y - ulp.y)) {
+                    memcpy(column, &map[i][ulp.y], lrp.y - ulp.y);
+
+                    clusters[cluster_index].is_dirty = true;
+                }
+            }
+        }
+    }
+
+    {
+        bool *is_changed = new (std::nothrow) bool[GetClusterCount()];
+
+        for (int32_t i = 0; i < GetClusterCount(); ++i) {
+            is_changed[i] = clusters[i].is_dirty;
+        }
+
+        /* a modified cluster may open or close entrances along its borders which changes the portals of its
+         * neighbours as well
+         */
+        for (int32_t cluster_y = 0; cluster_y < cluster_count.y; ++cluster_y) {
+            for (int32_t cluster_x = 0; cluster_x < cluster_count.x; ++cluster_x) {
+                const int32_t cluster_index = cluster_y * cluster_count.x + cluster_x;
+                Point ulp;
+                Point lrp;
+
+                GetClusterBounds(cluster_index, ulp, lrp);
+
+                if (cluster_x < cluster_count.x - 1) {
+                    const int32_t neighbour = cluster_index + 1;
+
+                    if ((is_changed[cluster_index] || is_changed[neighbour]) &&
+                        UpdateBorder(&vertical_borders[cluster_y * (cluster_count.x - 1) + cluster_x],
+                                     Point(lrp.x - 1, ulp.y), Point(0, 1), Point(1, 0), lrp.y - ulp.y)) {
+                        clusters[cluster_index].is_dirty = true;
+                        clusters[neighbour].is_dirty = true;
+                    }
+                }
+
+                if (cluster_y < cluster_count.y - 1) {
+                    const int32_t neighbour = cluster_index + cluster_count.x;
+
+                    if ((is_changed[cluster_index] || is_changed[neighbour]) &&
+                        UpdateBorder(&horizontal_borders[cluster_y * cluster_count.x + cluster_x],
+                                     Point(ulp.x, lrp.y - 1), Point(1, 0), Point(0, 1), lrp.x - ulp.x)) {
+                        clusters[cluster_index].is_dirty = true;
+                        clusters[neighbour].is_dirty = true;
+                    }
+                }
+            }
+        }
+
+        delete[] is_changed;
+    }
+
+    for (int32_t cluster_index = 0; cluster_index < GetClusterCount(); ++cluster_index) {
+        if (clusters[cluster_index].is_dirty) {
+            UpdateCluster(cluster_index);
+        }
+    }
+}
+
+bool ClusterMap::FindCorridor(Point start, Point destination, bool *corridor) const {
+    const int32_t total_clusters = GetClusterCount();
+    const int32_t start_cluster = GetClusterIndex(start);
+    const int32_t destination_cluster = GetClusterIndex(destination);
+    bool result;
+
+    if (start_cluster == destination_cluster) {
+        return false;
+    }
+
+    int32_t *offsets = new (std::nothrow) int32_t[total_clusters + 1];
+
+    offsets[0] = 0;
+
+    for (int32_t i = 0; i < total_clusters; ++i) {
+        offsets[i + 1] = offsets[i] + clusters[i].portals.GetCount();
+    }
+
+    const int32_t start_node = offsets[total_clusters];
+    const int32_t destination_node = start_node + 1;
+    const int32_t node_count = start_node + 2;
+
+    int32_t *node_clusters = new (std::nothrow) int32_t[node_count];
+    int32_t *node_costs = new (std::nothrow) int32_t[node_count];
+    int32_t *node_parents = new (std::nothrow) int32_t[node_count];
+    bool *node_closed = new (std::nothrow) bool[node_count];
+    uint16_t start_costs[CLUSTERMAP_CLUSTER_SIZE * CLUSTERMAP_CLUSTER_SIZE];
+    uint16_t destination_costs[CLUSTERMAP_CLUSTER_SIZE * CLUSTERMAP_CLUSTER_SIZE];
+    ObjectArray<ClusterSquare> squares;
+
+    for (int32_t i = 0; i < total_clusters; ++i) {
+        for (int32_t j = offsets[i]; j < offsets[i + 1]; ++j) {
+            node_clusters[j] = i;
+        }
+    }
+
+    node_clusters[start_node] = start_cluster;
+    node_clusters[destination_node] = destination_cluster;
+
+    for (int32_t i = 0; i < node_count; ++i) {
+        node_costs[i] = INT32_MAX;
+        node_parents[i] = -1;
+        node_closed[i] = false;
+    }
+
+    EvaluateCosts(start_cluster, start, false, start_costs);
+    EvaluateCosts(destination_cluster, destination, true, destination_costs);
+
+    node_costs[start_node] = 0;
+
+    {
+        ClusterSquare square;
+
+        square.node = start_node;
+        square.cost = ClusterMap_GetLineDistance(start, destination);
+
+        ClusterMap_Push(squares, square);
+    }
+
+    while (squares.GetCount()) {
+        const int32_t node = ClusterMap_Pop(squares).node;
+
+        if (node == destination_node) {
+            break;
+        }
+
+        if (node_closed[node]) {
+            continue;
+        }
+
+        node_closed[node] = true;
+
+        const int32_t cluster_index = node_clusters[node];
+        const Cluster &cluster = clusters[cluster_index];
+        const int32_t portal_count = cluster.portals.GetCount();
+        const int32_t portal_index = node - offsets[cluster_index];
+
+        auto relax = [&](int32_t next_node, int32_t cost) {
+            if (cost < node_costs[next_node]) {
+                ClusterSquare square;
+                Point position;
+
+                node_costs[next_node] = cost;
+                node_parents[next_node] = node;
+
+                if (next_node == destination_node) {
+                    square.cost = cost;
+
+                } else {
+                    const int32_t next_cluster = node_clusters[next_node];
+
+                    position = *clusters[next_cluster].portals[next_node - offsets[next_cluster]];
+                    square.cost = cost + ClusterMap_GetLineDistance(position, destination);
+                }
+
+                square.node = next_node;
+
+                ClusterMap_Push(squares, square);
+            }
+        };
+
+        if (node == start_node) {
+            Point ulp;
+            Point lrp;
+
+            GetClusterBounds(start_cluster, ulp, lrp);
+
+            for (int32_t i = 0; i < portal_count; ++i) {
+                const Point position = *cluster.portals[i];
+                const uint16_t cost =
+                    start_costs[(position.x - ulp.x) * CLUSTERMAP_CLUSTER_SIZE + (position.y - ulp.y)];
+
+                if (cost != CLUSTERMAP_COST_UNREACHABLE) {
+                    relax(offsets[start_cluster] + i, cost);
+                }
+            }
+
+            continue;
+        }
+
+        for (int32_t i = 0; i < portal_count; ++i) {
+            const uint16_t cost = cluster.costs[portal_index * portal_count + i];
+
+            if (i != portal_index && cost != CLUSTERMAP_COST_UNREACHABLE) {
+                relax(offsets[cluster_index] + i, node_costs[node] + cost);
+            }
+        }
+
+        {
+            int32_t partner_index;
+            const int32_t partner_cluster = GetPortalPartner(cluster_index, portal_index, partner_index);
+            const Point partner = *clusters[partner_cluster].portals[partner_index];
+
+            relax(offsets[partner_cluster] + partner_index, node_costs[node] + GetCost(partner.x, partner.y));
+        }
+
+        if (cluster_index == destination_cluster) {
+            Point ulp;
+            Point lrp;
+            const Point position = *cluster.portals[portal_index];
+
+            GetClusterBounds(destination_cluster, ulp, lrp);
+
+            const uint16_t cost =
+                destination_costs[(position.x - ulp.x) * CLUSTERMAP_CLUSTER_SIZE + (position.y - ulp.y)];
+
+            if (cost != CLUSTERMAP_COST_UNREACHABLE) {
+                relax(destination_node, node_costs[node] + cost);
+            }
+        }
+    }
+
+    if (node_costs[destination_node] != INT32_MAX) {
+        for (int32_t i = 0; i < total_clusters; ++i) {
+            corridor[i] = false;
+        }
+
+        for (int32_t node = destination_node; node >= 0; node = node_parents[node]) {
+            corridor[node_clusters[node]] = true;
+        }
+
+        result = true;
+
+    } else {
+        result = false;
+    }
+
+    delete[] offsets;
+    delete[] node_clusters;
+    delete[] node_costs;
+    delete[] node_parents;
+    delete[] node_closed;
+
+    return result;
+}
+
+void ClusterMap::ApplyCorridor(uint8_t **map, const bool *corridor) const {
+    for (int32_t cluster_index = 0; cluster_index < GetClusterCount(); ++cluster_index) {
+        if (!corridor[cluster_index]) {
+            Point ulp;
+            Point lrp;
+
+            GetClusterBounds(cluster_index, ulp, lrp);
+
+            for (int32_t i = ulp.x; i < lrp.x; ++i) {
+                memset(&map[i][ulp.y], 0, lrp.y - ulp.y);
+            }
+        }
+    }
+}
+
+void ClusterMap::Restore(uint8_t **map) const {
+    for (int32_t i = 0; i < map_size.x; ++i) {
+        memcpy(map[i], &snapshot[i * map_size.y], map_size.y);
+    }
+}
+
+int32_t ClusterMap::GetClusterCount() const { return cluster_count.x * cluster_count.y; }
@@ -0,0 +1,78 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CLUSTERMAP_HPP
+#define CLUSTERMAP_HPP
+
+#include "enums.hpp"
+#include "point.hpp"
+#include "smartobjectarray.hpp"
+
+#define CLUSTERMAP_CLUSTER_SIZE 10
+
+/// Abstract graph of map clusters and border portals built on top of a path generator access map. The graph is used
+/// to find the corridor of clusters a long path has to cross so that the Searcher can be limited to that corridor.
+/// Clusters are rebuilt incrementally, only those whose access map content changed since the previous update are
+/// processed again.
+class ClusterMap {
+    struct Cluster {
+        ObjectArray<Point> portals;
+        uint16_t *costs;
+        bool is_dirty;
+    };
+
+    Point map_size;
+    Point cluster_count;
+    uint8_t *snapshot;
+    Cluster *clusters;
+    ObjectArray<int16_t> *vertical_borders;
+    ObjectArray<int16_t> *horizontal_borders;
+
+    void Init();
+    void Deinit();
+
+    uint8_t GetCost(int32_t grid_x, int32_t grid_y) const;
+    void GetClusterBounds(int32_t cluster_index, Point &ulp, Point &lrp) const;
+    int32_t GetClusterIndex(Point position) const;
+    void GetBorders(int32_t cluster_index, ObjectArray<int16_t> **borders) const;
+    bool UpdateBorder(ObjectArray<int16_t> *border, Point position, Point step, Point offset, int32_t length);
+    void UpdateCluster(int32_t cluster_index);
+    void EvaluateCosts(int32_t cluster_index, Point position, bool reverse, uint16_t *costs) const;
+    int32_t GetPortalPartner(int32_t cluster_index, int32_t portal_index, int32_t &partner_index) const;
+
+public:
+    ClusterMap();
+    ~ClusterMap();
+
+    void Update(uint8_t **map);
+    bool FindCorridor(Point start, Point destination, bool *corridor) const;
+    void ApplyCorridor(uint8_t **map, const bool *corridor) const;
+    void Restore(uint8_t **map) const;
+    int32_t GetClusterCount() const;
+
+    uint16_t team;
+    ResourceID unit_type;
+    uint8_t flags;
+    uint8_t caution_level;
+    uint32_t time_stamp;
+};
+
+#endif /* CLUSTERMAP_HPP */
@@ -34,6 +34,7 @@
 #include "flicsmgr.hpp"
 #include "gfx.hpp"
 #include "hash.hpp"
+#include "headless.hpp"
 #include "helpmenu.hpp"
 #include "inifile.hpp"
 #include "localization.hpp"
@@ -50,6 +51,7 @@
 #include "reportstats.hpp"
 #include "researchmenu.hpp"
 #include "resource_manager.hpp"
+#include "saveload.hpp"
 #include "saveloadmenu.hpp"
 #include "sound_manager.hpp"
 #include "survey.hpp"
@@ -61,6 +63,7 @@
 #include "units_manager.hpp"
 #include "unitstats.hpp"
 #include "window_manager.hpp"
+#include "winloss.hpp"
 
 #define MENU_QUICK_BUILD_GUI_ITEM_DEF(id1, id2, ulx, uly, width, height, r_value) \
     {(r_value), (id1), (id2), (ulx), (uly), (width), (height), (0), (0)}
@@ -672,6 +675,7 @@ static void GameManager_UpdateScoreGraph();
 static void GameManager_InitUnitsAndGameState();
 static bool GameManager_InitGame();
 static void GameManager_UpdateHumanPlayerCount();
+static void GameManager_PrewarmSfx();
 static void GameManager_MenuAnimateDisplayControls();
 static void GameManager_ManagePlayerAction();
 static bool GameManager_InitPopupButtons(UnitInfo* unit);
@@ -909,7 +913,13 @@ bool GameManager_TeamTurnFinish(uint32_t turn_counter_session_start, uint16_t te
 
         log.Log("Checking victory conditions.");
 
-        if (menu_check_end_game_conditions(GameManager_TurnCounter, turn_counter_session_start, GameManager_DemoMode)) {
+        if (Headless_IsEnabled() && Headless_FinishTurn()) {
+            Headless_RecordResult(WinLoss_EvaluateStatus(GameManager_TurnCounter), GameManager_TurnCounter);
+            GameManager_GameState = GAME_STATE_3_MAIN_MENU;
+            result = true;
+
+        } else if (menu_check_end_game_conditions(GameManager_TurnCounter, turn_counter_session_start,
+                                                  GameManager_DemoMode)) {
             result = true;
 
         } else {
@@ -2109,6 +2119,10 @@ void GameManager_GameSetup(int32_t game_state) {
     int32_t max_zoom_level;
     uint32_t timestamp;
 
+    if (Headless_IsEnabled()) {
+        Headless_BeginGame();
+    }
+
     GameManager_InitUnitsAndGameState();
 
     if (Remote_IsNetworkGame) {
@@ -2134,7 +2148,8 @@ void GameManager_GameSetup(int32_t game_state) {
 
         MouseEvent::Clear();
 
-        if (GameManager_PlayScenarioIntro && ini_get_setting(INI_GAME_FILE_TYPE) == GAME_TYPE_CUSTOM) {
+        if (GameManager_PlayScenarioIntro && ini_get_setting(INI_GAME_FILE_TYPE) == GAME_TYPE_CUSTOM &&
+            !Headless_IsEnabled()) {
             Color* palette;
 
             GameManager_LandingSequence.DeleteButtons();
@@ -2184,6 +2199,14 @@ void GameManager_GameSetup(int32_t game_state) {
             return;
         }
 
+        if (Headless_IsEnabled()) {
+            /* loaded games must not continue with the random number sequence of the session that loaded them */
+            Remote_RngSeed = Headless_GetRngSeed();
+            dos_srand(Remote_RngSeed);
+
+            Headless_TakeOverTeams();
+        }
+
         GameManager_GameState = GAME_STATE_11;
 
         GameManager_LandingSequence.OpenPanel();
@@ -2198,6 +2221,8 @@ void GameManager_GameSetup(int32_t game_state) {
 
     GameManager_GameState = GAME_STATE_8_IN_GAME;
 
+    GameManager_PrewarmSfx();
+
     Access_UpdateVisibilityStatus(GameManager_AllVisible);
 
     SoundManager_PlayMusic(static_cast<ResourceID>(ini_get_setting(INI_WORLD) / 6 + SNOW_MSC), true);
@@ -2263,6 +2288,8 @@ void GameManager_GameLoopCleanup() {
     delete[] ResourceManager_CargoMap;
     ResourceManager_CargoMap = nullptr;
 
+    Survey_FreeResourceTables();
+
     delete GameManager_TurnTimerImageNormal;
     GameManager_TurnTimerImageNormal = nullptr;
 
@@ -2734,7 +2761,7 @@ void GameManager_UpdateGui(uint16_t team, int32_t game_state, bool enable_autosa
             sprintf(file_name, "save10.%s", SaveLoadMenu_SaveFileTypes[game_file_type]);
             sprintf(log_message, _(263f), GameManager_TurnCounter);
 
-            SaveLoadMenu_Save(file_name, log_message, false, true);
+            SaveLoadMenu_Save(file_name, log_message, false, true, true);
         }
 
         if (GameManager_ActiveTurnTeam == GameManager_PlayerTeam) {
@@ -3204,7 +3231,7 @@ void GameManager_InitUnitsAndGameState() {
     if (Remote_IsNetworkGame) {
         dos_srand(time(nullptr));
     } else {
-        Remote_RngSeed = time(nullptr);
+        Remote_RngSeed = Headless_IsEnabled() ? Headless_GetRngSeed() : time(nullptr);
         dos_srand(Remote_RngSeed);
     }
 
@@ -3495,6 +3522,25 @@ void GameManager_UpdateHumanPlayerCount() {
     }
 }
 
+void GameManager_PrewarmSfx() {
+    SmartList<UnitInfo>* const unit_lists[] = {&UnitsManager_MobileLandSeaUnits, &UnitsManager_MobileAirUnits,
+                                               &UnitsManager_StationaryUnits};
+    bool is_prewarmed[UNIT_END]{};
+
+    /* units that are built later decode their effects on first use */
+    for (auto units : unit_lists) {
+        for (auto it = units->Begin(), it_end = units->End(); it != it_end; ++it) {
+            const ResourceID unit_type = (*it).GetUnitType();
+
+            if (!is_prewarmed[unit_type]) {
+                is_prewarmed[unit_type] = true;
+
+                SoundManager_PrewarmSfx(unit_type);
+            }
+        }
+    }
+}
+
 void GameManager_MenuAnimateDisplayControls() {
     WindowInfo* top_window;
     WindowInfo* bottom_window;
@@ -4237,8 +4283,9 @@ void GameManager_SaveLoadGame(bool save_load_mode) {
                         Remote_SendNetPacket_16(file_name, save_file_info.save_name.c_str());
                     }
 
-                    SaveLoadMenu_Save(file_name, save_file_info.save_name.c_str(), true);
-                    MessageManager_DrawMessage(_(f640), 1, 0);
+                    if (SaveLoadMenu_Save(file_name, save_file_info.save_name.c_str(), true)) {
+                        MessageManager_DrawMessage(_(f640), 1, 0);
+                    }
 
                 } else {
                     Color* palette_buffer;
@@ -4932,6 +4979,8 @@ void GameManager_PopulateMapWithResources() {
     allocator_gold.ConcentrateResources();
 
     ResourceAllocator::SettleMinimumResourceLevels(ini_get_setting(INI_MIN_RESOURCES));
+
+    Survey_InvalidateResourceTables();
 }
 
 void GameManager_FindSpot(Point* point) {
@@ -5284,6 +5333,8 @@ bool GameManager_ProcessTick(bool render_screen) {
     uint32_t time_stamp;
     bool result;
 
+    Remote_BeginFrame();
+
     if (render_screen) {
         GameManager_UpdateDrawBounds();
     }
@@ -5294,6 +5345,8 @@ bool GameManager_ProcessTick(bool render_screen) {
 
     GameManager_AdvanceFlic();
 
+    SaveLoad_ReportSaveStatus();
+
     time_stamp = timer_get();
 
     for (int32_t i = sizeof(GameManager_ColorCycleTable) / sizeof(struct ColorCycleData) - 1; i >= 0; --i) {
@@ -5309,7 +5362,8 @@ bool GameManager_ProcessTick(bool render_screen) {
 
     time_stamp = timer_get();
 
-    if (!TickTimer_HaveTimeToThink(TIMER_FPS_TO_MS(24))) {
+    /* headless games do not wait for the next frame, every tick advances the simulation */
+    if (Headless_IsEnabled() || !TickTimer_HaveTimeToThink(TIMER_FPS_TO_MS(24))) {
         if (GameManager_IsCheater && GameManager_PlayMode != PLAY_MODE_UNKNOWN) {
             GameManager_PunishCheater();
         }
@@ -5325,7 +5379,9 @@ bool GameManager_ProcessTick(bool render_screen) {
             UnitsManager_ProcessOrders();
         }
 
-        GameManager_RenderMap();
+        if (!Headless_IsEnabled()) {
+            GameManager_RenderMap();
+        }
 
         if (GameManager_GameState != GAME_STATE_11 && !UnitsManager_OrdersPending) {
             TickTimer_UpdateTimeLimit();
@@ -5355,6 +5411,10 @@ bool GameManager_ProcessTick(bool render_screen) {
         result = false;
     }
 
+    Remote_EndFrame();
+
+    Svga_Present();
+
     return result;
 }
 
@@ -21,7 +21,9 @@
 
 #include "gfx.hpp"
 
+#include "maptilecache.hpp"
 #include "resource_manager.hpp"
+#include "spritecache.hpp"
 #include "window_manager.hpp"
 
 struct RowMeta {
@@ -36,6 +38,13 @@ struct SpriteMeta {
     struct RowMeta* row_data;
 };
 
+static void Gfx_ScaleMapTile(uint8_t* target, const int32_t target_pitch, const uint8_t* const tile_buffer,
+                             const uint32_t offset_x, const uint32_t offset_y, const uint32_t width,
+                             const uint32_t height, const uint32_t map_tile_zoom_factor, const uint8_t quotient,
+                             const ColorIndex* const color_table);
+static void Gfx_RecordSpan(uint32_t offset, uint32_t length);
+static const SpriteCacheEntry* Gfx_GetCachedSprite(const void* frame, bool is_shadow);
+static void Gfx_BlitCachedSprite(const SpriteCacheEntry* entry, const ColorIndex* shadow_table);
 static void Gfx_RescaleSpriteRow(uint8_t* row_data, struct RowMeta* meta, uint8_t* frame_buffer, int32_t mode,
                                  int32_t factor);
 
@@ -57,6 +66,17 @@ uint32_t Gfx_ScalingFactorWidth;
 uint32_t Gfx_ScalingFactorHeight;
 int32_t Gfx_TargetScreenBufferOffset;
 
+static MapTileCache Gfx_MapTileCache;
+static SpriteCache Gfx_SpriteCache;
+static uint16_t Gfx_SpriteWidth;
+static uint16_t Gfx_SpriteHeight;
+static bool Gfx_IsRecordingSpans;
+static SpriteSpan* Gfx_RecordedSpans;
+static uint32_t Gfx_RecordedSpanCount;
+static uint32_t Gfx_RecordedSpanCapacity;
+static uint8_t* Gfx_SpriteBuffer;
+static uint32_t Gfx_SpriteBufferSize;
+
 const Rect Gfx_DirectionCorrections[8] = {
     {1, 0, 0, 1},   {0, -1, -1, 0}, {0, 1, -1, 0}, {1, 0, 0, -1},
     {-1, 0, 0, -1}, {0, 1, 1, 0},   {0, -1, 1, 0}, {-1, 0, 0, 1},
@@ -106,6 +126,8 @@ bool Gfx_DecodeSpriteSetup(Point point, uint8_t* buffer, int32_t divisor, Rect*
             Gfx_ScaledHeight = 2;
         }
 
+        Gfx_SpriteWidth = Gfx_ScaledWidth;
+        Gfx_SpriteHeight = Gfx_ScaledHeight;
         Gfx_ScalingFactorWidth = (((width - 1) << GFX_SCALE_BASE) / (Gfx_ScaledWidth - 1)) + 8;
         Gfx_ScalingFactorHeight = (((height - 1) << GFX_SCALE_BASE) / (Gfx_ScaledHeight - 1)) + 8;
         Gfx_ScaledOffset.x = target_bounds.ulx - scaled_bounds.ulx;
@@ -121,6 +143,26 @@ bool Gfx_DecodeSpriteSetup(Point point, uint8_t* buffer, int32_t divisor, Rect*
     return result;
 }
 
+void Gfx_ScaleMapTile(uint8_t* target, const int32_t target_pitch, const uint8_t* const tile_buffer,
+                      const uint32_t offset_x, const uint32_t offset_y, const uint32_t width, const uint32_t height,
+                      const uint32_t map_tile_zoom_factor, const uint8_t quotient,
+                      const ColorIndex* const color_table) {
+    for (uint32_t j{0}; j < height; ++j) {
+        const uint8_t* const map_tile_buffer =
+            &tile_buffer[(((offset_y + j) * map_tile_zoom_factor) >> GFX_SCALE_BASE) << (quotient >> 1)];
+
+        for (uint32_t i{0}; i < width; ++i) {
+            target[i] = color_table[map_tile_buffer[((offset_x + i) * map_tile_zoom_factor) >> GFX_SCALE_BASE]];
+        }
+
+        target = &target[target_pitch];
+    }
+}
+
+void Gfx_ResetMapTileCache() { Gfx_MapTileCache.Clear(); }
+
+void Gfx_ResetSpriteCache() { Gfx_SpriteCache.Clear(); }
+
 void Gfx_DecodeMapTile(const Rect* const pixel_bounds, const uint32_t tile_size, const uint32_t tile_base,
                        const uint8_t quotient) {
     if (pixel_bounds->lry - 1 > pixel_bounds->uly && pixel_bounds->lrx - 1 > pixel_bounds->ulx) {
@@ -128,6 +170,9 @@ void Gfx_DecodeMapTile(const Rect* const pixel_bounds, const uint32_t tile_size,
 
         const ColorIndex* color_table{&ResourceManager_ColorIndexTable13x8[(Gfx_MapBrightness & (~31)) * 8]};
 
+        const bool is_cached{Gfx_MapTileCache.Configure(ResourceManager_MapTileCount, Gfx_ZoomLevel,
+                                                        Gfx_MapBrightness & (~31), tile_size)};
+
         const Rect clipped_bounds = {.ulx = pixel_bounds->ulx & (~63),
                                      .uly = pixel_bounds->uly & (~63),
                                      .lrx = ((pixel_bounds->lrx - 1) & (~63)) + 63,
@@ -139,12 +184,8 @@ void Gfx_DecodeMapTile(const Rect* const pixel_bounds, const uint32_t tile_size,
 
         const int32_t scaling_error_ulx = Gfx_ScaleInt32(pixel_bounds->ulx) - Gfx_ScaleInt32(clipped_bounds.ulx);
 
-        const int32_t scaling_error_ulx_factor = scaling_error_ulx * map_tile_zoom_factor;
-
         const int32_t scaling_error_uly = Gfx_ScaleInt32(pixel_bounds->uly) - Gfx_ScaleInt32(clipped_bounds.uly);
 
-        const int32_t scaling_error_uly_factor = scaling_error_uly * map_tile_zoom_factor;
-
         const int32_t scaling_error_lrx = Gfx_ScaleInt32(clipped_bounds.lrx) - Gfx_ScaleInt32(pixel_bounds->lrx - 1);
 
         const int32_t scaling_error_lry = Gfx_ScaleInt32(clipped_bounds.lry) - Gfx_ScaleInt32(pixel_bounds->lry - 1);
@@ -154,12 +195,12 @@ void Gfx_DecodeMapTile(const Rect* const pixel_bounds, const uint32_t tile_size,
 
         for (int32_t y{tile_count_y}; y > 0; --y) {
             uint32_t tile_stride_y{Gfx_ZoomLevel};
-            int32_t offset_y{0};
+            uint32_t offset_y{0};
             uint8_t* map_address_y{map_buffer};
 
             if (y == tile_count_y) {
                 tile_stride_y -= scaling_error_uly;
-                offset_y = scaling_error_uly_factor;
+                offset_y = scaling_error_uly;
             }
 
             if (y == 1) {
@@ -169,36 +210,49 @@ void Gfx_DecodeMapTile(const Rect* const pixel_bounds, const uint32_t tile_size,
             map_buffer = &map_buffer[WindowManager_WindowWidth * tile_stride_y];
 
             for (int32_t x{tile_count_x}; x > 0; --x) {
-                uint8_t* const tile_buffer{
-                    &ResourceManager_MapTileBuffer[ResourceManager_MapTileIds[tile_base + tile_position] << quotient]};
-                uint8_t* map_tile_buffer = &tile_buffer[(offset_y >> GFX_SCALE_BASE) << (quotient >> 1)];
+                const uint16_t tile_id{ResourceManager_MapTileIds[tile_base + tile_position]};
+                const uint8_t* const tile_buffer{&ResourceManager_MapTileBuffer[tile_id << quotient]};
 
                 uint32_t tile_stride_x{Gfx_ZoomLevel};
-                int32_t offset_x{0};
-                uint8_t* map_address_x{map_address_y};
+                uint32_t offset_x{0};
 
                 if (x == tile_count_x) {
                     tile_stride_x -= scaling_error_ulx;
-                    offset_x = scaling_error_ulx_factor;
+                    offset_x = scaling_error_ulx;
                 }
 
                 if (x == 1) {
                     tile_stride_x -= scaling_error_lrx;
                 }
 
-                map_address_y = &map_address_y[tile_stride_x];
+                if (is_cached) {
+                    /* the whole tile is resampled once, redraws copy the visible rows of the cached tile */
+                    uint8_t* scaled_tile{Gfx_MapTileCache.Find(tile_id)};
+
+                    if (!scaled_tile) {
+                        scaled_tile = Gfx_MapTileCache.Insert(tile_id);
+
+                        Gfx_ScaleMapTile(scaled_tile, Gfx_ZoomLevel, tile_buffer, 0, 0, Gfx_ZoomLevel, Gfx_ZoomLevel,
+                                         map_tile_zoom_factor, quotient, color_table);
+                    }
+
+                    const uint8_t* source{&scaled_tile[Gfx_ZoomLevel * offset_y + offset_x]};
+                    uint8_t* target{map_address_y};
+
+                    for (uint32_t j{0}; j < tile_stride_y; ++j) {
+                        memcpy(target, source, tile_stride_x);
 
-                for (uint32_t j{0}; j < tile_stride_y; ++j) {
-                    for (uint32_t i{0}; i < tile_stride_x; ++i) {
-                        map_address_x[i] =
-                            color_table[map_tile_buffer[(offset_x + i * map_tile_zoom_factor) >> GFX_SCALE_BASE]];
+                        source = &source[Gfx_ZoomLevel];
+                        target = &target[WindowManager_WindowWidth];
                     }
 
-                    map_address_x = &map_address_x[WindowManager_WindowWidth];
-                    map_tile_buffer = &tile_buffer[((offset_y + (j + 1) * map_tile_zoom_factor) >> GFX_SCALE_BASE)
-                                                   << (quotient >> 1)];
+                } else {
+                    Gfx_ScaleMapTile(map_address_y, WindowManager_WindowWidth, tile_buffer, offset_x, offset_y,
+                                     tile_stride_x, tile_stride_y, map_tile_zoom_factor, quotient, color_table);
                 }
 
+                map_address_y = &map_address_y[tile_stride_x];
+
                 ++tile_position;
             }
 
@@ -316,6 +370,10 @@ void Gfx_DecodeSprite() {
                     uint8_t* address;
                     address = &Gfx_MapWindowBuffer[offset];
 
+                    if (Gfx_IsRecordingSpans && temp > 0) {
+                        Gfx_RecordSpan(offset, temp);
+                    }
+
                     if (Gfx_TeamColorIndexBase) {
                         memset(address,
                                reinterpret_cast<uint8_t*>(
@@ -424,6 +482,10 @@ void Gfx_DecodeShadow() {
                 ColorIndex* index_table = &ResourceManager_ColorIndexTable13x8[5 * PALETTE_SIZE];
                 uint8_t* window_buffer = &Gfx_MapWindowBuffer[offset];
 
+                if (Gfx_IsRecordingSpans && rescaled_pixel_count > 0) {
+                    Gfx_RecordSpan(offset, rescaled_pixel_count);
+                }
+
                 for (int32_t i = 0; i < rescaled_pixel_count; ++i) {
                     window_buffer[i] = index_table[window_buffer[i]];
                 }
@@ -437,6 +499,168 @@ void Gfx_DecodeShadow() {
     }
 }
 
+void Gfx_RecordSpan(uint32_t offset, uint32_t length) {
+    if (Gfx_RecordedSpanCount > 0) {
+        SpriteSpan& span = Gfx_RecordedSpans[Gfx_RecordedSpanCount - 1];
+
+        /* adjacent runs of the same row are blitted as one span */
+        if (span.offset + span.length == offset && offset % Gfx_SpriteWidth) {
+            span.length += length;
+
+            return;
+        }
+    }
+
+    if (Gfx_RecordedSpanCount == Gfx_RecordedSpanCapacity) {
+        const uint32_t capacity = std::max(Gfx_RecordedSpanCapacity * 2, 256u);
+        SpriteSpan* spans = new (std::nothrow) SpriteSpan[capacity];
+
+        if (!spans) {
+            Gfx_IsRecordingSpans = false;
+
+            return;
+        }
+
+        if (Gfx_RecordedSpanCount) {
+            memcpy(spans, Gfx_RecordedSpans, Gfx_RecordedSpanCount * sizeof(SpriteSpan));
+        }
+
+        delete[] Gfx_RecordedSpans;
+
+        Gfx_RecordedSpans = spans;
+        Gfx_RecordedSpanCapacity = capacity;
+    }
+
+    Gfx_RecordedSpans[Gfx_RecordedSpanCount++] = {offset, length};
+}
+
+const SpriteCacheEntry* Gfx_GetCachedSprite(const void* frame, bool is_shadow) {
+    const SpriteCacheKey key = {.frame = frame,
+                                .color_indices = is_shadow ? nullptr : Gfx_ColorIndices,
+                                .width = Gfx_SpriteWidth,
+                                .height = Gfx_SpriteHeight,
+                                .brightness = static_cast<uint8_t>(is_shadow ? 0 : (Gfx_UnitBrightnessBase & (~31))),
+                                .team_color = static_cast<uint8_t>(is_shadow ? 0 : Gfx_TeamColorIndexBase)};
+
+    const SpriteCacheEntry* entry = Gfx_SpriteCache.Find(key);
+
+    if (entry) {
+        return entry;
+    }
+
+    const uint32_t buffer_size = Gfx_SpriteWidth * Gfx_SpriteHeight;
+
+    if (buffer_size > Gfx_SpriteBufferSize) {
+        delete[] Gfx_SpriteBuffer;
+
+        Gfx_SpriteBuffer = new (std::nothrow) uint8_t[buffer_size];
+        Gfx_SpriteBufferSize = Gfx_SpriteBuffer ? buffer_size : 0;
+
+        if (!Gfx_SpriteBuffer) {
+            return nullptr;
+        }
+    }
+
+    /* the whole frame is decoded once into a private buffer, visible parts are cut out of the recorded spans */
+    uint8_t* const map_window_buffer = Gfx_MapWindowBuffer;
+    const int32_t window_width = WindowManager_WindowWidth;
+    const int32_t target_screen_buffer_offset = Gfx_TargetScreenBufferOffset;
+    const Point scaled_offset = Gfx_ScaledOffset;
+    const uint16_t scaled_width = Gfx_ScaledWidth;
+    const uint16_t scaled_height = Gfx_ScaledHeight;
+
+    Gfx_MapWindowBuffer = Gfx_SpriteBuffer;
+    WindowManager_WindowWidth = Gfx_SpriteWidth;
+    Gfx_TargetScreenBufferOffset = 0;
+    Gfx_ScaledOffset = Point(0, 0);
+    Gfx_ScaledWidth = Gfx_SpriteWidth;
+    Gfx_ScaledHeight = Gfx_SpriteHeight;
+
+    Gfx_RecordedSpanCount = 0;
+    Gfx_IsRecordingSpans = true;
+
+    if (is_shadow) {
+        Gfx_DecodeShadow();
+
+    } else {
+        Gfx_DecodeSprite();
+    }
+
+    const bool is_recorded = Gfx_IsRecordingSpans;
+
+    Gfx_IsRecordingSpans = false;
+
+    Gfx_MapWindowBuffer = map_window_buffer;
+    WindowManager_WindowWidth = window_width;
+    Gfx_TargetScreenBufferOffset = target_screen_buffer_offset;
+    Gfx_ScaledOffset = scaled_offset;
+    Gfx_ScaledWidth = scaled_width;
+    Gfx_ScaledHeight = scaled_height;
+
+    if (!is_recorded) {
+        return nullptr;
+    }
+
+    return Gfx_SpriteCache.Insert(key, is_shadow ? nullptr : Gfx_SpriteBuffer, Gfx_RecordedSpans,
+                                  Gfx_RecordedSpanCount);
+}
+
+void Gfx_BlitCachedSprite(const SpriteCacheEntry* entry, const ColorIndex* shadow_table) {
+    const int32_t width = entry->key.width;
+    const int32_t ulx = Gfx_ScaledOffset.x;
+    const int32_t lrx = Gfx_ScaledOffset.x + Gfx_ScaledWidth;
+
+    for (int32_t row = Gfx_ScaledOffset.y; row < Gfx_ScaledOffset.y + Gfx_ScaledHeight; ++row) {
+        const int32_t row_offset = Gfx_TargetScreenBufferOffset - ulx;
+
+        for (uint32_t i = entry->row_spans[row]; i < entry->row_spans[row + 1]; ++i) {
+            const SpriteSpan& span = entry->spans[i];
+            const int32_t span_ulx = span.offset - row * width;
+            const int32_t start = std::max(span_ulx, ulx);
+            const int32_t end = std::min(span_ulx + static_cast<int32_t>(span.length), lrx);
+
+            if (start < end) {
+                uint8_t* const address = &Gfx_MapWindowBuffer[row_offset + start];
+
+                if (shadow_table) {
+                    for (int32_t j = 0; j < end - start; ++j) {
+                        address[j] = shadow_table[address[j]];
+                    }
+
+                } else {
+                    memcpy(address, &entry->pixels[row * width + start], end - start);
+                }
+            }
+        }
+
+        Gfx_TargetScreenBufferOffset += WindowManager_WindowWidth;
+    }
+
+    Gfx_ScaledHeight = 0;
+}
+
+void Gfx_DecodeCachedSprite(const void* frame) {
+    const SpriteCacheEntry* entry = Gfx_GetCachedSprite(frame, false);
+
+    if (entry) {
+        Gfx_BlitCachedSprite(entry, nullptr);
+
+    } else {
+        Gfx_DecodeSprite();
+    }
+}
+
+void Gfx_DecodeCachedShadow(const void* frame) {
+    const SpriteCacheEntry* entry = Gfx_GetCachedSprite(frame, true);
+
+    if (entry) {
+        Gfx_BlitCachedSprite(entry, &ResourceManager_ColorIndexTable13x8[5 * PALETTE_SIZE]);
+
+    } else {
+        Gfx_DecodeShadow();
+    }
+}
+
 uint8_t* Gfx_RescaleSprite(uint8_t* buffer, uint32_t* data_size, int32_t mode, int32_t scaling_factor) {
     uint16_t image_count;
     uint8_t* image_frame;
@@ -36,8 +36,12 @@
 bool Gfx_DecodeSpriteSetup(Point point, uint8_t* buffer, int32_t divisor, Rect* bounds);
 void Gfx_DecodeMapTile(const Rect* const pixel_bounds, const uint32_t tile_size, const uint32_t tile_base,
                        const uint8_t quotient);
+void Gfx_ResetMapTileCache();
 void Gfx_DecodeSprite();
 void Gfx_DecodeShadow();
+void Gfx_ResetSpriteCache();
+void Gfx_DecodeCachedSprite(const void* frame);
+void Gfx_DecodeCachedShadow(const void* frame);
 void Gfx_RenderCircle(uint8_t* buffer, int32_t full_width, int32_t width, int32_t height, int32_t xc, int32_t yc,
                       int32_t radius, int32_t color);
 uint8_t* Gfx_RescaleSprite(uint8_t* buffer, uint32_t* data_size, int32_t mode, int32_t scaling_factor);
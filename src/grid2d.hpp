@@ -0,0 +1,139 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef GRID2D_HPP
+#define GRID2D_HPP
+
+#include <SDL_assert.h>
+
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+enum Grid2DLayout : uint8_t {
+    GRID2D_COLUMN_MAJOR,
+    GRID2D_ROW_MAJOR,
+};
+
+/// Two dimensional grid of trivially copyable elements kept in a single aligned allocation. A table of line pointers
+/// into the storage is maintained so that grid[major][minor] and legacy T** interfaces keep working. Column major
+/// grids are indexed as grid[x][y] which matches the layout of all per tile maps of the game.
+template <class T, Grid2DLayout Layout = GRID2D_COLUMN_MAJOR>
+class Grid2D {
+    static_assert(std::is_trivially_copyable<T>::value, "T required to be a trivially copyable type.");
+    static constexpr size_t ALIGNMENT = 64;
+
+    T* data{nullptr};
+    T** lines{nullptr};
+    int32_t width{0};
+    int32_t height{0};
+
+    [[nodiscard]] inline int32_t GetLineCount() const noexcept {
+        return (Layout == GRID2D_COLUMN_MAJOR) ? width : height;
+    }
+    [[nodiscard]] inline int32_t GetLineLength() const noexcept {
+        return (Layout == GRID2D_COLUMN_MAJOR) ? height : width;
+    }
+
+public:
+    Grid2D() noexcept = default;
+    Grid2D(const int32_t width, const int32_t height) noexcept { Init(width, height); }
+    Grid2D(const Grid2D<T, Layout>& other) = delete;
+    Grid2D<T, Layout>& operator=(const Grid2D<T, Layout>& other) = delete;
+    ~Grid2D() noexcept { Deinit(); }
+
+    /// (Re)allocates the storage if the dimensions changed. The content is undefined afterwards.
+    inline bool Init(const int32_t width_, const int32_t height_) noexcept {
+        if (data && width == width_ && height == height_) {
+            return true;
+        }
+
+        Deinit();
+
+        if (width_ > 0 && height_ > 0) {
+            data = static_cast<T*>(::operator new[](static_cast<size_t>(width_) * height_ * sizeof(T),
+                                                    std::align_val_t{ALIGNMENT}, std::nothrow));
+            width = width_;
+            height = height_;
+            lines = new (std::nothrow) T*[GetLineCount()];
+
+            if (data && lines) {
+                for (int32_t i = 0; i < GetLineCount(); ++i) {
+                    lines[i] = &data[i * GetLineLength()];
+                }
+
+            } else {
+                Deinit();
+            }
+        }
+
+        return data != nullptr;
+    }
+    inline void Deinit() noexcept {
+        if (data) {
+            ::operator delete[](data, std::align_val_t{ALIGNMENT});
+            data = nullptr;
+        }
+
+        delete[] lines;
+        lines = nullptr;
+
+        width = 0;
+        height = 0;
+    }
+    [[nodiscard]] inline bool IsInited() const noexcept { return data != nullptr; }
+    [[nodiscard]] inline int32_t GetWidth() const noexcept { return width; }
+    [[nodiscard]] inline int32_t GetHeight() const noexcept { return height; }
+    [[nodiscard]] inline size_t GetSize() const noexcept { return static_cast<size_t>(width) * height; }
+    [[nodiscard]] inline T* GetData() const noexcept { return data; }
+    [[nodiscard]] inline T** GetMap() const noexcept { return lines; }
+    [[nodiscard]] inline T* operator[](const int32_t index) const noexcept {
+        SDL_assert(index >= 0 && index < GetLineCount());
+
+        return lines[index];
+    }
+    [[nodiscard]] inline T& At(const int32_t x, const int32_t y) const noexcept {
+        SDL_assert(x >= 0 && x < width && y >= 0 && y < height);
+
+        return (Layout == GRID2D_COLUMN_MAJOR) ? data[x * height + y] : data[y * width + x];
+    }
+    inline void Clear() noexcept { memset(data, 0, GetSize() * sizeof(T)); }
+    inline void Fill(const T value) noexcept {
+        if constexpr (sizeof(T) == 1) {
+            memset(data, *reinterpret_cast<const uint8_t*>(&value), GetSize());
+
+        } else {
+            const size_t size = GetSize();
+
+            for (size_t i = 0; i < size; ++i) {
+                data[i] = value;
+            }
+        }
+    }
+    inline void Copy(const Grid2D<T, Layout>& other) noexcept {
+        SDL_assert(width == other.width && height == other.height);
+
+        memcpy(data, other.data, GetSize() * sizeof(T));
+    }
+};
+
+#endif /* GRID2D_HPP */
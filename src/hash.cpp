@@ -21,6 +21,8 @@
 
 #include "hash.hpp"
 
+#include <algorithm>
+
 #include "resource_manager.hpp"
 
 #define HASH_HASH_SIZE 512
@@ -71,12 +73,16 @@ void SmartList_UnitInfo_Clear(SmartList<UnitInfo>& list) {
     list.Clear();
 }
 
-class MapHashObject : public SmartObject {
+class MapHashObject {
     SmartList<UnitInfo> list;
     uint16_t x;
     uint16_t y;
 
 public:
+    /// Creation order of the tile. Save files list the tiles of a hash bucket newest first like the original hash
+    /// table did, so the tiles are sorted by it on save.
+    uint32_t sequence{0};
+
     MapHashObject(uint16_t grid_x, uint16_t grid_y);
     ~MapHashObject();
 
@@ -119,37 +125,46 @@ void MapHashObject::PushBack(UnitInfo* unit) { list.PushBack(*unit); }
 
 void MapHashObject::Remove(UnitInfo* unit) { list.Remove(*unit); }
 
-MapHash::MapHash(uint16_t hash_size)
-    : hash_size(hash_size), x_shift(0), entry(new(std::nothrow) SmartList<MapHashObject>[hash_size]) {
+MapHash::MapHash(uint16_t hash_size) : hash_size(hash_size), x_shift(0) {
     while (hash_size > 128) {
         ++x_shift;
         hash_size >>= 1;
     }
 }
 
-MapHash::~MapHash() { delete[] entry; }
+MapHash::~MapHash() { Clear(); }
 
-void MapHash::AddEx(UnitInfo* unit, uint16_t grid_x, uint16_t grid_y, bool mode) {
-    SmartList<MapHashObject>* list = &entry[(grid_y ^ (grid_x << x_shift)) % hash_size];
-    SmartList<MapHashObject>::Iterator object = list->Begin();
+bool MapHash::InitTiles() {
+    if (tiles.GetWidth() != ResourceManager_MapSize.x || tiles.GetHeight() != ResourceManager_MapSize.y) {
+        // the index only changes dimensions between games while it is empty
+        Clear();
 
-    while (object != list->End()) {
-        if (grid_x == (*object).GetX() && grid_y == (*object).GetY()) {
-            break;
+        if (tiles.Init(ResourceManager_MapSize.x, ResourceManager_MapSize.y)) {
+            tiles.Clear();
         }
+    }
+
+    return tiles.IsInited();
+}
+
+void MapHash::AddEx(UnitInfo* unit, uint16_t grid_x, uint16_t grid_y, bool mode) {
+    if (!InitTiles() || grid_x >= tiles.GetWidth() || grid_y >= tiles.GetHeight()) {
+        SDL_assert(0);
 
-        ++object;
+        return;
     }
 
-    if (object == list->End()) {
-        list->PushFront(*new (std::nothrow) MapHashObject(grid_x, grid_y));
-        object = list->Begin();
+    MapHashObject*& object = tiles[grid_x][grid_y];
+
+    if (!object) {
+        object = new (std::nothrow) MapHashObject(grid_x, grid_y);
+        object->sequence = next_sequence++;
     }
 
     if (!mode || unit->GetUnitType() == LRGTAPE || unit->GetUnitType() == SMLTAPE) {
-        (*object).PushFront(unit);
+        object->PushFront(unit);
     } else {
-        (*object).PushBack(unit);
+        object->PushBack(unit);
     }
 }
 
@@ -172,22 +187,19 @@ void MapHash::Add(UnitInfo* unit, bool mode) {
 }
 
 void MapHash::RemoveEx(UnitInfo* unit, uint16_t grid_x, uint16_t grid_y) {
-    SmartList<MapHashObject>* list = &entry[(grid_y ^ (grid_x << x_shift)) % hash_size];
-    SmartList<MapHashObject>::Iterator object = list->Begin();
-
-    while (object != list->End()) {
-        if (grid_x == (*object).GetX() && grid_y == (*object).GetY()) {
-            break;
-        }
-
-        ++object;
+    if (!tiles.IsInited() || grid_x >= tiles.GetWidth() || grid_y >= tiles.GetHeight()) {
+        return;
     }
 
-    if (object != list->End()) {
-        (*object).Remove(unit);
+    MapHashObject*& object = tiles[grid_x][grid_y];
+
+    if (object) {
+        object->Remove(unit);
 
-        if (!(*object).GetList().GetCount()) {
-            list->Remove(object);
+        if (!object->GetList().GetCount()) {
+            // iterators of callers that walk the tile keep the list nodes alive
+            delete object;
+            object = nullptr;
         }
     }
 }
@@ -211,26 +223,47 @@ void MapHash::Remove(UnitInfo* unit) {
 }
 
 void MapHash::Clear() {
-    for (int32_t index = 0; index < hash_size; ++index) {
-        entry[index].Clear();
+    if (tiles.IsInited()) {
+        MapHashObject** objects = tiles.GetData();
+        const size_t size = tiles.GetSize();
+
+        for (size_t index = 0; index < size; ++index) {
+            delete objects[index];
+            objects[index] = nullptr;
+        }
     }
 }
 
 void MapHash::FileLoad(SmartFileReader& file) {
+    InitTiles();
     Clear();
-    delete[] entry;
 
     file.Read(hash_size);
     file.Read(x_shift);
 
-    entry = new (std::nothrow) SmartList<MapHashObject>[hash_size];
+    next_sequence = 0;
 
     for (int32_t index = 0; index < hash_size; ++index) {
-        for (int32_t count = file.ReadObjectCount(); count; --count) {
+        const int32_t object_count = file.ReadObjectCount();
+
+        // the first tile of a bucket is the newest one
+        next_sequence += object_count;
+
+        for (int32_t count = object_count; count; --count) {
             MapHashObject* object = new (std::nothrow) MapHashObject(0, 0);
 
             object->FileLoad(file);
-            entry[index].PushBack(*object);
+            object->sequence = next_sequence - (object_count - count) - 1;
+
+            if (tiles.IsInited() && object->GetX() < tiles.GetWidth() && object->GetY() < tiles.GetHeight() &&
+                !tiles[object->GetX()][object->GetY()]) {
+                tiles[object->GetX()][object->GetY()] = object;
+
+            } else {
+                SDL_assert(0);
+
+                delete object;
+            }
         }
     }
 }
@@ -239,26 +272,67 @@ void MapHash::FileSave(SmartFileWriter& file) {
     file.Write(hash_size);
     file.Write(x_shift);
 
-    for (int32_t index = 0; index < hash_size; ++index) {
-        uint16_t count = entry[index].GetCount();
+    // objects are written grouped by the hash bucket they belonged to in the original hash table layout
+    const int32_t tile_count = tiles.IsInited() ? tiles.GetSize() : 0;
+    int32_t* counts = new (std::nothrow) int32_t[hash_size + 1];
+    MapHashObject** objects = new (std::nothrow) MapHashObject*[tile_count + 1];
+
+    if (!counts || !objects) {
+        ResourceManager_ExitGame(EXIT_CODE_INSUFFICIENT_MEMORY);
+    }
+
+    memset(counts, 0, (hash_size + 1) * sizeof(int32_t));
+
+    for (int32_t index = 0; index < tile_count; ++index) {
+        MapHashObject* object = tiles.GetData()[index];
+
+        if (object) {
+            ++counts[(object->GetY() ^ (object->GetX() << x_shift)) % hash_size];
+        }
+    }
+
+    for (int32_t index = 0, offset = 0; index < hash_size; ++index) {
+        const int32_t count = counts[index];
+
+        counts[index] = offset;
+        offset += count;
+    }
+
+    for (int32_t index = 0; index < tile_count; ++index) {
+        MapHashObject* object = tiles.GetData()[index];
+
+        if (object) {
+            objects[counts[(object->GetY() ^ (object->GetX() << x_shift)) % hash_size]++] = object;
+        }
+    }
+
+    for (int32_t index = 0, offset = 0; index < hash_size; ++index) {
+        uint16_t count = counts[index] - offset;
         file.Write(count);
 
-        for (SmartList<MapHashObject>::Iterator object = entry[index].Begin(); object != entry[index].End(); ++object) {
-            (*object).FileSave(file);
+        // the original hash table inserted new tiles at the front of their bucket
+        std::sort(&objects[offset], &objects[counts[index]],
+                  [](const MapHashObject* lhs, const MapHashObject* rhs) { return lhs->sequence > rhs->sequence; });
+
+        for (; offset < counts[index]; ++offset) {
+            objects[offset]->FileSave(file);
         }
     }
+
+    delete[] objects;
+    delete[] counts;
 }
 
 SmartList<UnitInfo>* MapHash::operator[](const Point& key) {
     SDL_assert(key.x >= 0 && key.y >= 0);
 
     SmartList<UnitInfo>* result{nullptr};
-    SmartList<MapHashObject>& list = entry[(key.y ^ (key.x << x_shift)) % hash_size];
 
-    for (auto& object : list) {
-        if (key.x == object.GetX() && key.y == object.GetY()) {
-            result = &object.GetList();
-            break;
+    if (tiles.IsInited() && key.x < tiles.GetWidth() && key.y < tiles.GetHeight()) {
+        MapHashObject* object = tiles.At(key.x, key.y);
+
+        if (object) {
+            result = &object->GetList();
         }
     }
 
@@ -22,15 +22,20 @@
 #ifndef HASH_HPP
 #define HASH_HPP
 
+#include "grid2d.hpp"
 #include "unitinfo.hpp"
 
 class MapHashObject;
 
+/// Per tile index of the units occupying the map. Tiles are looked up directly in a dense grid sized to the active
+/// map. The hash bucket parameters are only kept to read and write the legacy save file layout.
 class MapHash {
     uint16_t hash_size;
     uint16_t x_shift;
-    SmartList<MapHashObject>* entry;
+    uint32_t next_sequence{0};
+    Grid2D<MapHashObject*> tiles;
 
+    bool InitTiles();
     void AddEx(UnitInfo* unit, uint16_t grid_x, uint16_t grid_y, bool mode);
     void RemoveEx(UnitInfo* unit, uint16_t grid_x, uint16_t grid_y);
 
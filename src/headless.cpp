@@ -0,0 +1,232 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "headless.hpp"
+
+#include <SDL.h>
+
+#include <algorithm>
+#include <fstream>
+
+#include "game_manager.hpp"
+#include "inifile.hpp"
+#include "resource_manager.hpp"
+#include "smartstring.hpp"
+#include "timer.h"
+#include "units_manager.hpp"
+
+#define HEADLESS_DEFAULT_RNG_SEED 1
+#define HEADLESS_DEFAULT_TURN_LIMIT 100
+#define HEADLESS_CHECKSUM_OFFSET_BASIS 2166136261u
+#define HEADLESS_CHECKSUM_PRIME 16777619u
+
+static bool Headless_Enabled;
+static uint32_t Headless_RngSeed{HEADLESS_DEFAULT_RNG_SEED};
+static int32_t Headless_TurnLimit{HEADLESS_DEFAULT_TURN_LIMIT};
+static uint32_t Headless_GameTimeStamp;
+static uint32_t Headless_TurnTimeStamp;
+static HeadlessResult Headless_Result;
+
+static const char* const Headless_TeamNames[PLAYER_TEAM_MAX - 1] = {"red", "green", "blue", "gray"};
+static const char* const Headless_TeamTypes[] = {"none", "player", "computer", "remote", "eliminated"};
+static const char* const Headless_TeamStatus[] = {"generic", "pending", "won", "lost"};
+
+static void Headless_UpdateChecksum(uint32_t& checksum, int32_t value);
+static void Headless_ProcessUnits(SmartList<UnitInfo>& units);
+static bool Headless_WriteSummary();
+
+void Headless_Init(uint32_t rng_seed, int32_t turn_limit) {
+    Headless_Enabled = true;
+    Headless_RngSeed = rng_seed;
+    Headless_TurnLimit = std::max(turn_limit, 1);
+}
+
+bool Headless_ParseArguments(int argc, char* argv[]) {
+    for (int32_t i = 1; i < argc; ++i) {
+        if (!SDL_strcmp(argv[i], "--headless")) {
+            Headless_Enabled = true;
+
+        } else if (!SDL_strcmp(argv[i], "--seed") && (i + 1) < argc) {
+            Headless_RngSeed = SDL_strtoul(argv[++i], nullptr, 10);
+
+        } else if (!SDL_strcmp(argv[i], "--turns") && (i + 1) < argc) {
+            Headless_TurnLimit = std::max(SDL_atoi(argv[++i]), 1);
+        }
+    }
+
+    return Headless_Enabled;
+}
+
+bool Headless_IsEnabled() noexcept { return Headless_Enabled; }
+
+uint32_t Headless_GetRngSeed() noexcept { return Headless_RngSeed; }
+
+void Headless_TakeOverTeams() {
+    for (int32_t team = PLAYER_TEAM_RED; team < PLAYER_TEAM_MAX - 1; ++team) {
+        /* computer players of teams that were not saved as such start from scratch with the units on the map */
+        if (UnitsManager_TeamInfo[team].team_type == TEAM_TYPE_PLAYER ||
+            UnitsManager_TeamInfo[team].team_type == TEAM_TYPE_REMOTE) {
+            UnitsManager_TeamInfo[team].team_type = TEAM_TYPE_COMPUTER;
+            ini_set_setting(static_cast<IniParameter>(INI_RED_TEAM_PLAYER + team), TEAM_TYPE_COMPUTER);
+        }
+    }
+}
+
+void Headless_BeginGame() {
+    ini_set_setting(INI_DISABLE_MUSIC, true);
+    ini_set_setting(INI_DISABLE_FX, true);
+    ini_set_setting(INI_DISABLE_VOICE, true);
+    ini_set_setting(INI_AUTO_SAVE, false);
+
+    Headless_Result = HeadlessResult();
+
+    Headless_GameTimeStamp = timer_get();
+    Headless_TurnTimeStamp = Headless_GameTimeStamp;
+}
+
+bool Headless_FinishTurn() {
+    const uint32_t turn_time = timer_elapsed_time(Headless_TurnTimeStamp);
+
+    Headless_TurnTimeStamp = timer_get();
+
+    ++Headless_Result.turns_played;
+    Headless_Result.max_turn_time = std::max(Headless_Result.max_turn_time, turn_time);
+
+    return Headless_Result.turns_played >= Headless_TurnLimit;
+}
+
+void Headless_UpdateChecksum(uint32_t& checksum, int32_t value) {
+    for (int32_t i = 0; i < static_cast<int32_t>(sizeof(value)); ++i) {
+        checksum = (checksum ^ ((value >> (i * 8)) & 0xFF)) * HEADLESS_CHECKSUM_PRIME;
+    }
+}
+
+void Headless_ProcessUnits(SmartList<UnitInfo>& units) {
+    for (auto it = units.Begin(), it_end = units.End(); it != it_end; ++it) {
+        if ((*it).team < PLAYER_TEAM_MAX - 1) {
+            ++Headless_Result.teams[(*it).team].units_alive;
+        }
+
+        Headless_UpdateChecksum(Headless_Result.checksum, (*it).GetUnitType());
+        Headless_UpdateChecksum(Headless_Result.checksum, (*it).team);
+        Headless_UpdateChecksum(Headless_Result.checksum, (*it).grid_x);
+        Headless_UpdateChecksum(Headless_Result.checksum, (*it).grid_y);
+        Headless_UpdateChecksum(Headless_Result.checksum, (*it).hits);
+        Headless_UpdateChecksum(Headless_Result.checksum, (*it).ammo);
+        Headless_UpdateChecksum(Headless_Result.checksum, (*it).storage);
+        Headless_UpdateChecksum(Headless_Result.checksum, (*it).GetOrder());
+    }
+}
+
+void Headless_RecordResult(const WinLoss_Status& status, int32_t turn_counter) {
+    Headless_Result.is_complete = true;
+    Headless_Result.turn_counter = turn_counter;
+    Headless_Result.elapsed_time = timer_elapsed_time(Headless_GameTimeStamp);
+    Headless_Result.checksum = HEADLESS_CHECKSUM_OFFSET_BASIS;
+
+    for (int32_t team = PLAYER_TEAM_RED; team < PLAYER_TEAM_MAX - 1; ++team) {
+        const CTInfo& team_info = UnitsManager_TeamInfo[team];
+        HeadlessTeamResult& result = Headless_Result.teams[team];
+
+        result.team_type = team_info.team_type;
+        result.team_status = status.team_status[team];
+        result.team_rank = status.team_rank[team];
+        result.team_points = team_info.team_points;
+        result.units_alive = 0;
+        result.units_built = team_info.stats_units_built;
+        result.buildings_built = team_info.stats_buildings_built;
+        result.casualties = 0;
+
+        for (const auto casualty : team_info.casualties) {
+            result.casualties += casualty;
+        }
+
+        Headless_UpdateChecksum(Headless_Result.checksum, result.team_type);
+        Headless_UpdateChecksum(Headless_Result.checksum, result.team_points);
+    }
+
+    Headless_ProcessUnits(UnitsManager_MobileLandSeaUnits);
+    Headless_ProcessUnits(UnitsManager_MobileAirUnits);
+    Headless_ProcessUnits(UnitsManager_StationaryUnits);
+    Headless_ProcessUnits(UnitsManager_GroundCoverUnits);
+}
+
+const HeadlessResult& Headless_GetResult() noexcept { return Headless_Result; }
+
+bool Headless_WriteSummary() {
+    auto filepath{(ResourceManager_FilePathGamePref / "headless_summary.txt").lexically_normal()};
+    std::ofstream file(filepath.string().c_str());
+
+    if (!file.is_open()) {
+        SDL_Log("Unable to write headless summary: %s\n", filepath.string().c_str());
+
+        return false;
+    }
+
+    const HeadlessResult& result = Headless_Result;
+
+    file << SmartString().Sprintf(100, "seed=%u\n", Headless_RngSeed).GetCStr();
+    file << SmartString().Sprintf(100, "turn_limit=%i\n", Headless_TurnLimit).GetCStr();
+    file << SmartString().Sprintf(100, "completed=%s\n", result.is_complete ? "true" : "false").GetCStr();
+    file << SmartString().Sprintf(100, "turns_played=%i\n", result.turns_played).GetCStr();
+    file << SmartString().Sprintf(100, "elapsed_ms=%u\n", result.elapsed_time).GetCStr();
+    file << SmartString()
+                .Sprintf(100, "ms_per_turn=%.1f\n",
+                         result.turns_played ? static_cast<double>(result.elapsed_time) / result.turns_played : 0.)
+                .GetCStr();
+    file << SmartString().Sprintf(100, "max_turn_ms=%u\n", result.max_turn_time).GetCStr();
+    file << SmartString().Sprintf(100, "checksum=%08X\n", result.checksum).GetCStr();
+
+    for (int32_t team = PLAYER_TEAM_RED; team < PLAYER_TEAM_MAX - 1; ++team) {
+        const HeadlessTeamResult& team_result = result.teams[team];
+
+        file << SmartString()
+                    .Sprintf(300,
+                             "%s: type=%s status=%s rank=%i points=%u units_alive=%i units_built=%i "
+                             "buildings_built=%i casualties=%i\n",
+                             Headless_TeamNames[team], Headless_TeamTypes[team_result.team_type],
+                             Headless_TeamStatus[team_result.team_status], team_result.team_rank,
+                             team_result.team_points, team_result.units_alive, team_result.units_built,
+                             team_result.buildings_built, team_result.casualties)
+                    .GetCStr();
+    }
+
+    SDL_Log("Headless summary written to %s\n", filepath.string().c_str());
+
+    return true;
+}
+
+int32_t Headless_Run() {
+    for (int32_t team = PLAYER_TEAM_RED; team < PLAYER_TEAM_MAX - 1; ++team) {
+        ini_set_setting(static_cast<IniParameter>(INI_RED_TEAM_PLAYER + team), TEAM_TYPE_COMPUTER);
+    }
+
+    ini_set_setting(INI_GAME_FILE_TYPE, GAME_TYPE_CUSTOM);
+
+    ini_setting_victory_type = ini_get_setting(INI_VICTORY_TYPE);
+    ini_setting_victory_limit = ini_get_setting(INI_VICTORY_LIMIT);
+
+    SDL_Log("Headless game started, seed %u, turn limit %i.\n", Headless_RngSeed, Headless_TurnLimit);
+
+    GameManager_GameLoop(GAME_STATE_6);
+
+    return Headless_WriteSummary() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
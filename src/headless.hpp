@@ -0,0 +1,67 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef HEADLESS_HPP
+#define HEADLESS_HPP
+
+#include <cstdint>
+
+#include "enums.hpp"
+#include "winloss.hpp"
+
+struct HeadlessTeamResult {
+    int32_t team_type;
+    int32_t team_status;
+    int32_t team_rank;
+    uint32_t team_points;
+    int32_t units_alive;
+    int32_t units_built;
+    int32_t buildings_built;
+    int32_t casualties;
+};
+
+struct HeadlessResult {
+    bool is_complete;
+    int32_t turn_counter;
+    int32_t turns_played;
+    uint32_t elapsed_time;
+    uint32_t max_turn_time;
+    uint32_t checksum;
+    HeadlessTeamResult teams[PLAYER_TEAM_MAX - 1];
+};
+
+/// Simulation mode that plays a game between computer players without video output, audio or user input. It is
+/// selected by the --headless command line argument. The game loop advances as fast as the host allows, the random
+/// number generator is seeded with a fixed value (--seed) so that runs are reproducible and the game ends after a
+/// fixed number of turns (--turns). A summary of the final game state is written to headless_summary.txt on exit.
+/// Teams of loaded saved games that are not played by the computer are taken over by it.
+void Headless_Init(uint32_t rng_seed, int32_t turn_limit);
+bool Headless_ParseArguments(int argc, char* argv[]);
+[[nodiscard]] bool Headless_IsEnabled() noexcept;
+[[nodiscard]] uint32_t Headless_GetRngSeed() noexcept;
+void Headless_TakeOverTeams();
+void Headless_BeginGame();
+[[nodiscard]] bool Headless_FinishTurn();
+void Headless_RecordResult(const WinLoss_Status& status, int32_t turn_counter);
+[[nodiscard]] const HeadlessResult& Headless_GetResult() noexcept;
+int32_t Headless_Run();
+
+#endif /* HEADLESS_HPP */
@@ -164,6 +164,14 @@ enum IniParameter {
     INI_NETWORK_HOST_ADDRESS,
     INI_NETWORK_HOST_PORT,
 
+    /// DIAGNOSTICS SETTINGS SECTION
+    INI_DIAGNOSTICS_SETTINGS,
+    INI_AI_PROFILER,
+
+    /// PERFORMANCE SETTINGS SECTION
+    INI_PERFORMANCE_SETTINGS,
+    INI_PATH_WORKERS,
+
     INI_END_DELIMITER
 };
 
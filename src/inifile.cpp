@@ -177,6 +177,12 @@ static const IniKey ini_keys_table[] = {
     {"transport", "udp_default", INI_STRING},
     {"host_address", "127.0.0.1", INI_STRING},
     {"host_port", "31554", INI_NUMERIC},
+
+    {"DIAGNOSTICS_SETTINGS", nullptr, INI_SECTION},
+    {"ai_profiler", "0", INI_NUMERIC},
+
+    {"PERFORMANCE_SETTINGS", nullptr, INI_SECTION},
+    {"path_workers", "0", INI_NUMERIC},
 };
 
 static const int32_t ini_keys_table_size = sizeof(ini_keys_table) / sizeof(struct IniKey);
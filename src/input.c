@@ -108,6 +108,8 @@ void GNW_input_exit(void) {
 void GNW_process_message(void) {
     SDL_Event ev;
 
+    Svga_Present();
+
     while (SDL_PollEvent(&ev)) {
         switch (ev.type) {
             case SDL_KEYUP:
@@ -0,0 +1,103 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef LRULIST_HPP
+#define LRULIST_HPP
+
+#include <SDL_assert.h>
+
+#include <cstdint>
+
+/// Links of a LruList entry. Cache entries derive from it and keep their own storage and lookup structures.
+template <class T>
+struct LruListNode {
+    T* lru_previous{nullptr};
+    T* lru_next{nullptr};
+};
+
+/// Intrusive list of cache entries ordered from the most recently used one to the least recently used one. The list
+/// neither allocates nor owns its entries. A cache moves an entry to the front on every hit and evicts from the back
+/// until it is within its own limits again.
+template <class T>
+class LruList {
+    T* head{nullptr};
+    T* tail{nullptr};
+    int32_t count{0};
+
+public:
+    inline void PushFront(T* entry) noexcept {
+        SDL_assert(entry);
+
+        entry->lru_previous = nullptr;
+        entry->lru_next = head;
+
+        if (head) {
+            head->lru_previous = entry;
+
+        } else {
+            tail = entry;
+        }
+
+        head = entry;
+        ++count;
+    }
+
+    inline void Remove(T* entry) noexcept {
+        SDL_assert(entry && count > 0);
+
+        if (entry->lru_previous) {
+            entry->lru_previous->lru_next = entry->lru_next;
+
+        } else {
+            head = entry->lru_next;
+        }
+
+        if (entry->lru_next) {
+            entry->lru_next->lru_previous = entry->lru_previous;
+
+        } else {
+            tail = entry->lru_previous;
+        }
+
+        entry->lru_previous = nullptr;
+        entry->lru_next = nullptr;
+        --count;
+    }
+
+    inline void MoveToFront(T* entry) noexcept {
+        if (entry != head) {
+            Remove(entry);
+            PushFront(entry);
+        }
+    }
+
+    inline void Clear() noexcept {
+        head = nullptr;
+        tail = nullptr;
+        count = 0;
+    }
+
+    [[nodiscard]] inline T* Front() const noexcept { return head; }
+    [[nodiscard]] inline T* Back() const noexcept { return tail; }
+    [[nodiscard]] inline int32_t GetCount() const noexcept { return count; }
+};
+
+#endif /* LRULIST_HPP */
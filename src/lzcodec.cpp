@@ -0,0 +1,244 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "lzcodec.hpp"
+
+#include <cstring>
+#include <new>
+
+#define LZCODEC_HASH_BITS 14
+#define LZCODEC_MAX_OFFSET 65535
+#define LZCODEC_LAST_LITERALS 5
+#define LZCODEC_MATCH_LIMIT 12
+#define LZCODEC_RUN_MASK 15
+
+static inline uint32_t LzCodec_Load32(const uint8_t* const address) {
+    uint32_t value;
+
+    memcpy(&value, address, sizeof(value));
+
+    return value;
+}
+
+static inline uint32_t LzCodec_Hash(const uint32_t value) {
+    return (value * UINT32_C(2654435761)) >> (32 - LZCODEC_HASH_BITS);
+}
+
+static inline size_t LzCodec_GetLengthSize(const size_t length) {
+    return (length >= LZCODEC_RUN_MASK) ? ((length - LZCODEC_RUN_MASK) / 255 + 1) : 0;
+}
+
+static uint8_t* LzCodec_WriteLength(uint8_t* target, size_t length) {
+    length -= LZCODEC_RUN_MASK;
+
+    while (length >= 255) {
+        *target++ = 255;
+        length -= 255;
+    }
+
+    *target++ = length;
+
+    return target;
+}
+
+static bool LzCodec_ReadLength(const uint8_t*& source, const uint8_t* const source_end, size_t& length) {
+    uint8_t value;
+
+    do {
+        if (source >= source_end) {
+            return false;
+        }
+
+        value = *source++;
+        length += value;
+
+    } while (value == 255);
+
+    return true;
+}
+
+size_t LzCodec_GetBound(const size_t size) { return size + size / 255 + 16; }
+
+size_t LzCodec_Compress(const uint8_t* const source, const size_t size, uint8_t* const target, const size_t capacity) {
+    uint32_t* const table = new (std::nothrow) uint32_t[1 << LZCODEC_HASH_BITS];
+    const uint8_t* const source_end = &source[size];
+    const uint8_t* const match_limit = (size > LZCODEC_MATCH_LIMIT) ? &source_end[-LZCODEC_MATCH_LIMIT] : source;
+    const uint8_t* position = source;
+    const uint8_t* anchor = source;
+    uint8_t* output = target;
+    uint8_t* const output_end = &target[capacity];
+    size_t literal_length;
+
+    if (!table) {
+        return 0;
+    }
+
+    memset(table, 0, sizeof(uint32_t) << LZCODEC_HASH_BITS);
+
+    while (position < match_limit) {
+        const uint32_t sequence = LzCodec_Load32(position);
+        const uint32_t hash = LzCodec_Hash(sequence);
+        const uint8_t* reference = &source[table[hash]];
+
+        table[hash] = position - source;
+
+        if (reference < position && position - reference <= LZCODEC_MAX_OFFSET &&
+            LzCodec_Load32(reference) == sequence) {
+            const uint8_t* match_end = &position[LZCODEC_MIN_MATCH];
+            const uint8_t* match_reference = &reference[LZCODEC_MIN_MATCH];
+            const size_t offset = position - reference;
+
+            while (match_end < &source_end[-LZCODEC_LAST_LITERALS] && *match_end == *match_reference) {
+                ++match_end;
+                ++match_reference;
+            }
+
+            const size_t match_length = match_end - position - LZCODEC_MIN_MATCH;
+
+            literal_length = position - anchor;
+
+            if (static_cast<size_t>(output_end - output) < 1 + LzCodec_GetLengthSize(literal_length) + literal_length +
+                                                               2 + LzCodec_GetLengthSize(match_length)) {
+                delete[] table;
+
+                return 0;
+            }
+
+            uint8_t* const token = output++;
+
+            if (literal_length >= LZCODEC_RUN_MASK) {
+                *token = LZCODEC_RUN_MASK << 4;
+                output = LzCodec_WriteLength(output, literal_length);
+
+            } else {
+                *token = literal_length << 4;
+            }
+
+            memcpy(output, anchor, literal_length);
+            output += literal_length;
+
+            *output++ = offset & 0xFF;
+            *output++ = offset >> 8;
+
+            if (match_length >= LZCODEC_RUN_MASK) {
+                *token |= LZCODEC_RUN_MASK;
+                output = LzCodec_WriteLength(output, match_length);
+
+            } else {
+                *token |= match_length;
+            }
+
+            position = match_end;
+            anchor = position;
+
+        } else {
+            ++position;
+        }
+    }
+
+    delete[] table;
+
+    literal_length = source_end - anchor;
+
+    if (static_cast<size_t>(output_end - output) < 1 + LzCodec_GetLengthSize(literal_length) + literal_length) {
+        return 0;
+    }
+
+    if (literal_length >= LZCODEC_RUN_MASK) {
+        *output++ = LZCODEC_RUN_MASK << 4;
+        output = LzCodec_WriteLength(output, literal_length);
+
+    } else {
+        *output++ = literal_length << 4;
+    }
+
+    if (literal_length > 0) {
+        memcpy(output, anchor, literal_length);
+        output += literal_length;
+    }
+
+    return output - target;
+}
+
+bool LzCodec_Decompress(const uint8_t* source, const size_t size, uint8_t* const target, const size_t target_size) {
+    const uint8_t* const source_end = &source[size];
+    uint8_t* output = target;
+    uint8_t* const output_end = &target[target_size];
+
+    for (;;) {
+        if (source >= source_end) {
+            return false;
+        }
+
+        const uint8_t token = *source++;
+        size_t literal_length = token >> 4;
+
+        if (literal_length == LZCODEC_RUN_MASK && !LzCodec_ReadLength(source, source_end, literal_length)) {
+            return false;
+        }
+
+        if (literal_length > static_cast<size_t>(source_end - source) ||
+            literal_length > static_cast<size_t>(output_end - output)) {
+            return false;
+        }
+
+        if (literal_length > 0) {
+            memcpy(output, source, literal_length);
+            output += literal_length;
+            source += literal_length;
+        }
+
+        if (source == source_end) {
+            return output == output_end && (token & LZCODEC_RUN_MASK) == 0;
+        }
+
+        if (source_end - source < 2) {
+            return false;
+        }
+
+        const size_t offset = source[0] | (source[1] << 8);
+        size_t match_length = token & LZCODEC_RUN_MASK;
+
+        source += 2;
+
+        if (offset == 0 || offset > static_cast<size_t>(output - target)) {
+            return false;
+        }
+
+        if (match_length == LZCODEC_RUN_MASK && !LzCodec_ReadLength(source, source_end, match_length)) {
+            return false;
+        }
+
+        match_length += LZCODEC_MIN_MATCH;
+
+        if (match_length > static_cast<size_t>(output_end - output)) {
+            return false;
+        }
+
+        const uint8_t* const reference = &output[-static_cast<ptrdiff_t>(offset)];
+
+        for (size_t i = 0; i < match_length; ++i) {
+            output[i] = reference[i];
+        }
+
+        output += match_length;
+    }
+}
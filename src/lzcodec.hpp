@@ -0,0 +1,38 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef LZCODEC_HPP
+#define LZCODEC_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+/// Byte oriented LZ77 block codec used for save file sections. A block is a sequence of tokens, each holding a run of
+/// literals followed by a back reference of at least LZCODEC_MIN_MATCH bytes into the preceding 64 KiB of output.
+/// The final token carries literals only. Decoding validates every length and offset so damaged input is rejected
+/// instead of overrunning the output.
+#define LZCODEC_MIN_MATCH 4
+
+size_t LzCodec_GetBound(size_t size);
+size_t LzCodec_Compress(const uint8_t* source, size_t size, uint8_t* target, size_t capacity);
+bool LzCodec_Decompress(const uint8_t* source, size_t size, uint8_t* target, size_t target_size);
+
+#endif /* LZCODEC_HPP */
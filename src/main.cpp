@@ -19,14 +19,21 @@
  * SOFTWARE.
  */
 
+#include "headless.hpp"
 #include "menu.hpp"
 #include "movie.hpp"
 #include "resource_manager.hpp"
 #include "sound_manager.hpp"
 
 int main(int argc, char* argv[]) {
+    Headless_ParseArguments(argc, argv);
+
     ResourceManager_InitResources();
 
+    if (Headless_IsEnabled()) {
+        return Headless_Run();
+    }
+
     if (Movie_PlayIntro()) {
         menu_draw_logo(ILOGO, 3000);
     }
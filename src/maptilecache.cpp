@@ -0,0 +1,143 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "maptilecache.hpp"
+
+#include <algorithm>
+#include <new>
+
+MapTileCache::MapTileCache()
+    : arena(nullptr),
+      tile_slots(nullptr),
+      slots(nullptr),
+      slot_size(0),
+      slot_count(0),
+      used_slot_count(0),
+      tile_count(0),
+      zoom_level(0),
+      brightness(0),
+      tile_size(0) {}
+
+MapTileCache::~MapTileCache() { Clear(); }
+
+bool MapTileCache::Configure(uint32_t map_tile_count, uint32_t map_zoom_level, uint32_t map_brightness,
+                             uint32_t map_tile_size) {
+    if (arena && tile_count == map_tile_count && zoom_level == map_zoom_level && brightness == map_brightness &&
+        tile_size == map_tile_size) {
+        return true;
+    }
+
+    Clear();
+
+    if (map_tile_count == 0 || map_zoom_level == 0) {
+        return false;
+    }
+
+    slot_size = map_zoom_level * map_zoom_level;
+    slot_count = std::min(static_cast<int32_t>(map_tile_count), MAPTILECACHE_ARENA_SIZE / slot_size);
+
+    arena = new (std::nothrow) uint8_t[slot_size * slot_count];
+    tile_slots = new (std::nothrow) int32_t[map_tile_count];
+    slots = new (std::nothrow) Slot[slot_count];
+
+    if (!arena || !tile_slots || !slots) {
+        Clear();
+
+        return false;
+    }
+
+    std::fill(tile_slots, tile_slots + map_tile_count, -1);
+
+    tile_count = map_tile_count;
+    zoom_level = map_zoom_level;
+    brightness = map_brightness;
+    tile_size = map_tile_size;
+
+    return true;
+}
+
+void MapTileCache::Clear() {
+    delete[] arena;
+    delete[] tile_slots;
+    delete[] slots;
+
+    arena = nullptr;
+    tile_slots = nullptr;
+    slots = nullptr;
+
+    lru.Clear();
+
+    slot_size = 0;
+    slot_count = 0;
+    used_slot_count = 0;
+    tile_count = 0;
+    zoom_level = 0;
+    brightness = 0;
+    tile_size = 0;
+}
+
+uint8_t *MapTileCache::Find(uint16_t tile_id) {
+    if (tile_id >= tile_count || tile_slots[tile_id] < 0) {
+        return nullptr;
+    }
+
+    const int32_t slot = tile_slots[tile_id];
+
+    lru.MoveToFront(&slots[slot]);
+
+    return &arena[slot * slot_size];
+}
+
+uint8_t *MapTileCache::Insert(uint16_t tile_id) {
+    int32_t slot;
+
+    if (tile_id >= tile_count) {
+        return nullptr;
+    }
+
+    if (tile_slots[tile_id] >= 0) {
+        return Find(tile_id);
+    }
+
+    if (used_slot_count < slot_count) {
+        slot = used_slot_count++;
+
+    } else {
+        /* the arena is full, the least recently used tile gives up its slot */
+        Slot *victim = lru.Back();
+
+        lru.Remove(victim);
+
+        tile_slots[victim->tile_id] = -1;
+        slot = victim - slots;
+    }
+
+    tile_slots[tile_id] = slot;
+    slots[slot].tile_id = tile_id;
+
+    lru.PushFront(&slots[slot]);
+
+    return &arena[slot * slot_size];
+}
+
+int32_t MapTileCache::GetSlotCount() const { return slot_count; }
+
+int32_t MapTileCache::GetUsedSlotCount() const { return used_slot_count; }
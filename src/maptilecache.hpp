@@ -0,0 +1,63 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MAPTILECACHE_HPP
+#define MAPTILECACHE_HPP
+
+#include <cstdint>
+
+#include "lrulist.hpp"
+
+#define MAPTILECACHE_ARENA_SIZE (16 * 1024 * 1024)
+
+/// Least recently used cache of map tiles that are already resampled to the current zoom level and translated by the
+/// current brightness color table. All entries share one arena of equally sized slots. The cache serves a single
+/// configuration at a time, a change of the zoom level, the brightness level or the source tile size flushes it.
+class MapTileCache {
+    struct Slot : public LruListNode<Slot> {
+        uint16_t tile_id;
+    };
+
+    uint8_t *arena;
+    int32_t *tile_slots;
+    Slot *slots;
+    LruList<Slot> lru;
+    int32_t slot_size;
+    int32_t slot_count;
+    int32_t used_slot_count;
+    uint32_t tile_count;
+    uint32_t zoom_level;
+    uint32_t brightness;
+    uint32_t tile_size;
+
+public:
+    MapTileCache();
+    ~MapTileCache();
+
+    bool Configure(uint32_t map_tile_count, uint32_t map_zoom_level, uint32_t map_brightness, uint32_t map_tile_size);
+    void Clear();
+    uint8_t *Find(uint16_t tile_id);
+    uint8_t *Insert(uint16_t tile_id);
+    int32_t GetSlotCount() const;
+    int32_t GetUsedSlotCount() const;
+};
+
+#endif /* MAPTILECACHE_HPP */
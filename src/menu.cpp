@@ -33,6 +33,7 @@
 #include "gameconfigmenu.hpp"
 #include "gamesetupmenu.hpp"
 #include "gfx.hpp"
+#include "headless.hpp"
 #include "inifile.hpp"
 #include "localization.hpp"
 #include "message_manager.hpp"
@@ -639,6 +640,13 @@ void menu_wrap_up_game(const WinLoss_Status& status, const int32_t turn_counter,
     Color* palette;
     SmartString mission_briefing;
 
+    if (Headless_IsEnabled()) {
+        Headless_RecordResult(status, turn_counter);
+        GameManager_GameState = GAME_STATE_3_MAIN_MENU;
+
+        return;
+    }
+
     if (status.team_status[GameManager_PlayerTeam] == VICTORY_STATE_GENERIC) {
         is_winner = status.team_rank[GameManager_PlayerTeam] == 1;
 
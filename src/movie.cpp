@@ -87,6 +87,7 @@ void movie_cb_show_frame(uint8_t* buffer, int32_t bufw, int32_t bufh, int32_t sx
     cscale(buffer, bufw, bufh, bufw, gfx_buf, frame_width, frame_height, window_width);
 
     Svga_Blit(gfx_buf, window_width, window_height, 0, 0, frame_width, frame_height, frame_offset_x, frame_offset_y);
+    Svga_Present();
 }
 
 void movie_cb_set_palette(uint8_t* p, int32_t start, int32_t count) {
@@ -163,4 +163,12 @@ NetPacket& NetPacket::operator=(NetPacket&& other) noexcept {
     return *this;
 }
 
+void NetPacket::Swap(NetPacket& other) noexcept {
+    std::swap(addresses, other.addresses);
+    std::swap(buffer, other.buffer);
+    std::swap(buffer_capacity, other.buffer_capacity);
+    std::swap(buffer_read_position, other.buffer_read_position);
+    std::swap(buffer_write_position, other.buffer_write_position);
+}
+
 bool operator!=(NetPacket& left, NetPacket& right) noexcept { return !(left == right); }
@@ -40,6 +40,7 @@ public:
     ~NetPacket() noexcept;
     NetPacket(NetPacket&& other) noexcept;
     NetPacket& operator=(NetPacket&& other) noexcept;
+    void Swap(NetPacket& other) noexcept;
     void Read(void* address, int32_t length) noexcept;
     void Write(const void* address, int32_t length) noexcept;
     uint32_t Peek(uint32_t offset, void* address, uint32_t length) noexcept;
@@ -0,0 +1,226 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "net_packet_batch.hpp"
+
+#include <cstring>
+
+enum : uint8_t {
+    NET_PACKET_BATCH_RAW,
+    NET_PACKET_BATCH_KEYED,
+    NET_PACKET_BATCH_DELTA,
+};
+
+static constexpr uint32_t NetPacketBatch_KeySize = sizeof(uint8_t) + sizeof(uint16_t);
+
+static inline uint32_t NetPacketBatch_GetKey(const uint8_t* const data) {
+    return (data[0] << 16) | (data[1] << 8) | data[2];
+}
+
+static void NetPacketBatch_EncodeDelta(const uint8_t* const data, const uint8_t* const reference, const uint32_t size,
+                                       std::vector<uint8_t>& target) {
+    uint32_t position{NetPacketBatch_KeySize};
+
+    target.assign(data, &data[NetPacketBatch_KeySize]);
+
+    /* sequence of zero run length, literal count and XOR literals */
+    while (position < size) {
+        uint32_t zeros{0};
+        uint32_t literals{0};
+
+        while (position + zeros < size && zeros < UINT8_MAX && data[position + zeros] == reference[position + zeros]) {
+            ++zeros;
+        }
+
+        position += zeros;
+
+        while (position + literals < size && literals < UINT8_MAX &&
+               data[position + literals] != reference[position + literals]) {
+            ++literals;
+        }
+
+        target.push_back(zeros);
+        target.push_back(literals);
+
+        for (uint32_t i = 0; i < literals; ++i) {
+            target.push_back(data[position + i] ^ reference[position + i]);
+        }
+
+        position += literals;
+    }
+}
+
+static bool NetPacketBatch_DecodeDelta(const uint8_t* const data, const uint32_t size,
+                                       const std::vector<uint8_t>& reference, std::vector<uint8_t>& target) {
+    uint32_t position{NetPacketBatch_KeySize};
+    uint32_t target_position{NetPacketBatch_KeySize};
+
+    target = reference;
+
+    while (position < size) {
+        if (size - position < 2) {
+            return false;
+        }
+
+        const uint32_t zeros = data[position];
+        const uint32_t literals = data[position + 1];
+
+        position += 2;
+        target_position += zeros;
+
+        if (literals > size - position || target_position + literals > target.size()) {
+            return false;
+        }
+
+        for (uint32_t i = 0; i < literals; ++i) {
+            target[target_position + i] ^= data[position + i];
+        }
+
+        position += literals;
+        target_position += literals;
+    }
+
+    return target_position <= target.size();
+}
+
+NetPacketBatch::NetPacketBatch(const uint8_t packet_type) noexcept : packet_type(packet_type), count(0) { Clear(); }
+
+bool NetPacketBatch::Add(NetPacket& packet, const bool delta_encode) noexcept {
+    const uint8_t* const data = reinterpret_cast<const uint8_t*>(packet.GetBuffer());
+    const uint32_t size = packet.GetDataSize();
+    uint8_t encoding{NET_PACKET_BATCH_RAW};
+    std::vector<uint8_t> delta;
+
+    if (size == 0 || size > UINT16_MAX) {
+        return false;
+    }
+
+    if (delta_encode && size > NetPacketBatch_KeySize) {
+        auto& reference = references[NetPacketBatch_GetKey(data)];
+
+        if (reference.size() == size) {
+            NetPacketBatch_EncodeDelta(data, reference.data(), size, delta);
+        }
+
+        encoding = (delta.size() > 0 && delta.size() < size) ? NET_PACKET_BATCH_DELTA : NET_PACKET_BATCH_KEYED;
+
+        reference.assign(data, &data[size]);
+    }
+
+    if (encoding == NET_PACKET_BATCH_DELTA) {
+        batch << encoding;
+        batch << static_cast<uint16_t>(delta.size());
+        batch.Write(delta.data(), delta.size());
+
+    } else {
+        batch << encoding;
+        batch << static_cast<uint16_t>(size);
+        batch.Write(data, size);
+    }
+
+    ++count;
+
+    return true;
+}
+
+[[nodiscard]] uint16_t NetPacketBatch::GetCount() const noexcept { return count; }
+
+[[nodiscard]] int32_t NetPacketBatch::GetDataSize() const noexcept { return batch.GetDataSize(); }
+
+[[nodiscard]] NetPacket& NetPacketBatch::GetPacket() noexcept { return batch; }
+
+void NetPacketBatch::Clear() noexcept {
+    batch.Reset();
+    batch << packet_type;
+    count = 0;
+}
+
+void NetPacketBatch::Reset() noexcept {
+    Clear();
+    references.clear();
+}
+
+bool NetPacketBatch::Extract(NetPacket& source, NetPacket& packet) noexcept {
+    uint8_t encoding;
+    uint16_t size;
+    std::vector<uint8_t> data;
+
+    packet.Reset();
+
+    if (source.GetDataSize() < static_cast<int32_t>(sizeof(encoding) + sizeof(size))) {
+        return false;
+    }
+
+    source >> encoding;
+    source >> size;
+
+    if (size == 0 || size > source.GetDataSize()) {
+        return false;
+    }
+
+    data.resize(size);
+    source.Read(data.data(), size);
+
+    for (uint16_t i = 0; i < source.GetAddressCount(); ++i) {
+        packet.AddAddress(source.GetAddress(i));
+    }
+
+    switch (encoding) {
+        case NET_PACKET_BATCH_RAW: {
+            packet.Write(data.data(), size);
+        } break;
+
+        case NET_PACKET_BATCH_KEYED: {
+            if (size <= NetPacketBatch_KeySize) {
+                return false;
+            }
+
+            references[NetPacketBatch_GetKey(data.data())] = data;
+
+            packet.Write(data.data(), size);
+        } break;
+
+        case NET_PACKET_BATCH_DELTA: {
+            std::vector<uint8_t> payload;
+
+            if (size < NetPacketBatch_KeySize) {
+                return false;
+            }
+
+            auto& reference = references[NetPacketBatch_GetKey(data.data())];
+
+            if (reference.size() <= NetPacketBatch_KeySize ||
+                !NetPacketBatch_DecodeDelta(data.data(), size, reference, payload)) {
+                return false;
+            }
+
+            reference = payload;
+
+            packet.Write(payload.data(), payload.size());
+        } break;
+
+        default: {
+            return false;
+        } break;
+    }
+
+    return true;
+}
@@ -0,0 +1,55 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef NET_PACKET_BATCH_HPP
+#define NET_PACKET_BATCH_HPP
+
+#include <unordered_map>
+#include <vector>
+
+#include "net_packet.hpp"
+
+#define NET_PACKET_BATCH_SIZE_LIMIT 1200
+
+/// Frames the packets sent to the same destinations within one game frame into a single transport packet. Packets
+/// that start with a packet type and a 16-bit entity ID may be keyed. A keyed packet is encoded as the XOR
+/// difference to the previous payload of the same key, and its unchanged bytes are stored as zero runs. The sender
+/// and the receiver both keep the previous payloads. The transport channel is reliable and ordered, so the receiver
+/// always holds the reference that the sender encoded against.
+class NetPacketBatch {
+    NetPacket batch;
+    uint8_t packet_type;
+    uint16_t count;
+    std::unordered_map<uint32_t, std::vector<uint8_t>> references;
+
+public:
+    explicit NetPacketBatch(uint8_t packet_type) noexcept;
+
+    bool Add(NetPacket& packet, bool delta_encode) noexcept;
+    [[nodiscard]] uint16_t GetCount() const noexcept;
+    [[nodiscard]] int32_t GetDataSize() const noexcept;
+    [[nodiscard]] NetPacket& GetPacket() noexcept;
+    void Clear() noexcept;
+    void Reset() noexcept;
+    bool Extract(NetPacket& source, NetPacket& packet) noexcept;
+};
+
+#endif /* NET_PACKET_BATCH_HPP */
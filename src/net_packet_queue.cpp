@@ -0,0 +1,139 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "net_packet_queue.hpp"
+
+#include <SDL_assert.h>
+
+#include <new>
+
+#include "resource_manager.hpp"
+
+#define NET_PACKET_QUEUE_BACKLOG_CAPACITY 16
+
+NetPacketQueue::NetPacketQueue(const uint32_t capacity) noexcept
+    : slots(new(std::nothrow) NetPacket[capacity]),
+      capacity(capacity),
+      backlog(nullptr),
+      backlog_capacity(0),
+      backlog_head(0),
+      backlog_count(0) {
+    SDL_assert(capacity > 0 && (capacity & (capacity - 1)) == 0);
+
+    if (!slots) {
+        ResourceManager_ExitGame(EXIT_CODE_INSUFFICIENT_MEMORY);
+    }
+
+    SDL_AtomicSet(&head, 0);
+    SDL_AtomicSet(&tail, 0);
+}
+
+NetPacketQueue::~NetPacketQueue() noexcept {
+    delete[] backlog;
+    delete[] slots;
+}
+
+bool NetPacketQueue::Enqueue(NetPacket& packet) noexcept {
+    const uint32_t write_index = SDL_AtomicGet(&head);
+    const uint32_t read_index = SDL_AtomicGet(&tail);
+    bool result{false};
+
+    if (write_index - read_index < capacity) {
+        /* the slot was reset by the consumer, its buffer is handed back to the producer for reuse */
+        slots[write_index & (capacity - 1)].Swap(packet);
+
+        SDL_AtomicSet(&head, write_index + 1);
+
+        result = true;
+    }
+
+    return result;
+}
+
+bool NetPacketQueue::GrowBacklog() noexcept {
+    const uint32_t new_capacity = backlog_capacity ? backlog_capacity * 2 : NET_PACKET_QUEUE_BACKLOG_CAPACITY;
+    NetPacket* const new_backlog = new (std::nothrow) NetPacket[new_capacity];
+
+    if (!new_backlog) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < backlog_count; ++i) {
+        new_backlog[i].Swap(backlog[(backlog_head + i) & (backlog_capacity - 1)]);
+    }
+
+    delete[] backlog;
+
+    backlog = new_backlog;
+    backlog_capacity = new_capacity;
+    backlog_head = 0;
+
+    return true;
+}
+
+bool NetPacketQueue::Push(NetPacket& packet) noexcept {
+    bool result{true};
+
+    if (backlog_count > 0 || !Enqueue(packet)) {
+        if (backlog_count < backlog_capacity || GrowBacklog()) {
+            /* backlog slots are empty, the caller gets an empty packet back as with the ring */
+            backlog[(backlog_head + backlog_count) & (backlog_capacity - 1)].Swap(packet);
+            ++backlog_count;
+
+            Flush();
+
+        } else {
+            result = false;
+        }
+    }
+
+    return result;
+}
+
+bool NetPacketQueue::Flush() noexcept {
+    while (backlog_count > 0 && Enqueue(backlog[backlog_head])) {
+        backlog_head = (backlog_head + 1) & (backlog_capacity - 1);
+        --backlog_count;
+    }
+
+    return backlog_count == 0;
+}
+
+bool NetPacketQueue::Pop(NetPacket& packet) noexcept {
+    const uint32_t read_index = SDL_AtomicGet(&tail);
+    const uint32_t write_index = SDL_AtomicGet(&head);
+    bool result{false};
+
+    if (read_index != write_index) {
+        NetPacket& slot = slots[read_index & (capacity - 1)];
+
+        packet.Swap(slot);
+        slot.Reset();
+
+        SDL_AtomicSet(&tail, read_index + 1);
+
+        result = true;
+    }
+
+    return result;
+}
+
+[[nodiscard]] bool NetPacketQueue::IsEmpty() noexcept { return SDL_AtomicGet(&tail) == SDL_AtomicGet(&head); }
@@ -0,0 +1,59 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef NET_PACKET_QUEUE_HPP
+#define NET_PACKET_QUEUE_HPP
+
+#include <SDL_atomic.h>
+
+#include "net_packet.hpp"
+
+#define NET_PACKET_QUEUE_CAPACITY 256
+
+/// Single producer, single consumer ring of pre-allocated NetPacket slots that hands packets over between the game
+/// thread and the network service thread without locks. Packets are swapped in and out of the slots so that their
+/// buffers are recycled instead of allocated per message. Packets that do not fit into a full ring are kept in a
+/// second, growable ring owned by the producer until Flush finds room for them. Push fails only if the backlog cannot
+/// grow.
+class NetPacketQueue {
+    NetPacket* slots;
+    uint32_t capacity;
+    SDL_atomic_t head;
+    SDL_atomic_t tail;
+    NetPacket* backlog;
+    uint32_t backlog_capacity;
+    uint32_t backlog_head;
+    uint32_t backlog_count;
+
+    bool Enqueue(NetPacket& packet) noexcept;
+    bool GrowBacklog() noexcept;
+
+public:
+    explicit NetPacketQueue(uint32_t capacity = NET_PACKET_QUEUE_CAPACITY) noexcept;
+    ~NetPacketQueue() noexcept;
+
+    bool Push(NetPacket& packet) noexcept;
+    bool Flush() noexcept;
+    bool Pop(NetPacket& packet) noexcept;
+    [[nodiscard]] bool IsEmpty() noexcept;
+};
+
+#endif /* NET_PACKET_QUEUE_HPP */
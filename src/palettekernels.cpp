@@ -0,0 +1,169 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "palettekernels.hpp"
+
+#include <SDL_cpuinfo.h>
+
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+
+#define PALETTE_KERNELS_X86 1
+
+/* GCC and Clang only emit instructions beyond the baseline for functions that ask for them, MSVC always does */
+#if defined(__GNUC__) || defined(__clang__)
+#define PALETTE_KERNELS_TARGET(instruction_set) __attribute__((target(instruction_set)))
+#else
+#define PALETTE_KERNELS_TARGET(instruction_set)
+#endif
+#endif
+
+typedef void (*PaletteKernels_ExpandSpanFunc)(uint32_t* target, const uint8_t* source, size_t count,
+                                              const uint32_t* colors);
+
+static void PaletteKernels_ExpandSpanScalar(uint32_t* target, const uint8_t* source, size_t count,
+                                            const uint32_t* colors);
+static PaletteKernels_ExpandSpanFunc PaletteKernels_Get();
+
+static uint8_t PaletteKernels_InstructionSet;
+static PaletteKernels_ExpandSpanFunc PaletteKernels_ExpandSpanActive;
+
+void PaletteKernels_ExpandSpanScalar(uint32_t* target, const uint8_t* source, size_t count, const uint32_t* colors) {
+    for (size_t i = 0; i < count; ++i) {
+        target[i] = colors[source[i]];
+    }
+}
+
+#if defined(PALETTE_KERNELS_X86)
+
+#define PALETTE_KERNELS_SSE41_LANES 4
+#define PALETTE_KERNELS_AVX2_LANES 8
+
+PALETTE_KERNELS_TARGET("sse4.1")
+static void PaletteKernels_ExpandSpanSse41(uint32_t* target, const uint8_t* source, size_t count,
+                                           const uint32_t* colors) {
+    size_t i = 0;
+
+    /* there is no gather instruction, the lookups are scalar but the indices are widened and stored four at once */
+    for (; i + PALETTE_KERNELS_SSE41_LANES <= count; i += PALETTE_KERNELS_SSE41_LANES) {
+        int32_t packed;
+
+        memcpy(&packed, &source[i], sizeof(packed));
+
+        const __m128i indices = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(packed));
+        __m128i pixels = _mm_cvtsi32_si128(static_cast<int32_t>(colors[_mm_cvtsi128_si32(indices)]));
+
+        pixels = _mm_insert_epi32(pixels, static_cast<int32_t>(colors[_mm_extract_epi32(indices, 1)]), 1);
+        pixels = _mm_insert_epi32(pixels, static_cast<int32_t>(colors[_mm_extract_epi32(indices, 2)]), 2);
+        pixels = _mm_insert_epi32(pixels, static_cast<int32_t>(colors[_mm_extract_epi32(indices, 3)]), 3);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&target[i]), pixels);
+    }
+
+    PaletteKernels_ExpandSpanScalar(&target[i], &source[i], count - i, colors);
+}
+
+PALETTE_KERNELS_TARGET("avx2")
+static void PaletteKernels_ExpandSpanAvx2(uint32_t* target, const uint8_t* source, size_t count,
+                                          const uint32_t* colors) {
+    const int* table = reinterpret_cast<const int*>(colors);
+    size_t i = 0;
+
+    for (; i + 2 * PALETTE_KERNELS_AVX2_LANES <= count; i += 2 * PALETTE_KERNELS_AVX2_LANES) {
+        const __m128i indices = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&source[i]));
+        const __m256i low = _mm256_i32gather_epi32(table, _mm256_cvtepu8_epi32(indices), sizeof(uint32_t));
+        const __m256i high =
+            _mm256_i32gather_epi32(table, _mm256_cvtepu8_epi32(_mm_srli_si128(indices, 8)), sizeof(uint32_t));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&target[i]), low);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&target[i + PALETTE_KERNELS_AVX2_LANES]), high);
+    }
+
+    if (i + PALETTE_KERNELS_AVX2_LANES <= count) {
+        const __m128i indices = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(&source[i]));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&target[i]),
+                            _mm256_i32gather_epi32(table, _mm256_cvtepu8_epi32(indices), sizeof(uint32_t)));
+        i += PALETTE_KERNELS_AVX2_LANES;
+    }
+
+    PaletteKernels_ExpandSpanScalar(&target[i], &source[i], count - i, colors);
+}
+
+#endif /* defined(PALETTE_KERNELS_X86) */
+
+PaletteKernels_ExpandSpanFunc PaletteKernels_Get() {
+    if (!PaletteKernels_ExpandSpanActive) {
+        PaletteKernels_SetInstructionSet(PALETTE_KERNELS_AVX2);
+    }
+
+    return PaletteKernels_ExpandSpanActive;
+}
+
+uint8_t PaletteKernels_SetInstructionSet(uint8_t instruction_set) {
+    PaletteKernels_InstructionSet = PALETTE_KERNELS_SCALAR;
+    PaletteKernels_ExpandSpanActive = &PaletteKernels_ExpandSpanScalar;
+
+#if defined(PALETTE_KERNELS_X86)
+    if (instruction_set >= PALETTE_KERNELS_AVX2 && SDL_HasAVX2()) {
+        PaletteKernels_InstructionSet = PALETTE_KERNELS_AVX2;
+        PaletteKernels_ExpandSpanActive = &PaletteKernels_ExpandSpanAvx2;
+
+    } else if (instruction_set >= PALETTE_KERNELS_SSE41 && SDL_HasSSE41()) {
+        PaletteKernels_InstructionSet = PALETTE_KERNELS_SSE41;
+        PaletteKernels_ExpandSpanActive = &PaletteKernels_ExpandSpanSse41;
+    }
+#endif
+
+    return PaletteKernels_InstructionSet;
+}
+
+uint8_t PaletteKernels_GetInstructionSet() {
+    PaletteKernels_Get();
+
+    return PaletteKernels_InstructionSet;
+}
+
+const char* PaletteKernels_GetInstructionSetName(uint8_t instruction_set) {
+    const char* result;
+
+    switch (instruction_set) {
+        case PALETTE_KERNELS_SSE41: {
+            result = "SSE4.1";
+        } break;
+
+        case PALETTE_KERNELS_AVX2: {
+            result = "AVX2";
+        } break;
+
+        default: {
+            result = "Scalar";
+        } break;
+    }
+
+    return result;
+}
+
+void PaletteKernels_ExpandSpan(uint32_t* target, const uint8_t* source, size_t count, const uint32_t* colors) {
+    PaletteKernels_Get()(target, source, count, colors);
+}
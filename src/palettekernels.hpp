@@ -0,0 +1,43 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef PALETTEKERNELS_HPP
+#define PALETTEKERNELS_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+enum : uint8_t {
+    PALETTE_KERNELS_SCALAR,
+    PALETTE_KERNELS_SSE41,
+    PALETTE_KERNELS_AVX2,
+};
+
+/// Span kernel that expands 8-bit palette indices into 32-bit pixels through a 256 entry color table. The AVX2 kernel
+/// looks up eight pixels at a time with a gather instruction, the SSE4.1 kernel writes four pixels at a time. The
+/// fastest instruction set supported by the CPU is selected on first use.
+void PaletteKernels_ExpandSpan(uint32_t* target, const uint8_t* source, size_t count, const uint32_t* colors);
+
+uint8_t PaletteKernels_GetInstructionSet();
+uint8_t PaletteKernels_SetInstructionSet(uint8_t instruction_set);
+const char* PaletteKernels_GetInstructionSetName(uint8_t instruction_set);
+
+#endif /* PALETTEKERNELS_HPP */
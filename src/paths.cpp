@@ -21,6 +21,7 @@
 
 #include "paths.hpp"
 
+#include <algorithm>
 #include <cmath>
 
 #include "access.hpp"
@@ -75,12 +76,13 @@ const Point Paths_8DirPointsArrayMarkerC[8] = {{10, 10},   {0, 12},  {-10, 10},
 
 uint32_t Paths_DebugMode;
 
-uint32_t Paths_EvaluatedTileCount;
-uint32_t Paths_EvaluatorCallCount;
-uint32_t Paths_SquareAdditionsCount;
-uint32_t Paths_SquareInsertionsCount;
-uint32_t Paths_EvaluatedSquareCount;
-uint32_t Paths_MaxDepth;
+/* statistics are kept per thread as path searches may also run on path worker threads */
+thread_local uint32_t Paths_EvaluatedTileCount;
+thread_local uint32_t Paths_EvaluatorCallCount;
+thread_local uint32_t Paths_SquareAdditionsCount;
+thread_local uint32_t Paths_SquareInsertionsCount;
+thread_local uint32_t Paths_EvaluatedSquareCount;
+thread_local uint32_t Paths_MaxDepth;
 
 UnitPath::UnitPath() : x_end(0), y_end(0), distance_x(0), distance_y(0), euclidean_distance(0) {}
 
@@ -1645,3 +1647,34 @@ void Paths_RemoveSiteReservation(const Point site) noexcept {
 void Paths_ClearSiteReservations() noexcept { Paths_SiteReservations.Clear(); }
 
 [[nodiscard]] bool Paths_IsSiteReserved(const Point site) noexcept { return Paths_SiteReservations->Find(&site) != -1; }
+
+void Paths_ResetStatistics() noexcept {
+    Paths_EvaluatedTileCount = 0;
+    Paths_EvaluatorCallCount = 0;
+    Paths_SquareAdditionsCount = 0;
+    Paths_SquareInsertionsCount = 0;
+    Paths_EvaluatedSquareCount = 0;
+    Paths_MaxDepth = 0;
+}
+
+[[nodiscard]] PathsStatistics Paths_GetStatistics() noexcept {
+    PathsStatistics statistics;
+
+    statistics.evaluated_tile_count = Paths_EvaluatedTileCount;
+    statistics.evaluator_call_count = Paths_EvaluatorCallCount;
+    statistics.square_additions_count = Paths_SquareAdditionsCount;
+    statistics.square_insertions_count = Paths_SquareInsertionsCount;
+    statistics.evaluated_square_count = Paths_EvaluatedSquareCount;
+    statistics.max_depth = Paths_MaxDepth;
+
+    return statistics;
+}
+
+void Paths_AddStatistics(PathsStatistics& total, const PathsStatistics& statistics) noexcept {
+    total.evaluated_tile_count += statistics.evaluated_tile_count;
+    total.evaluator_call_count += statistics.evaluator_call_count;
+    total.square_additions_count += statistics.square_additions_count;
+    total.square_insertions_count += statistics.square_insertions_count;
+    total.evaluated_square_count += statistics.evaluated_square_count;
+    total.max_depth = std::max(total.max_depth, statistics.max_depth);
+}
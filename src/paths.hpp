@@ -159,15 +159,29 @@ void Paths_RemoveSiteReservation(const Point site) noexcept;
 void Paths_ClearSiteReservations() noexcept;
 [[nodiscard]] bool Paths_IsSiteReserved(const Point site) noexcept;
 
+/// Path search counters. The live counters are kept per thread, snapshots of them are summed up by the path manager.
+struct PathsStatistics {
+    uint64_t evaluated_tile_count;
+    uint64_t evaluator_call_count;
+    uint64_t square_additions_count;
+    uint64_t square_insertions_count;
+    uint64_t evaluated_square_count;
+    uint32_t max_depth;
+};
+
+void Paths_ResetStatistics() noexcept;
+[[nodiscard]] PathsStatistics Paths_GetStatistics() noexcept;
+void Paths_AddStatistics(PathsStatistics& total, const PathsStatistics& statistics) noexcept;
+
 extern const Point Paths_8DirPointsArray[8];
 extern const int16_t Paths_8DirPointsArrayX[8];
 extern const int16_t Paths_8DirPointsArrayY[8];
 extern uint32_t Paths_DebugMode;
-extern uint32_t Paths_EvaluatedTileCount;
-extern uint32_t Paths_EvaluatorCallCount;
-extern uint32_t Paths_SquareAdditionsCount;
-extern uint32_t Paths_SquareInsertionsCount;
-extern uint32_t Paths_EvaluatedSquareCount;
-extern uint32_t Paths_MaxDepth;
+extern thread_local uint32_t Paths_EvaluatedTileCount;
+extern thread_local uint32_t Paths_EvaluatorCallCount;
+extern thread_local uint32_t Paths_SquareAdditionsCount;
+extern thread_local uint32_t Paths_SquareInsertionsCount;
+extern thread_local uint32_t Paths_EvaluatedSquareCount;
+extern thread_local uint32_t Paths_MaxDepth;
 
 #endif /* PATHS_HPP */
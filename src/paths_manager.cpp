@@ -25,10 +25,14 @@
 #include "accessmap.hpp"
 #include "ai.hpp"
 #include "ailog.hpp"
+#include "aiprofiler.hpp"
 #include "aiplayer.hpp"
+#include "clustermap.hpp"
+#include "inifile.hpp"
 #include "message_manager.hpp"
 #include "mouseevent.hpp"
 #include "pathfill.hpp"
+#include "pathworkers.hpp"
 #include "resource_manager.hpp"
 #include "searcher.hpp"
 #include "task_manager.hpp"
@@ -36,9 +40,30 @@
 #include "units_manager.hpp"
 #include "zonewalker.hpp"
 
+#define PATHS_MANAGER_CLUSTER_MAP_CACHE_ENTRIES 8
+/// path searches handed to the workers are delivered this many path manager ticks after submission on every host,
+/// no matter how fast the local workers are, so that network games stay in lock-step
+#define PATHS_MANAGER_DELIVERY_DELAY 2
+#define PATHS_MANAGER_PENDING_REQUESTS_LIMIT 8
+#define PATHS_MANAGER_SUBMITTED_REQUESTS_PER_TICK 4
+/// squared air distance above which path searches are limited to a corridor of map clusters
+#define PATHS_MANAGER_HIERARCHICAL_SEARCH_DISTANCE ((CLUSTERMAP_CLUSTER_SIZE * 2) * (CLUSTERMAP_CLUSTER_SIZE * 2))
+
 class PathsManager {
-    uint8_t **access_map;
-    Point access_map_size;
+    struct PendingRequest {
+        SmartPointer<PathRequest> request;
+        Grid2D<uint8_t> access_map;
+        Point position;
+        uint32_t time_stamp;
+        uint32_t due_tick;
+        PathJob job;
+    };
+
+    Grid2D<uint8_t> access_map;
+
+    ClusterMap *cluster_maps[PATHS_MANAGER_CLUSTER_MAP_CACHE_ENTRIES];
+    ClusterMap *corridor_map;
+    uint32_t cluster_map_time_stamp;
 
     SmartPointer<PathRequest> request;
     SmartList<PathRequest> requests;
@@ -47,7 +72,21 @@ class PathsManager {
     Searcher *forward_searcher;
     Searcher *backward_searcher;
 
+    PathWorkers path_workers;
+    ObjectArray<PendingRequest *> pending_requests;
+
+    uint32_t served_request_count;
+    uint32_t tick_count;
+    PathsStatistics statistics;
+
     void CompleteRequest(GroundPath *path);
+    void DeleteSearchers();
+    bool UseWorkers();
+    void SubmitRequest(Point position, Point destination, bool mode);
+    void CollectRequests();
+    void DeletePendingRequest(PendingRequest *pending_request);
+    ClusterMap *GetClusterMap(UnitInfo *unit);
+    void ApplyCorridor(ClusterMap *cluster_map, Point position, Point destination);
 
     friend uint8_t **PathsManager_GetAccessMap();
 
@@ -65,6 +104,8 @@ public:
     bool HasRequest(UnitInfo *unit) const;
     bool Init(UnitInfo *unit);
     void ProcessRequest();
+    uint32_t GetServedRequestCount() const;
+    const PathsStatistics &GetStatistics() const;
 };
 
 static PathsManager PathsManager_Instance;
@@ -78,34 +119,45 @@ static void PathsManager_ProcessDangers(uint8_t **map, UnitInfo *unit);
 static void PathsManager_ProcessSurface(uint8_t **map, UnitInfo *unit);
 
 PathsManager::PathsManager()
-    : access_map(nullptr),
-      access_map_size(0, 0),
+    : cluster_maps(),
+      corridor_map(nullptr),
+      cluster_map_time_stamp(0),
       forward_searcher(nullptr),
       backward_searcher(nullptr),
       time_stamp(0),
-      elapsed_time(0) {}
+      elapsed_time(0),
+      served_request_count(0),
+      tick_count(0),
+      statistics() {}
 
 PathsManager::~PathsManager() { Clear(); }
 
 void PathsManager::PushBack(PathRequest &object) { requests.PushBack(object); }
 
 void PathsManager::Clear() {
-    delete forward_searcher;
-    forward_searcher = nullptr;
+    DeleteSearchers();
 
-    delete backward_searcher;
-    backward_searcher = nullptr;
+    for (int32_t i = 0; i < pending_requests.GetCount(); ++i) {
+        SDL_AtomicSet(&(*pending_requests[i])->job.is_cancelled, 1);
+    }
 
-    if (access_map) {
-        for (int32_t i = 0; i < ResourceManager_MapSize.x; ++i) {
-            delete[] access_map[i];
-        }
+    path_workers.Deinit();
+
+    for (int32_t i = 0; i < pending_requests.GetCount(); ++i) {
+        DeletePendingRequest(*pending_requests[i]);
+    }
+
+    pending_requests.Clear();
 
-        delete[] access_map;
-        access_map = nullptr;
+    for (int32_t i = 0; i < PATHS_MANAGER_CLUSTER_MAP_CACHE_ENTRIES; ++i) {
+        delete cluster_maps[i];
+        cluster_maps[i] = nullptr;
     }
 
-    access_map_size = {0, 0};
+    cluster_map_time_stamp = 0;
+    tick_count = 0;
+
+    access_map.Deinit();
 
     request = nullptr;
     requests.Clear();
@@ -113,16 +165,12 @@ void PathsManager::Clear() {
 
 void PathsManager::PushFront(PathRequest &object) {
     if (request != nullptr) {
-        AiLog log("Pre-empting path request for %s.",
-                  UnitsManager_BaseUnits[request->GetClient()->GetUnitType()].singular_name);
+        AILOG(log, "Pre-empting path request for %s.",
+              UnitsManager_BaseUnits[request->GetClient()->GetUnitType()].singular_name);
 
         requests.PushFront(*request);
 
-        delete forward_searcher;
-        forward_searcher = nullptr;
-
-        delete backward_searcher;
-        backward_searcher = nullptr;
+        DeleteSearchers();
 
         request = nullptr;
     }
@@ -130,6 +178,108 @@ void PathsManager::PushFront(PathRequest &object) {
     requests.PushFront(object);
 }
 
+void PathsManager::DeleteSearchers() {
+    delete forward_searcher;
+    forward_searcher = nullptr;
+
+    delete backward_searcher;
+    backward_searcher = nullptr;
+
+    corridor_map = nullptr;
+}
+
+bool PathsManager::UseWorkers() {
+    if (!path_workers.IsInited()) {
+        path_workers.Init(ini_get_setting(INI_PATH_WORKERS));
+    }
+
+    /* path searches can only be drawn by the main thread */
+    return path_workers.GetThreadCount() > 0 && Paths_DebugMode == 0;
+}
+
+void PathsManager::SubmitRequest(Point position, Point destination, bool mode) {
+    PendingRequest *pending_request = new (std::nothrow) PendingRequest;
+
+    pending_request->request = request;
+    pending_request->position = position;
+    pending_request->time_stamp = time_stamp;
+    pending_request->due_tick = tick_count + PATHS_MANAGER_DELIVERY_DELAY;
+
+    /* the worker gets a private copy as the shared access map is reinitialized for the next request */
+    pending_request->access_map.Init(access_map.GetWidth(), access_map.GetHeight());
+    pending_request->access_map.Copy(access_map);
+
+    pending_request->job.forward_searcher =
+        new (std::nothrow) Searcher(pending_request->access_map.GetMap(), position, destination, mode, true);
+    pending_request->job.backward_searcher =
+        new (std::nothrow) Searcher(pending_request->access_map.GetMap(), destination, position, mode, true);
+
+    pending_request->job.forward_searcher->Process(position, true);
+    pending_request->job.backward_searcher->Process(destination, false);
+
+    SDL_AtomicSet(&pending_request->job.is_cancelled, 0);
+
+    pending_requests.Append(&pending_request);
+    path_workers.Submit(&pending_request->job);
+
+    AILOG(log, "Hand over path search to worker thread, %i searches pending.", pending_requests.GetCount());
+
+    request = nullptr;
+}
+
+void PathsManager::CollectRequests() {
+    /* searches are handed back in submission order on their due tick, the main thread waits for late workers so that
+     * the outcome depends neither on thread timing nor on the time budget of the host
+     */
+    while (pending_requests.GetCount() > 0) {
+        PendingRequest *pending_request = *pending_requests[0];
+
+        if (static_cast<int32_t>(tick_count - pending_request->due_tick) < 0) {
+            break;
+        }
+
+        path_workers.Wait(&pending_request->job);
+
+        pending_requests.Remove(0);
+
+        Paths_AddStatistics(statistics, pending_request->job.statistics);
+
+        if (SDL_AtomicGet(&pending_request->job.is_cancelled)) {
+            DeletePendingRequest(pending_request);
+
+        } else {
+            SmartPointer<PathRequest> path_request(pending_request->request);
+            SmartPointer<GroundPath> ground_path;
+
+            AILOG(log, "Path generator worker.");
+
+            ground_path = pending_request->job.forward_searcher->DeterminePath(pending_request->position,
+                                                                               path_request->GetMaxCost());
+
+            if (ground_path) {
+                AILOG_LOG(log, "Found path (%i msecs), %i steps.", timer_elapsed_time(pending_request->time_stamp),
+                          ground_path->GetSteps()->GetCount());
+
+            } else {
+                AILOG_LOG(log, "No path, error in transcription.");
+            }
+
+            DeletePendingRequest(pending_request);
+
+            ++served_request_count;
+
+            path_request->Finish(&*ground_path);
+        }
+    }
+}
+
+void PathsManager::DeletePendingRequest(PendingRequest *pending_request) {
+    delete pending_request->job.forward_searcher;
+    delete pending_request->job.backward_searcher;
+
+    delete pending_request;
+}
+
 int32_t PathsManager::GetRequestCount(uint16_t team) const {
     int32_t count;
 
@@ -147,6 +297,15 @@ int32_t PathsManager::GetRequestCount(uint16_t team) const {
         ++count;
     }
 
+    for (int32_t i = 0; i < pending_requests.GetCount(); ++i) {
+        PendingRequest *pending_request = *pending_requests[i];
+        UnitInfo *unit = pending_request->request->GetClient();
+
+        if (unit && unit->team == team && !SDL_AtomicGet(&pending_request->job.is_cancelled)) {
+            ++count;
+        }
+    }
+
     return count;
 }
 
@@ -155,17 +314,19 @@ void PathsManager::RemoveRequest(PathRequest *path_request) {
     SmartPointer<PathRequest> protect_request(path_request);
 
     if (request == protect_request) {
-        delete forward_searcher;
-        forward_searcher = nullptr;
-
-        delete backward_searcher;
-        backward_searcher = nullptr;
+        DeleteSearchers();
 
         request = nullptr;
     }
 
-    AiLog log("Remove path request for %s.",
-              UnitsManager_BaseUnits[protect_request->GetClient()->GetUnitType()].singular_name);
+    for (int32_t i = 0; i < pending_requests.GetCount(); ++i) {
+        if ((*pending_requests[i])->request == protect_request) {
+            SDL_AtomicSet(&(*pending_requests[i])->job.is_cancelled, 1);
+        }
+    }
+
+    AILOG(log, "Remove path request for %s.",
+          UnitsManager_BaseUnits[protect_request->GetClient()->GetUnitType()].singular_name);
 
     protect_request->Cancel();
     requests.Remove(*protect_request);
@@ -174,8 +335,8 @@ void PathsManager::RemoveRequest(PathRequest *path_request) {
 void PathsManager::RemoveRequest(UnitInfo *unit) {
     for (SmartList<PathRequest>::Iterator it = requests.Begin(); it != requests.End(); ++it) {
         if ((*it).GetClient() == unit) {
-            AiLog log("Remove path request for %s.",
-                      UnitsManager_BaseUnits[(*it).GetClient()->GetUnitType()].singular_name);
+            AILOG(log, "Remove path request for %s.",
+                  UnitsManager_BaseUnits[(*it).GetClient()->GetUnitType()].singular_name);
 
             (*it).Cancel();
             requests.Remove(it);
@@ -185,6 +346,14 @@ void PathsManager::RemoveRequest(UnitInfo *unit) {
     if (request != nullptr && request->GetClient() == unit) {
         RemoveRequest(&*request);
     }
+
+    for (int32_t i = 0; i < pending_requests.GetCount(); ++i) {
+        PendingRequest *pending_request = *pending_requests[i];
+
+        if (pending_request->request->GetClient() == unit && !SDL_AtomicGet(&pending_request->job.is_cancelled)) {
+            RemoveRequest(&*pending_request->request);
+        }
+    }
 }
 
 void PathsManager::EvaluateTiles() {
@@ -192,11 +361,26 @@ void PathsManager::EvaluateTiles() {
     SmartPointer<GroundPath> ground_path;
     SmartPointer<PathRequest> path_request;
 
+    ++tick_count;
+
+    CollectRequests();
+
+    if (request == nullptr && UseWorkers()) {
+        /* a fixed amount of work per tick instead of the time budget keeps all hosts on the same schedule */
+        for (int32_t i = 0; i < PATHS_MANAGER_SUBMITTED_REQUESTS_PER_TICK && requests.GetCount() &&
+                            pending_requests.GetCount() < PATHS_MANAGER_PENDING_REQUESTS_LIMIT;
+             ++i) {
+            ProcessRequest();
+        }
+
+        return;
+    }
+
     if (request != nullptr) {
         elapsed_time = timer_get() - elapsed_time;
 
         if (backward_searcher == nullptr) {
-            AiLog log("Interrupting path request which was in SimpleFinder");
+            AILOG(log, "Interrupting path request which was in SimpleFinder");
 
             requests.PushFront(*request);
             request = nullptr;
@@ -218,18 +402,20 @@ void PathsManager::EvaluateTiles() {
             }
         }
 
-        AiLog log("Path generator.");
+        AILOG(log, "Path generator.");
 
         unit = request->GetClient();
         path_request = request;
 
+        AiProfiler profiler("paths", "search", unit->GetUnitType(), unit->team);
+
         for (int32_t index = 5;;) {
             MouseEvent::ProcessInput();
             --index;
 
             if (index >= 0) {
                 if (path_request != request) {
-                    log.Log("Path request interrupted inside main loop.");
+                    AILOG_LOG(log, "Path request interrupted inside main loop.");
 
                     return;
                 }
@@ -248,25 +434,44 @@ void PathsManager::EvaluateTiles() {
                         MessageManager_DrawMessage(message, 0, 0);
                     }
 
-                    log.Log("Transcribe path.");
+                    AILOG_LOG(log, "Transcribe path.");
 
                     ground_path =
                         forward_searcher->DeterminePath(Point(unit->grid_x, unit->grid_y), path_request->GetMaxCost());
 
-                    delete forward_searcher;
-                    forward_searcher = nullptr;
+                    if (!ground_path && corridor_map) {
+                        Point position(unit->grid_x, unit->grid_y);
+                        Point destination(request->GetDestination());
+
+                        AILOG_LOG(log, "No path within corridor, fall back to full map search.");
+
+                        corridor_map->Restore(access_map.GetMap());
+
+                        DeleteSearchers();
+
+                        forward_searcher =
+                            new (std::nothrow) Searcher(access_map.GetMap(), position, destination, false);
+                        backward_searcher =
+                            new (std::nothrow) Searcher(access_map.GetMap(), destination, position, false);
+
+                        forward_searcher->Process(position, true);
+                        backward_searcher->Process(destination, false);
+
+                        break;
+                    }
 
-                    delete backward_searcher;
-                    backward_searcher = nullptr;
+                    DeleteSearchers();
 
                     if (ground_path) {
-                        log.Log(
-                            "Found path (%i/%i msecs), %i steps, air distance %i.", timer_elapsed_time(elapsed_time),
-                            timer_elapsed_time(time_stamp), ground_path->GetSteps()->GetCount(),
-                            TaskManager_GetDistance(request->GetDestination(), Point(unit->grid_x, unit->grid_y)) / 2);
+                        AILOG_LOG(log, "Found path (%i/%i msecs), %i steps, air distance %i.",
+                                  timer_elapsed_time(elapsed_time), timer_elapsed_time(time_stamp),
+                                  ground_path->GetSteps()->GetCount(),
+                                  TaskManager_GetDistance(request->GetDestination(),
+                                                          Point(unit->grid_x, unit->grid_y)) /
+                                      2);
 
                     } else {
-                        log.Log("No path, error in transcription.");
+                        AILOG_LOG(log, "No path, error in transcription.");
                     }
 
                     CompleteRequest(&*ground_path);
@@ -284,7 +489,7 @@ void PathsManager::EvaluateTiles() {
         }
 
     } else {
-        AiLog log("Skipping path generator, %i msecs since update.", TickTimer_GetElapsedTime());
+        AILOG(log, "Skipping path generator, %i msecs since update.", TickTimer_GetElapsedTime());
     }
 
     elapsed_time = timer_get() - elapsed_time;
@@ -301,9 +506,21 @@ bool PathsManager::HasRequest(UnitInfo *unit) const {
         return true;
     }
 
+    for (int32_t i = 0; i < pending_requests.GetCount(); ++i) {
+        PendingRequest *pending_request = *pending_requests[i];
+
+        if (pending_request->request->GetClient() == unit && !SDL_AtomicGet(&pending_request->job.is_cancelled)) {
+            return true;
+        }
+    }
+
     return false;
 }
 
+uint32_t PathsManager::GetServedRequestCount() const { return served_request_count; }
+
+const PathsStatistics &PathsManager::GetStatistics() const { return statistics; }
+
 int32_t PathsManager_GetRequestCount(uint16_t team) { return PathsManager_Instance.GetRequestCount(team); }
 
 void PathsManager_RemoveRequest(PathRequest *request) { PathsManager_Instance.RemoveRequest(request); }
@@ -323,29 +540,16 @@ void PathsManager_Clear() {
 
 bool PathsManager_HasRequest(UnitInfo *unit) { return PathsManager_Instance.HasRequest(unit); }
 
-bool PathsManager::Init(UnitInfo *unit) {
-    bool result;
-
-    if (access_map_size != ResourceManager_MapSize) {
-        if (access_map) {
-            for (int32_t i = 0; i < access_map_size.x; ++i) {
-                delete[] access_map[i];
-            }
+uint32_t PathsManager_GetServedRequestCount() { return PathsManager_Instance.GetServedRequestCount(); }
 
-            delete[] access_map;
-            access_map = nullptr;
-        }
+const PathsStatistics &PathsManager_GetStatistics() { return PathsManager_Instance.GetStatistics(); }
 
-        access_map_size = ResourceManager_MapSize;
-
-        access_map = new (std::nothrow) uint8_t *[access_map_size.x];
+bool PathsManager::Init(UnitInfo *unit) {
+    bool result;
 
-        for (int32_t i = 0; i < access_map_size.x; ++i) {
-            access_map[i] = new (std::nothrow) uint8_t[access_map_size.y];
-        }
-    }
+    access_map.Init(ResourceManager_MapSize.x, ResourceManager_MapSize.y);
 
-    PathsManager_InitAccessMap(unit, access_map, request->GetFlags(), request->GetCautionLevel());
+    PathsManager_InitAccessMap(unit, access_map.GetMap(), request->GetFlags(), request->GetCautionLevel());
 
     if (request->GetTransporter()) {
         AccessMap local_access_map;
@@ -476,17 +680,82 @@ bool PathsManager::Init(UnitInfo *unit) {
 void PathsManager::CompleteRequest(GroundPath *path) {
     SmartPointer<PathRequest> path_request(request);
 
-    delete forward_searcher;
-    forward_searcher = nullptr;
+    DeleteSearchers();
 
-    delete backward_searcher;
-    backward_searcher = nullptr;
+    ++served_request_count;
+    Paths_AddStatistics(statistics, Paths_GetStatistics());
 
     request = nullptr;
 
     path_request->Finish(path);
 }
 
+ClusterMap *PathsManager::GetClusterMap(UnitInfo *unit) {
+    ClusterMap *cluster_map = nullptr;
+
+    for (int32_t i = 0; i < PATHS_MANAGER_CLUSTER_MAP_CACHE_ENTRIES; ++i) {
+        if (cluster_maps[i] && cluster_maps[i]->team == unit->team &&
+            cluster_maps[i]->unit_type == unit->GetUnitType() && cluster_maps[i]->flags == request->GetFlags() &&
+            cluster_maps[i]->caution_level == request->GetCautionLevel()) {
+            cluster_map = cluster_maps[i];
+            break;
+        }
+    }
+
+    if (!cluster_map) {
+        int32_t index = 0;
+
+        for (int32_t i = 0; i < PATHS_MANAGER_CLUSTER_MAP_CACHE_ENTRIES; ++i) {
+            if (!cluster_maps[i]) {
+                index = i;
+                break;
+            }
+
+            if (cluster_maps[i]->time_stamp < cluster_maps[index]->time_stamp) {
+                index = i;
+            }
+        }
+
+        if (!cluster_maps[index]) {
+            cluster_maps[index] = new (std::nothrow) ClusterMap();
+        }
+
+        /* a reused entry keeps its previous snapshot, only the clusters that differ get rebuilt */
+        cluster_map = cluster_maps[index];
+        cluster_map->team = unit->team;
+        cluster_map->unit_type = unit->GetUnitType();
+        cluster_map->flags = request->GetFlags();
+        cluster_map->caution_level = request->GetCautionLevel();
+    }
+
+    cluster_map->time_stamp = ++cluster_map_time_stamp;
+
+    return cluster_map;
+}
+
+void PathsManager::ApplyCorridor(ClusterMap *cluster_map, Point position, Point destination) {
+    bool *corridor = new (std::nothrow) bool[cluster_map->GetClusterCount()];
+
+    if (cluster_map->FindCorridor(position, destination, corridor)) {
+        int32_t cluster_count = 0;
+
+        for (int32_t i = 0; i < cluster_map->GetClusterCount(); ++i) {
+            if (corridor[i]) {
+                ++cluster_count;
+            }
+        }
+
+        AILOG(log, "Limit search to a corridor of %i out of %i clusters.", cluster_count,
+              cluster_map->GetClusterCount());
+
+        cluster_map->ApplyCorridor(access_map.GetMap(), corridor);
+
+        corridor_map = cluster_map;
+    }
+
+    delete[] corridor;
+}
+
 void PathsManager::ProcessRequest() {
     if (requests.GetCount()) {
         SmartList<PathRequest>::Iterator it = requests.Begin();
@@ -494,6 +763,7 @@ void PathsManager::ProcessRequest() {
         requests.Remove(it);
 
         SmartPointer<UnitInfo> unit(request->GetClient());
+        AiProfiler profiler("paths", "init request", unit->GetUnitType(), unit->team);
 
         Point destination(request->GetDestination());
         Point position(unit->grid_x, unit->grid_y);
@@ -502,22 +772,17 @@ void PathsManager::ProcessRequest() {
             request = nullptr;
 
         } else {
-            AiLog log("Start Search for path for %s at [%i,%i] to [%i,%i].",
-                      UnitsManager_BaseUnits[unit->GetUnitType()].singular_name, position.x + 1, position.y + 1,
-                      destination.x + 1, destination.y + 1);
+            AILOG(log, "Start Search for path for %s at [%i,%i] to [%i,%i].",
+                  UnitsManager_BaseUnits[unit->GetUnitType()].singular_name, position.x + 1, position.y + 1,
+                  destination.x + 1, destination.y + 1);
 
             time_stamp = timer_get();
             elapsed_time = time_stamp;
 
-            Paths_EvaluatedTileCount = 0;
-            Paths_EvaluatorCallCount = 0;
-            Paths_SquareAdditionsCount = 0;
-            Paths_EvaluatedSquareCount = 0;
-            Paths_SquareInsertionsCount = 0;
-            Paths_MaxDepth = 0;
+            Paths_ResetStatistics();
 
             if (position == destination) {
-                log.Log("Start and destination are the same.");
+                AILOG_LOG(log, "Start and destination are the same.");
 
                 CompleteRequest(nullptr);
 
@@ -533,29 +798,51 @@ void PathsManager::ProcessRequest() {
                             mode = false;
                         }
 
-                        log.Log("Checking if destination is reachable.");
+                        ClusterMap *cluster_map = nullptr;
+                        const bool use_workers = UseWorkers();
+
+                        /* worker searches run on a private map copy that cannot fall back to the full map */
+                        if (!request->GetTransporter() && !use_workers &&
+                            Access_GetDistance(position, destination) > PATHS_MANAGER_HIERARCHICAL_SEARCH_DISTANCE) {
+                            /* the cluster map takes its snapshot before the flood fill marks reachable tiles */
+                            cluster_map = GetClusterMap(&*unit);
+                            cluster_map->Update(access_map.GetMap());
+                        }
+
+                        AILOG_LOG(log, "Checking if destination is reachable.");
 
                         SmartPointer<PathRequest> path_request(request);
 
-                        PathFill path_fill(access_map);
+                        PathFill path_fill(access_map.GetMap());
 
                         path_fill.Fill(position);
 
                         if (access_map[destination.x][destination.y] & 0x20) {
-                            forward_searcher = new (std::nothrow) Searcher(position, destination, mode);
-                            backward_searcher = new (std::nothrow) Searcher(destination, position, mode);
+                            if (cluster_map) {
+                                ApplyCorridor(cluster_map, position, destination);
+                            }
+
+                            if (use_workers) {
+                                SubmitRequest(position, destination, mode);
+
+                            } else {
+                                forward_searcher =
+                                    new (std::nothrow) Searcher(access_map.GetMap(), position, destination, mode);
+                                backward_searcher =
+                                    new (std::nothrow) Searcher(access_map.GetMap(), destination, position, mode);
 
-                            forward_searcher->Process(position, true);
-                            backward_searcher->Process(destination, false);
+                                forward_searcher->Process(position, true);
+                                backward_searcher->Process(destination, false);
+                            }
 
                         } else {
-                            log.Log("Path not found (%i msecs).", timer_elapsed_time(time_stamp));
+                            AILOG_LOG(log, "Path not found (%i msecs).", timer_elapsed_time(time_stamp));
 
                             CompleteRequest(nullptr);
                         }
 
                     } else {
-                        log.Log("No valid destination found (%i msecs).", timer_elapsed_time(time_stamp));
+                        AILOG_LOG(log, "No valid destination found (%i msecs).", timer_elapsed_time(time_stamp));
 
                         CompleteRequest(nullptr);
                     }
@@ -710,7 +997,7 @@ void PathsManager_ProcessGroundCover(uint8_t **map, UnitInfo *unit, int32_t surf
 }
 
 void PathsManager_InitAccessMap(UnitInfo *unit, uint8_t **map, uint8_t flags, int32_t caution_level) {
-    AiLog log("Mark cost map for %s.", UnitsManager_BaseUnits[unit->GetUnitType()].singular_name);
+    AILOG(log, "Mark cost map for %s.", UnitsManager_BaseUnits[unit->GetUnitType()].singular_name);
 
     if (unit->flags & MOBILE_AIR_UNIT) {
         for (int32_t i = 0; i < ResourceManager_MapSize.x; ++i) {
@@ -753,7 +1040,7 @@ void PathsManager_InitAccessMap(UnitInfo *unit, uint8_t **map, uint8_t flags, in
     }
 }
 
-uint8_t **PathsManager_GetAccessMap() { return PathsManager_Instance.access_map; }
+uint8_t **PathsManager_GetAccessMap() { return PathsManager_Instance.access_map.GetMap(); }
 
 void PathsManager_ApplyCautionLevel(uint8_t **map, UnitInfo *unit, int32_t caution_level) {
     if (caution_level > 0) {
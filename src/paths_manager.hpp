@@ -38,5 +38,7 @@ void PathsManager_InitAccessMap(UnitInfo* unit, uint8_t** map, uint8_t flags, in
 uint8_t** PathsManager_GetAccessMap();
 void PathsManager_ApplyCautionLevel(uint8_t** map, UnitInfo* unit, int32_t caution_level);
 void PathsManager_SetPathDebugMode();
+uint32_t PathsManager_GetServedRequestCount();
+const PathsStatistics& PathsManager_GetStatistics();
 
 #endif /* PATHS_MANAGER_HPP */
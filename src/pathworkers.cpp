@@ -0,0 +1,197 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "pathworkers.hpp"
+
+#include "aiprofiler.hpp"
+#include "paths.hpp"
+#include "searcher.hpp"
+
+#define PATHWORKERS_MAX_THREADS 8
+#define PATHWORKERS_CANCEL_CHECK_PERIOD 64
+
+PathWorkers::PathWorkers()
+    : threads(nullptr),
+      thread_count(0),
+      mutex(nullptr),
+      condition(nullptr),
+      finished_condition(nullptr),
+      exit_threads(false),
+      is_inited(false) {}
+
+PathWorkers::~PathWorkers() { Deinit(); }
+
+bool PathWorkers::Init(int32_t count) {
+    Deinit();
+
+    is_inited = true;
+
+    if (count > PATHWORKERS_MAX_THREADS) {
+        count = PATHWORKERS_MAX_THREADS;
+    }
+
+    if (count > 0) {
+        mutex = SDL_CreateMutex();
+        condition = SDL_CreateCond();
+        finished_condition = SDL_CreateCond();
+
+        if (mutex && condition && finished_condition) {
+            threads = new (std::nothrow) SDL_Thread *[count];
+            exit_threads = false;
+
+            for (int32_t i = 0; i < count; ++i) {
+                threads[thread_count] = SDL_CreateThread(&PathWorkers::Worker, "PathWorker", this);
+
+                if (threads[thread_count]) {
+                    ++thread_count;
+                }
+            }
+        }
+
+        if (thread_count == 0) {
+            Deinit();
+
+            is_inited = true;
+        }
+    }
+
+    return thread_count > 0;
+}
+
+void PathWorkers::Deinit() {
+    if (thread_count > 0) {
+        SDL_LockMutex(mutex);
+        exit_threads = true;
+        SDL_CondBroadcast(condition);
+        SDL_UnlockMutex(mutex);
+
+        for (int32_t i = 0; i < thread_count; ++i) {
+            SDL_WaitThread(threads[i], nullptr);
+        }
+    }
+
+    delete[] threads;
+    threads = nullptr;
+    thread_count = 0;
+
+    if (condition) {
+        SDL_DestroyCond(condition);
+        condition = nullptr;
+    }
+
+    if (finished_condition) {
+        SDL_DestroyCond(finished_condition);
+        finished_condition = nullptr;
+    }
+
+    if (mutex) {
+        SDL_DestroyMutex(mutex);
+        mutex = nullptr;
+    }
+
+    /* jobs that were never picked up are dropped, the owner releases them */
+    jobs.Clear();
+
+    exit_threads = false;
+    is_inited = false;
+}
+
+bool PathWorkers::IsInited() const { return is_inited; }
+
+int32_t PathWorkers::GetThreadCount() const { return thread_count; }
+
+void PathWorkers::Submit(PathJob *job) {
+    SDL_assert(thread_count > 0);
+
+    job->is_finished = false;
+    job->statistics = {};
+
+    SDL_LockMutex(mutex);
+    jobs.Append(&job);
+    SDL_CondSignal(condition);
+    SDL_UnlockMutex(mutex);
+}
+
+void PathWorkers::Wait(PathJob *job) {
+    SDL_LockMutex(mutex);
+
+    while (!job->is_finished) {
+        SDL_CondWait(finished_condition, mutex);
+    }
+
+    SDL_UnlockMutex(mutex);
+}
+
+void PathWorkers::Search(PathJob *job) {
+    AiProfiler profiler("paths", "worker search");
+
+    Paths_ResetStatistics();
+
+    /* same iteration order as the cooperative path generator so that both produce identical paths */
+    for (int32_t index = 1;; ++index) {
+        job->backward_searcher->BackwardSearch(job->forward_searcher);
+
+        if (!job->forward_searcher->ForwardSearch(job->backward_searcher)) {
+            break;
+        }
+
+        if (index % PATHWORKERS_CANCEL_CHECK_PERIOD == 0 && SDL_AtomicGet(&job->is_cancelled)) {
+            break;
+        }
+    }
+
+    job->statistics = Paths_GetStatistics();
+}
+
+int PathWorkers::Worker(void *data) noexcept {
+    PathWorkers *workers = reinterpret_cast<PathWorkers *>(data);
+
+    SDL_LockMutex(workers->mutex);
+
+    for (;;) {
+        while (!workers->exit_threads && workers->jobs.GetCount() == 0) {
+            SDL_CondWait(workers->condition, workers->mutex);
+        }
+
+        if (workers->exit_threads) {
+            break;
+        }
+
+        PathJob *job = *workers->jobs[0];
+        workers->jobs.Remove(0);
+
+        SDL_UnlockMutex(workers->mutex);
+
+        if (!SDL_AtomicGet(&job->is_cancelled)) {
+            Search(job);
+        }
+
+        SDL_LockMutex(workers->mutex);
+
+        job->is_finished = true;
+
+        SDL_CondBroadcast(workers->finished_condition);
+    }
+
+    SDL_UnlockMutex(workers->mutex);
+
+    return 0;
+}
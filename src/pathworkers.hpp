@@ -0,0 +1,73 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef PATHWORKERS_HPP
+#define PATHWORKERS_HPP
+
+#include <SDL_assert.h>
+#include <SDL_atomic.h>
+#include <SDL_mutex.h>
+#include <SDL_thread.h>
+
+#include "paths.hpp"
+#include "smartobjectarray.hpp"
+
+class Searcher;
+
+/// Bidirectional search of a single path request. The searchers must be set up by the owner and must operate on an
+/// access map that is not touched by the main thread while the job is in flight.
+struct PathJob {
+    Searcher *forward_searcher;
+    Searcher *backward_searcher;
+    SDL_atomic_t is_cancelled;
+    bool is_finished;
+    PathsStatistics statistics;
+};
+
+/// Pool of worker threads that run path searches in the background. Jobs are taken in submission order, but may
+/// finish in any order. The owner decides when and in which order finished jobs are handed back to the game and may
+/// Wait for a job that is due.
+class PathWorkers {
+    SDL_Thread **threads;
+    int32_t thread_count;
+    SDL_mutex *mutex;
+    SDL_cond *condition;
+    SDL_cond *finished_condition;
+    ObjectArray<PathJob *> jobs;
+    bool exit_threads;
+    bool is_inited;
+
+    static int Worker(void *data) noexcept;
+    static void Search(PathJob *job);
+
+public:
+    PathWorkers();
+    ~PathWorkers();
+
+    bool Init(int32_t count);
+    void Deinit();
+    bool IsInited() const;
+    int32_t GetThreadCount() const;
+    void Submit(PathJob *job);
+    void Wait(PathJob *job);
+};
+
+#endif /* PATHWORKERS_HPP */
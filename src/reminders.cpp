@@ -23,6 +23,7 @@
 
 #include "aiattack.hpp"
 #include "ailog.hpp"
+#include "aiprofiler.hpp"
 #include "task_manager.hpp"
 #include "taskdebugger.hpp"
 #include "unitinfo.hpp"
@@ -39,7 +40,8 @@ RemindTurnStart::~RemindTurnStart() {}
 void RemindTurnStart::Execute() {
     char buffer[500];
 
-    AiLog log("Begin turn for %s", task->WriteStatusLog(buffer));
+    AILOG(log, "Begin turn for %s", task->WriteStatusLog(buffer));
+    AiProfiler profiler("begin turn", TaskManager_GetTaskName(&*task), INVALID_ID, task->GetTeam());
 
     task->ChangeIsScheduledForTurnStart(false);
     TaskDebugger_DebugBreak(task->GetId());
@@ -55,7 +57,8 @@ RemindTurnEnd::~RemindTurnEnd() {}
 void RemindTurnEnd::Execute() {
     char buffer[500];
 
-    AiLog log("End turn for %s", task->WriteStatusLog(buffer));
+    AILOG(log, "End turn for %s", task->WriteStatusLog(buffer));
+    AiProfiler profiler("end turn", TaskManager_GetTaskName(&*task), INVALID_ID, task->GetTeam());
 
     task->ChangeIsScheduledForTurnEnd(false);
     TaskDebugger_DebugBreak(task->GetId());
@@ -90,7 +93,8 @@ void RemindMoveFinished::Execute() {
     if (task && unit->hits > 0) {
         char buffer[500];
 
-        AiLog log("Move finished reminder for %s", task->WriteStatusLog(buffer));
+        AILOG(log, "Move finished reminder for %s", task->WriteStatusLog(buffer));
+        AiProfiler profiler("execute", TaskManager_GetTaskName(task), unit->GetUnitType(), task->GetTeam());
 
         task->Execute(*unit);
     }
@@ -107,7 +111,7 @@ void RemindAttack::Execute() {
         if (unit->GetTask()) {
             char buffer[500];
 
-            AiLog log("Attack reminder for %s", unit->GetTask()->WriteStatusLog(buffer));
+            AILOG(log, "Attack reminder for %s", unit->GetTask()->WriteStatusLog(buffer));
         }
 
         AiAttack_EvaluateAttack(&*unit);
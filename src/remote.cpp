@@ -32,6 +32,7 @@
 #include "menu.hpp"
 #include "message_manager.hpp"
 #include "mouseevent.hpp"
+#include "net_packet_batch.hpp"
 #include "networkmenu.hpp"
 #include "sound_manager.hpp"
 #include "ticktimer.hpp"
@@ -117,6 +118,12 @@ static NetPacket Remote_P23_Packet;
 static bool Remote_P24_Signals[TRANSPORT_MAX_TEAM_COUNT];
 static bool Remote_P49_Signal;
 static bool Remote_P51_Signal;
+static int32_t Remote_FrameDepth;
+static int32_t Remote_TxBatchMode;
+static NetPacketBatch Remote_TxBatch(REMOTE_PACKET_53);
+static NetPacket Remote_RxBatch;
+static NetPacketBatch* Remote_RxBatchDecoder;
+static std::unordered_map<uint64_t, NetPacketBatch> Remote_RxBatchDecoders;
 
 static OrderProcessor Remote_OrderProcessors[ORDER_COUNT_MAX];
 
@@ -564,17 +571,113 @@ void Remote_Init() {
 static bool Remote_ReceivePacket(NetPacket& packet) {
     bool result;
 
-    if (Remote_Transport->ReceivePacket(packet)) {
-        if (packet.GetDataSize() < 3) {
-            AiLog log("Remote: Dropped malformed packet (size: %i).\n", packet.GetDataSize());
-            result = false;
+    for (;;) {
+        if (Remote_RxBatch.GetDataSize() > 0) {
+            result = Remote_RxBatchDecoder->Extract(Remote_RxBatch, packet);
+
+            if (!result) {
+                AiLog log("Remote: Dropped malformed packet batch.\n");
+
+                Remote_RxBatch.Reset();
+            }
 
         } else {
-            result = true;
+            result = Remote_Transport->ReceivePacket(packet);
         }
 
-    } else {
-        result = false;
+        if (result) {
+            uint8_t packet_type;
+
+            if (packet.GetDataSize() < 3) {
+                AiLog log("Remote: Dropped malformed packet (size: %i).\n", packet.GetDataSize());
+                result = false;
+
+            } else if (packet.Peek(0, &packet_type, sizeof(packet_type)) && packet_type == REMOTE_PACKET_53) {
+                const NetAddress& address = packet.GetAddress(REMOTE_RECEIVED_ADDRESS);
+                const uint64_t key = (static_cast<uint64_t>(address.host) << 16) | address.port;
+
+                // every sender encodes against its own references
+                Remote_RxBatchDecoder = &Remote_RxBatchDecoders.try_emplace(key, REMOTE_PACKET_53).first->second;
+
+                Remote_RxBatch.Swap(packet);
+                Remote_RxBatch >> packet_type;
+
+                continue;
+            }
+        }
+
+        break;
+    }
+
+    return result;
+}
+
+void Remote_BeginFrame() { ++Remote_FrameDepth; }
+
+void Remote_EndFrame() {
+    SDL_assert(Remote_FrameDepth > 0);
+
+    if (--Remote_FrameDepth == 0) {
+        Remote_FlushPackets();
+    }
+}
+
+void Remote_FlushPackets() {
+    if (Remote_TxBatch.GetCount() > 0) {
+        if (Remote_Transport && !Remote_Transport->TransmitPacket(Remote_TxBatch.GetPacket())) {
+            /// \todo Handle transport layer errors
+            Remote_Transport->GetError();
+
+            /* the receivers never saw the references of this batch, later deltas must not be based on them */
+            Remote_TxBatch.Reset();
+
+        } else {
+            Remote_TxBatch.Clear();
+        }
+    }
+}
+
+static bool Remote_BatchPacket(NetPacket& packet, int32_t transmit_mode) {
+    NetPacket& batch = Remote_TxBatch.GetPacket();
+    uint8_t packet_type;
+    bool is_first_packet;
+    bool delta_encode;
+    bool result;
+
+    if (Remote_TxBatch.GetCount() > 0) {
+        bool is_same_destination = transmit_mode == Remote_TxBatchMode &&
+                                   packet.GetAddressCount() == batch.GetAddressCount();
+
+        for (uint16_t i = 0; is_same_destination && i < packet.GetAddressCount(); ++i) {
+            is_same_destination = packet.GetAddress(i) == batch.GetAddress(i);
+        }
+
+        if (!is_same_destination) {
+            Remote_FlushPackets();
+        }
+    }
+
+    is_first_packet = Remote_TxBatch.GetCount() == 0;
+
+    (void)packet.Peek(0, &packet_type, sizeof(packet_type));
+
+    // unit state packets reach every node in order, so they are delta encoded against the previous state
+    delta_encode =
+        transmit_mode == REMOTE_MULTICAST && (packet_type == REMOTE_PACKET_08 || packet_type == REMOTE_PACKET_23);
+
+    result = Remote_TxBatch.Add(packet, delta_encode);
+
+    // the destination is taken over only once the batch holds a packet, a rejected packet leaves the batch empty
+    if (result && is_first_packet) {
+        Remote_TxBatchMode = transmit_mode;
+
+        for (uint16_t i = 0; i < packet.GetAddressCount(); ++i) {
+            batch.AddAddress(packet.GetAddress(i));
+        }
+    }
+
+    if (Remote_TxBatch.GetDataSize() >= NET_PACKET_BATCH_SIZE_LIMIT) {
+        Remote_FlushPackets();
     }
 
     return result;
@@ -603,6 +706,15 @@ static void Remote_TransmitPacket(NetPacket& packet, int32_t transmit_mode) {
         } break;
     }
 
+    // packets of a game frame are coalesced, packets sent outside of frames or too large for a batch go out directly
+    if (Remote_FrameDepth > 0) {
+        if (Remote_BatchPacket(packet, transmit_mode)) {
+            return;
+        }
+
+        Remote_FlushPackets();
+    }
+
     if (!Remote_Transport->TransmitPacket(packet)) {
         /// \todo Handle transport layer errors
         Remote_Transport->GetError();
@@ -610,6 +722,13 @@ static void Remote_TransmitPacket(NetPacket& packet, int32_t transmit_mode) {
 }
 
 void Remote_Deinit() {
+    Remote_FlushPackets();
+
+    Remote_TxBatch.Reset();
+    Remote_RxBatch.Reset();
+    Remote_RxBatchDecoder = nullptr;
+    Remote_RxBatchDecoders.clear();
+
     if (Remote_Transport) {
         Remote_Transport->Deinit();
 
@@ -778,6 +897,9 @@ void Remote_RegisterMenu(NetworkMenu* menu) {
 }
 
 void Remote_ProcessNetPackets() {
+    // peers may be waiting for the packets of the current frame
+    Remote_FlushPackets();
+
     for (;;) {
         NetPacket packet;
         uint8_t packet_type;
@@ -1876,9 +1998,9 @@ void Remote_ReceiveNetPacket_16(NetPacket& packet) {
     packet >> file_name;
     packet >> file_title;
 
-    SaveLoadMenu_Save(file_name.GetCStr(), file_title.GetCStr(), true);
-
-    MessageManager_DrawMessage(_(87d7), 1, 0);
+    if (SaveLoadMenu_Save(file_name.GetCStr(), file_title.GetCStr(), true)) {
+        MessageManager_DrawMessage(_(87d7), 1, 0);
+    }
 }
 
 void Remote_SendNetPacket_17() {
@@ -82,6 +82,7 @@ enum : uint8_t {
     REMOTE_PACKET_50,
     REMOTE_PACKET_51,
     REMOTE_PACKET_52,
+    REMOTE_PACKET_53,
 };
 
 void Remote_Deinit();
@@ -92,6 +93,9 @@ bool Remote_UiProcessTick(bool mode = false);
 bool Remote_CheckRestartAfterDesyncEvent();
 void Remote_RegisterMenu(NetworkMenu* menu);
 void Remote_ProcessNetPackets();
+void Remote_BeginFrame();
+void Remote_EndFrame();
+void Remote_FlushPackets();
 void Remote_AnalyzeDesync();
 int32_t Remote_CheckUnpauseEvent();
 void Remote_Synchronize(bool mode = false);
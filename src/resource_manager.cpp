@@ -27,20 +27,25 @@
 
 #include "access.hpp"
 #include "assertmenu.hpp"
+#include "assetloader.hpp"
 #include "cursor.hpp"
 #include "drawloadbar.hpp"
 #include "game_manager.hpp"
 #include "gfx.hpp"
 #include "hash.hpp"
+#include "headless.hpp"
 #include "inifile.hpp"
 #include "localization.hpp"
 #include "menu.hpp"
 #include "message_manager.hpp"
 #include "missionregistry.hpp"
+#include "resourcemap.hpp"
+#include "saveload.hpp"
 #include "screendump.h"
 #include "scripter.hpp"
 #include "sha2.h"
 #include "sound_manager.hpp"
+#include "survey.hpp"
 #include "units_manager.hpp"
 #include "window_manager.hpp"
 
@@ -66,6 +71,7 @@ struct GameResourceMeta {
     ResourceID res_file_item_index;
     uint8_t *resource_buffer;
     uint8_t res_file_id;
+    bool is_mapped;
 };
 
 static constexpr int32_t ResourceManager_MinimumMemory = 6;
@@ -76,6 +82,7 @@ static std::unique_ptr<std::ofstream> ResourceManager_LogFile;
 static std::unique_ptr<MissionRegistry> ResourceManager_MissionRegistry;
 
 FILE *res_file_handle_array[2];
+static ResourceMap ResourceManager_ResFileMaps[2];
 struct res_index *ResourceManager_ResItemTable;
 struct GameResourceMeta *ResourceManager_ResMetaTable;
 uint8_t ResourceManager_ResFileCount;
@@ -379,7 +386,20 @@ static int32_t ResourceManager_BuildResourceTable(const char *const cstr, const
 static int32_t ResourceManager_BuildColorTables();
 static void ResourceManager_InitMinimapResources();
 static void ResourceManager_InitMainmapResources();
-static bool ResourceManager_LoadMapTiles(FILE *fp, DrawLoadBar *loadbar);
+struct ResourceManager_MapTileJob {
+    uint8_t *source;
+    uint8_t *destination;
+    int32_t tile_count;
+};
+
+static bool ResourceManager_LoadMapTiles(FILE *fp, DrawLoadBar *loadbar, AssetLoader *loader,
+                                         ResourceManager_MapTileJob *jobs);
+static void ResourceManager_ScaleMapTiles(void *data);
+static void ResourceManager_BuildSurfaceMap(void *data);
+static void ResourceManager_BuildFilterTables(void *data);
+static void ResourceManager_BuildWorldTables(void *data);
+static void ResourceManager_BuildDimTable(void *data);
+static void ResourceManager_BuildFadeTable(void *data);
 static void ResourceManager_SetClanUpgrades(int32_t clan, ResourceID unit_type, UnitValues *unit_values);
 static SDL_AssertState SDLCALL ResourceManager_AssertionHandler(const SDL_AssertData *data, void *userdata);
 static void ResourceManager_LogOutputHandler(void *userdata, int category, SDL_LogPriority priority,
@@ -645,6 +665,11 @@ void ResourceManager_InitResources() {
 void ResourceManager_InitSDL() {
     SDL_LogSetOutputFunction(&ResourceManager_LogOutputHandler, nullptr);
 
+    if (Headless_IsEnabled()) {
+        SDL_SetHint(SDL_HINT_VIDEODRIVER, "dummy");
+        SDL_SetHint(SDL_HINT_AUDIODRIVER, "dummy");
+    }
+
     if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_TIMER) != 0) {
         SDL_Log("%s", _(438a));
         SDL_Log("%s", SDL_GetError());
@@ -724,7 +749,10 @@ void ResourceManager_InitInternals() {
 
     ResourceManager_DisableEnhancedGraphics = !ini_get_setting(INI_ENHANCED_GRAPHICS);
 
-    SoundManager_Init();
+    if (!Headless_IsEnabled()) {
+        SoundManager_Init();
+    }
+
     register_pause(-1, nullptr);
     register_screendump(GNW_KB_KEY_LALT_C, screendump_pcx);
 }
@@ -740,6 +768,7 @@ void ResourceManager_ExitGame(int32_t error_code) {
         menu_draw_exit_logos();
     }
 
+    SaveLoad_WaitForSave();
     SoundManager_Deinit();
     win_exit();
     Svga_Deinit();
@@ -755,6 +784,7 @@ int32_t ResourceManager_InitResManager() {
     if (ResourceManager_ResMetaTable) {
         for (int32_t i = 0; i < RESOURCE_E; i++) {
             ResourceManager_ResMetaTable[i].resource_buffer = nullptr;
+            ResourceManager_ResMetaTable[i].is_mapped = false;
             ResourceManager_ResMetaTable[i].res_file_item_index = INVALID_ID;
         }
 
@@ -802,21 +832,30 @@ uint8_t *ResourceManager_ReadResource(ResourceID id) {
         if (ResourceManager_ResMetaTable[id].res_file_item_index == INVALID_ID) {
             resource_buffer = nullptr;
         } else {
-            FILE *fp = res_file_handle_array[ResourceManager_ResMetaTable[id].res_file_id];
+            const uint8_t res_file_id = ResourceManager_ResMetaTable[id].res_file_id;
             int32_t data_size =
                 ResourceManager_ResItemTable[ResourceManager_ResMetaTable[id].res_file_item_index].data_size;
             int32_t data_offset =
                 ResourceManager_ResItemTable[ResourceManager_ResMetaTable[id].res_file_item_index].data_offset;
 
-            fseek(fp, data_offset, SEEK_SET);
-
             uint8_t *buffer = new (std::nothrow) uint8_t[data_size + sizeof('\0')];
             if (!buffer) {
                 ResourceManager_ExitGame(EXIT_CODE_INSUFFICIENT_MEMORY);
             }
 
-            if (!fread(buffer, data_size, 1, fp)) {
-                ResourceManager_ExitGame(EXIT_CODE_CANNOT_READ_RES_FILE);
+            const uint8_t *view = ResourceManager_ResFileMaps[res_file_id].GetData(data_offset, data_size);
+
+            if (view) {
+                memcpy(buffer, view, data_size);
+
+            } else {
+                FILE *fp = res_file_handle_array[res_file_id];
+
+                fseek(fp, data_offset, SEEK_SET);
+
+                if (!fread(buffer, data_size, 1, fp)) {
+                    ResourceManager_ExitGame(EXIT_CODE_CANNOT_READ_RES_FILE);
+                }
             }
 
             buffer[data_size] = '\0';
@@ -839,21 +878,32 @@ uint8_t *ResourceManager_LoadResource(ResourceID id) {
             resource_buffer = nullptr;
         } else {
             if ((resource_buffer = ResourceManager_ResMetaTable[id].resource_buffer) == nullptr) {
-                FILE *fp = res_file_handle_array[ResourceManager_ResMetaTable[id].res_file_id];
+                const uint8_t res_file_id = ResourceManager_ResMetaTable[id].res_file_id;
                 int32_t data_size =
                     ResourceManager_ResItemTable[ResourceManager_ResMetaTable[id].res_file_item_index].data_size;
                 int32_t data_offset =
                     ResourceManager_ResItemTable[ResourceManager_ResMetaTable[id].res_file_item_index].data_offset;
 
-                fseek(fp, data_offset, SEEK_SET);
+                /* cached resources are served as copy-on-write views into the mapped resource file, callers that
+                 * modify a resource in place only pay for the pages they touch */
+                resource_buffer = ResourceManager_ResFileMaps[res_file_id].GetData(data_offset, data_size);
 
-                resource_buffer = new (std::nothrow) uint8_t[data_size];
-                if (!resource_buffer) {
-                    ResourceManager_ExitGame(EXIT_CODE_INSUFFICIENT_MEMORY);
-                }
+                if (resource_buffer) {
+                    ResourceManager_ResMetaTable[id].is_mapped = true;
 
-                if (!fread(resource_buffer, data_size, 1, fp)) {
-                    ResourceManager_ExitGame(EXIT_CODE_CANNOT_READ_RES_FILE);
+                } else {
+                    FILE *fp = res_file_handle_array[res_file_id];
+
+                    fseek(fp, data_offset, SEEK_SET);
+
+                    resource_buffer = new (std::nothrow) uint8_t[data_size];
+                    if (!resource_buffer) {
+                        ResourceManager_ExitGame(EXIT_CODE_INSUFFICIENT_MEMORY);
+                    }
+
+                    if (!fread(resource_buffer, data_size, 1, fp)) {
+                        ResourceManager_ExitGame(EXIT_CODE_CANNOT_READ_RES_FILE);
+                    }
                 }
 
                 ResourceManager_ResMetaTable[id].resource_buffer = resource_buffer;
@@ -885,14 +935,23 @@ int32_t ResourceManager_ReadImageHeader(ResourceID id, struct ImageBigHeader *bu
     if (id == INVALID_ID || ResourceManager_ResMetaTable[id].res_file_item_index == INVALID_ID) {
         result = false;
     } else {
-        FILE *fp = res_file_handle_array[ResourceManager_ResMetaTable[id].res_file_id];
+        const uint8_t res_file_id = ResourceManager_ResMetaTable[id].res_file_id;
         int32_t data_offset =
             ResourceManager_ResItemTable[ResourceManager_ResMetaTable[id].res_file_item_index].data_offset;
+        const uint8_t *view =
+            ResourceManager_ResFileMaps[res_file_id].GetData(data_offset, sizeof(struct ImageBigHeader));
 
-        fseek(fp, data_offset, SEEK_SET);
+        if (view) {
+            memcpy(buffer, view, sizeof(struct ImageBigHeader));
 
-        if (!fread(buffer, sizeof(struct ImageBigHeader), 1, fp)) {
-            ResourceManager_ExitGame(EXIT_CODE_CANNOT_READ_RES_FILE);
+        } else {
+            FILE *fp = res_file_handle_array[res_file_id];
+
+            fseek(fp, data_offset, SEEK_SET);
+
+            if (!fread(buffer, sizeof(struct ImageBigHeader), 1, fp)) {
+                ResourceManager_ExitGame(EXIT_CODE_CANNOT_READ_RES_FILE);
+            }
         }
 
         result = true;
@@ -982,12 +1041,16 @@ ResourceID ResourceManager_GetResourceID(int32_t index) {
 
 void ResourceManager_Realloc(ResourceID id, uint8_t *buffer, int32_t data_size) {
     if (ResourceManager_ResMetaTable[id].resource_buffer) {
-        delete[] ResourceManager_ResMetaTable[id].resource_buffer;
+        if (!ResourceManager_ResMetaTable[id].is_mapped) {
+            delete[] ResourceManager_ResMetaTable[id].resource_buffer;
+        }
+
         resource_buffer_size -=
             ResourceManager_ResItemTable[ResourceManager_ResMetaTable[id].res_file_item_index].data_size;
     }
 
     ResourceManager_ResMetaTable[id].resource_buffer = buffer;
+    ResourceManager_ResMetaTable[id].is_mapped = false;
     resource_buffer_size += data_size;
 }
 
@@ -1008,11 +1071,20 @@ void ResourceManager_FreeResources() {
 
     for (int16_t i = 0; i < MEM_END; ++i) {
         if (ResourceManager_ResMetaTable[i].resource_buffer) {
-            delete[] ResourceManager_ResMetaTable[i].resource_buffer;
+            if (!ResourceManager_ResMetaTable[i].is_mapped) {
+                delete[] ResourceManager_ResMetaTable[i].resource_buffer;
+            }
+
             ResourceManager_ResMetaTable[i].resource_buffer = nullptr;
+            ResourceManager_ResMetaTable[i].is_mapped = false;
         }
     }
 
+    /* drop pages that were privately modified through resource views so that reloaded resources are pristine */
+    for (int32_t i = 0; i < ResourceManager_ResFileCount; ++i) {
+        ResourceManager_ResFileMaps[i].Reset();
+    }
+
     for (int16_t j = 0; j < UNIT_END; ++j) {
         UnitsManager_BaseUnits[j].sprite = nullptr;
         UnitsManager_BaseUnits[j].shadows = nullptr;
@@ -1138,6 +1210,10 @@ int32_t ResourceManager_BuildResourceTable(const char *const cstr, const Resourc
                         }
 
                         ResourceManager_ResItemCount = new_item_count;
+
+                        /* failing to map the file is not fatal, resources are read through the file handle then */
+                        ResourceManager_ResFileMaps[ResourceManager_ResFileCount].Open(fp);
+
                         ++ResourceManager_ResFileCount;
                         result = EXIT_CODE_NO_ERROR;
                     } else {
@@ -1281,6 +1357,10 @@ void ResourceManager_InitInGameAssets(int32_t world) {
     int32_t file_position;
     int32_t file_offset;
     uint16_t map_tile_count = 0;
+    AssetLoader loader;
+    ResourceManager_MapTileJob map_tile_jobs[8];
+    uint8_t *pass_table;
+    int32_t fade_table_rows[7];
 
     ini_set_setting(INI_WORLD, world);
 
@@ -1301,12 +1381,17 @@ void ResourceManager_InitInGameAssets(int32_t world) {
     delete[] ResourceManager_MapTileBuffer;
     ResourceManager_MapTileBuffer = nullptr;
 
+    Gfx_ResetMapTileCache();
+    Gfx_ResetSpriteCache();
+
     delete[] ResourceManager_MapSurfaceMap;
     ResourceManager_MapSurfaceMap = nullptr;
 
     delete[] ResourceManager_CargoMap;
     ResourceManager_CargoMap = nullptr;
 
+    Survey_FreeResourceTables();
+
     delete[] ResourceManager_MinimapBgImage;
     ResourceManager_MinimapBgImage = nullptr;
 
@@ -1437,14 +1522,14 @@ void ResourceManager_InitInGameAssets(int32_t world) {
     }
 
     if (1 != fread(&ResourceManager_MapTileCount, sizeof(ResourceManager_MapTileCount), 1, fp) ||
-        !ResourceManager_LoadMapTiles(fp, &load_bar)) {
+        !ResourceManager_LoadMapTiles(fp, &load_bar, &loader, map_tile_jobs)) {
         ResourceManager_ExitGame(EXIT_CODE_CANNOT_READ_RES_FILE);
     }
 
     {
         uint8_t *palette;
 
-        progress_bar_value = 70;
+        progress_bar_value = 50;
 
         palette = new (std::nothrow) uint8_t[PALETTE_STRIDE * PALETTE_SIZE];
 
@@ -1466,26 +1551,12 @@ void ResourceManager_InitInGameAssets(int32_t world) {
         delete[] palette;
     }
 
-    {
-        const uint8_t ResourceManager_PassData[] = {SURFACE_TYPE_LAND, SURFACE_TYPE_WATER, SURFACE_TYPE_COAST,
-                                                    SURFACE_TYPE_AIR};
-        uint8_t *pass_table{new (std::nothrow) uint8_t[ResourceManager_MapTileCount]};
-
-        ResourceManager_MapSurfaceMap = new (std::nothrow) uint8_t[map_cell_count];
+    pass_table = new (std::nothrow) uint8_t[ResourceManager_MapTileCount];
 
-        if (ResourceManager_MapTileCount != fread(pass_table, sizeof(uint8_t), ResourceManager_MapTileCount, fp)) {
-            ResourceManager_ExitGame(EXIT_CODE_CANNOT_READ_RES_FILE);
-        }
-
-        for (int32_t i = 0; i < ResourceManager_MapTileCount; ++i) {
-            pass_table[i] = ResourceManager_PassData[pass_table[i]];
-        }
-
-        for (uint32_t i = 0; i < map_cell_count; ++i) {
-            ResourceManager_MapSurfaceMap[i] = pass_table[ResourceManager_MapTileIds[i]];
-        }
+    ResourceManager_MapSurfaceMap = new (std::nothrow) uint8_t[map_cell_count];
 
-        delete[] pass_table;
+    if (ResourceManager_MapTileCount != fread(pass_table, sizeof(uint8_t), ResourceManager_MapTileCount, fp)) {
+        ResourceManager_ExitGame(EXIT_CODE_CANNOT_READ_RES_FILE);
     }
 
     fclose(fp);
@@ -1496,9 +1567,67 @@ void ResourceManager_InitInGameAssets(int32_t world) {
         ResourceManager_CargoMap[i] = 0;
     }
 
-    progress_bar_value += 3;
+    /* everything below only depends on data that is already in memory, the remaining steps run in parallel */
+    loader.AddJob(&ResourceManager_BuildSurfaceMap, pass_table);
+    loader.AddJob(&ResourceManager_BuildFilterTables, &world);
+    loader.AddJob(&ResourceManager_BuildWorldTables, &world);
+    loader.AddJob(&ResourceManager_BuildDimTable, nullptr);
+
+    for (int32_t i = 0; i < 7; ++i) {
+        fade_table_rows[i] = i;
+
+        loader.AddJob(&ResourceManager_BuildFadeTable, &fade_table_rows[i]);
+    }
+
+    loader.Run(&load_bar, progress_bar_value, 100);
+
+    delete[] pass_table;
+
+    if (ResourceManager_DisableEnhancedGraphics) {
+        delete[] map_tile_jobs[0].source;
+    }
+
+    ResourceManager_FixWorldFiles(static_cast<ResourceID>(world));
+
+    Survey_InvalidateResourceTables();
+}
+
+void ResourceManager_ScaleMapTiles(void *data) {
+    const ResourceManager_MapTileJob *job = reinterpret_cast<ResourceManager_MapTileJob *>(data);
+    const int32_t tile_size{GFX_MAP_TILE_SIZE / 2};
+    uint8_t *source_address{job->source};
+    uint8_t *destination_address{job->destination};
+
+    for (int32_t j = 0; j < job->tile_count; ++j) {
+        for (int32_t k = 0; k < tile_size; ++k) {
+            for (int32_t l = 0; l < tile_size; ++l) {
+                *destination_address = *source_address;
+                destination_address += 1;
+                source_address += 2;
+            }
+
+            source_address += 64;
+        }
+    }
+}
+
+void ResourceManager_BuildSurfaceMap(void *data) {
+    const uint8_t ResourceManager_PassData[] = {SURFACE_TYPE_LAND, SURFACE_TYPE_WATER, SURFACE_TYPE_COAST,
+                                                SURFACE_TYPE_AIR};
+    uint8_t *pass_table{reinterpret_cast<uint8_t *>(data)};
+    const uint32_t map_cell_count{static_cast<uint32_t>(ResourceManager_MapSize.x * ResourceManager_MapSize.y)};
+
+    for (int32_t i = 0; i < ResourceManager_MapTileCount; ++i) {
+        pass_table[i] = ResourceManager_PassData[pass_table[i]];
+    }
 
-    load_bar.SetValue(progress_bar_value);
+    for (uint32_t i = 0; i < map_cell_count; ++i) {
+        ResourceManager_MapSurfaceMap[i] = pass_table[ResourceManager_MapTileIds[i]];
+    }
+}
+
+void ResourceManager_BuildFilterTables(void *data) {
+    const int32_t world{*reinterpret_cast<int32_t *>(data)};
 
     if (world >= SNOW_1 && world <= SNOW_6) {
         Color_GenerateIntensityTable3(WindowManager_ColorPalette, 63, 0, 0, 63, ResourceManager_ColorIndexTable06);
@@ -1510,6 +1639,10 @@ void ResourceManager_InitInGameAssets(int32_t world) {
         Color_GenerateIntensityTable3(WindowManager_ColorPalette, 0, 63, 0, 31, ResourceManager_ColorIndexTable07);
         Color_GenerateIntensityTable3(WindowManager_ColorPalette, 0, 0, 63, 31, ResourceManager_ColorIndexTable08);
     }
+}
+
+void ResourceManager_BuildWorldTables(void *data) {
+    const int32_t world{*reinterpret_cast<int32_t *>(data)};
 
     if (world >= CRATER_1 && world <= CRATER_6) {
         Color_GenerateIntensityTable2(WindowManager_ColorPalette, 63, 63, 63, ResourceManager_ColorIndexTable10);
@@ -1531,7 +1664,9 @@ void ResourceManager_InitInGameAssets(int32_t world) {
         Color_GenerateIntensityTable2(WindowManager_ColorPalette, 0, 0, 63, ResourceManager_ColorIndexTable11);
         Color_GenerateIntensityTable2(WindowManager_ColorPalette, 63, 63, 0, ResourceManager_ColorIndexTable09);
     }
+}
 
+void ResourceManager_BuildDimTable(void *data) {
     for (int32_t i = 0, j = 0; i < PALETTE_STRIDE * PALETTE_SIZE; i += PALETTE_STRIDE, ++j) {
         int32_t r;
         int32_t g;
@@ -1551,84 +1686,71 @@ void ResourceManager_InitInGameAssets(int32_t world) {
 
         ResourceManager_ColorIndexTable12[j] = Color_MapColor(WindowManager_ColorPalette, r, g, b, false);
     }
+}
 
-    progress_bar_value += 3;
-
-    load_bar.SetValue(progress_bar_value);
+void ResourceManager_BuildFadeTable(void *data) {
+    const int32_t l{*reinterpret_cast<int32_t *>(data)};
+    const int32_t i{l * 32};
 
-    for (int32_t i = 0, l = 0; i < 7 * 32; i += 32, ++l) {
-        for (int32_t j = 0, k = 0; j < PALETTE_STRIDE * PALETTE_SIZE; j += PALETTE_STRIDE, ++k) {
-            if (j == PALETTE_STRIDE * 31) {
-                ResourceManager_ColorIndexTable13x8[l * PALETTE_SIZE + k] = 31;
+    for (int32_t j = 0, k = 0; j < PALETTE_STRIDE * PALETTE_SIZE; j += PALETTE_STRIDE, ++k) {
+        if (j == PALETTE_STRIDE * 31) {
+            ResourceManager_ColorIndexTable13x8[l * PALETTE_SIZE + k] = 31;
 
-            } else {
-                int32_t r = (WindowManager_ColorPalette[j] * i) / (7 * 32);
-                int32_t g = (WindowManager_ColorPalette[j + 1] * i) / (7 * 32);
-                int32_t b = (WindowManager_ColorPalette[j + 2] * i) / (7 * 32);
+        } else {
+            int32_t r = (WindowManager_ColorPalette[j] * i) / (7 * 32);
+            int32_t g = (WindowManager_ColorPalette[j + 1] * i) / (7 * 32);
+            int32_t b = (WindowManager_ColorPalette[j + 2] * i) / (7 * 32);
 
-                ResourceManager_ColorIndexTable13x8[l * PALETTE_SIZE + k] =
-                    Color_MapColor(WindowManager_ColorPalette, r, g, b, false);
-            }
+            ResourceManager_ColorIndexTable13x8[l * PALETTE_SIZE + k] =
+                Color_MapColor(WindowManager_ColorPalette, r, g, b, false);
         }
-
-        progress_bar_value += 3;
-
-        load_bar.SetValue(progress_bar_value);
     }
-
-    ResourceManager_FixWorldFiles(static_cast<ResourceID>(world));
 }
 
-bool ResourceManager_LoadMapTiles(FILE *fp, DrawLoadBar *loadbar) {
+bool ResourceManager_LoadMapTiles(FILE *fp, DrawLoadBar *loadbar, AssetLoader *loader,
+                                  ResourceManager_MapTileJob *jobs) {
     int32_t tile_size{GFX_MAP_TILE_SIZE};
     int32_t tile_count_stride{(ResourceManager_MapTileCount + 7) / 8};
-    uint8_t *tile_data_chunk{nullptr};
+    uint8_t *tile_data{nullptr};
 
     if (ResourceManager_DisableEnhancedGraphics) {
+        /* the source tiles are kept until the scaling jobs of the asset loader finished */
         tile_size /= 2;
-        tile_data_chunk = new (std::nothrow) uint8_t[tile_count_stride * GFX_MAP_TILE_SIZE * GFX_MAP_TILE_SIZE];
+        tile_data = new (std::nothrow) uint8_t[ResourceManager_MapTileCount * GFX_MAP_TILE_SIZE * GFX_MAP_TILE_SIZE];
+        jobs[0].source = tile_data;
     }
 
     ResourceManager_MapTileBuffer = new (std::nothrow) uint8_t[ResourceManager_MapTileCount * tile_size * tile_size];
 
-    for (int32_t i = 0; i < ResourceManager_MapTileCount; i += tile_count_stride) {
-        loadbar->SetValue(i * 50 / ResourceManager_MapTileCount + 20);
+    if (!ResourceManager_DisableEnhancedGraphics) {
+        tile_data = ResourceManager_MapTileBuffer;
+    }
 
-        if (!ResourceManager_DisableEnhancedGraphics) {
-            tile_data_chunk = &ResourceManager_MapTileBuffer[i * GFX_MAP_TILE_SIZE * GFX_MAP_TILE_SIZE];
-        }
+    for (int32_t i = 0, job = 0; i < ResourceManager_MapTileCount; i += tile_count_stride, ++job) {
+        loadbar->SetValue(i * 30 / ResourceManager_MapTileCount + 20);
 
+        uint8_t *tile_data_chunk = &tile_data[i * GFX_MAP_TILE_SIZE * GFX_MAP_TILE_SIZE];
         const int32_t tile_count = std::min(tile_count_stride, ResourceManager_MapTileCount - i);
         const uint32_t data_size = tile_count * GFX_MAP_TILE_SIZE * GFX_MAP_TILE_SIZE;
 
         if (data_size != fread(tile_data_chunk, sizeof(uint8_t), data_size, fp)) {
-            delete[] tile_data_chunk;
+            if (ResourceManager_DisableEnhancedGraphics) {
+                delete[] tile_data;
+            }
+
             return false;
         }
 
         if (ResourceManager_DisableEnhancedGraphics) {
-            uint8_t *source_address{tile_data_chunk};
-            uint8_t *destination_address{&ResourceManager_MapTileBuffer[tile_size * tile_size * i]};
-
-            for (int32_t j = 0; j < tile_count; ++j) {
-                for (int32_t k = 0; k < tile_size; ++k) {
-                    for (int32_t l = 0; l < tile_size; ++l) {
-                        *destination_address = *source_address;
-                        destination_address += 1;
-                        source_address += 2;
-                    }
+            jobs[job].source = tile_data_chunk;
+            jobs[job].destination = &ResourceManager_MapTileBuffer[tile_size * tile_size * i];
+            jobs[job].tile_count = tile_count;
 
-                    source_address += 64;
-                }
-            }
+            loader->AddJob(&ResourceManager_ScaleMapTiles, &jobs[job], 4);
         }
     }
 
-    loadbar->SetValue(70);
-
-    if (ResourceManager_DisableEnhancedGraphics) {
-        delete[] tile_data_chunk;
-    }
+    loadbar->SetValue(50);
 
     return true;
 }
@@ -102,6 +102,7 @@ extern uint8_t *ResourceManager_MinimapBgImage;
 
 extern uint16_t *ResourceManager_MapTileIds;
 extern uint8_t *ResourceManager_MapTileBuffer;
+extern uint16_t ResourceManager_MapTileCount;
 extern uint8_t *ResourceManager_MapSurfaceMap;
 extern uint16_t *ResourceManager_CargoMap;
 
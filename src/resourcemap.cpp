@@ -0,0 +1,147 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "resourcemap.hpp"
+
+#if defined(_WIN32)
+#include <io.h>
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+ResourceMap::ResourceMap()
+    : data(nullptr),
+      size(0),
+#if defined(_WIN32)
+      mapping(nullptr),
+#endif
+      file(nullptr) {
+}
+
+ResourceMap::~ResourceMap() { Close(); }
+
+bool ResourceMap::Map() {
+#if defined(_WIN32)
+    HANDLE handle = reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(file)));
+    LARGE_INTEGER file_size;
+
+    if (handle == INVALID_HANDLE_VALUE || !GetFileSizeEx(handle, &file_size) || file_size.QuadPart <= 0) {
+        return false;
+    }
+
+    mapping = CreateFileMappingA(handle, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+
+    if (!mapping) {
+        return false;
+    }
+
+    data = static_cast<uint8_t *>(MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0));
+
+    if (!data) {
+        CloseHandle(mapping);
+        mapping = nullptr;
+
+        return false;
+    }
+
+    size = static_cast<size_t>(file_size.QuadPart);
+#else
+    struct stat file_stat;
+
+    if (fstat(fileno(file), &file_stat) || file_stat.st_size <= 0) {
+        return false;
+    }
+
+    void *address = mmap(nullptr, file_stat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileno(file), 0);
+
+    if (address == MAP_FAILED) {
+        return false;
+    }
+
+    data = static_cast<uint8_t *>(address);
+    size = file_stat.st_size;
+#endif
+
+    return true;
+}
+
+void ResourceMap::Unmap() {
+    if (data) {
+#if defined(_WIN32)
+        UnmapViewOfFile(data);
+        CloseHandle(mapping);
+        mapping = nullptr;
+#else
+        munmap(data, size);
+#endif
+        data = nullptr;
+        size = 0;
+    }
+}
+
+bool ResourceMap::Open(FILE *fp) {
+    Close();
+
+    if (fp) {
+        file = fp;
+
+        if (!Map()) {
+            file = nullptr;
+        }
+    }
+
+    return IsMapped();
+}
+
+void ResourceMap::Close() {
+    Unmap();
+    file = nullptr;
+}
+
+bool ResourceMap::Reset() {
+    if (IsMapped()) {
+        Unmap();
+
+        if (!Map()) {
+            file = nullptr;
+        }
+    }
+
+    return IsMapped();
+}
+
+bool ResourceMap::IsMapped() const { return data != nullptr; }
+
+uint8_t *ResourceMap::GetData(int32_t offset, int32_t length) const {
+    uint8_t *result;
+
+    if (data && offset >= 0 && length >= 0 && static_cast<size_t>(offset) + static_cast<size_t>(length) <= size) {
+        result = &data[offset];
+    } else {
+        result = nullptr;
+    }
+
+    return result;
+}
+
+size_t ResourceMap::GetSize() const { return size; }
@@ -0,0 +1,55 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef RESOURCEMAP_HPP
+#define RESOURCEMAP_HPP
+
+#include <cstdint>
+#include <cstdio>
+
+/// Private copy-on-write memory mapping of a resource file. Resources are served as views into the mapping so that
+/// loading an asset does not allocate a heap buffer or copy the data. Writes through a view only touch private copies
+/// of the affected pages, the file on disk is never modified. Reset drops all private pages so that every view shows
+/// the pristine file content again.
+class ResourceMap {
+    uint8_t *data;
+    size_t size;
+#if defined(_WIN32)
+    void *mapping;
+#endif
+    FILE *file;
+
+    bool Map();
+    void Unmap();
+
+public:
+    ResourceMap();
+    ~ResourceMap();
+
+    bool Open(FILE *fp);
+    void Close();
+    bool Reset();
+    bool IsMapped() const;
+    uint8_t *GetData(int32_t offset, int32_t length) const;
+    size_t GetSize() const;
+};
+
+#endif /* RESOURCEMAP_HPP */
@@ -21,6 +21,15 @@
 
 #include "saveload.hpp"
 
+#include <SDL_atomic.h>
+#include <SDL_thread.h>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
 #include "ai.hpp"
 #include "game_manager.hpp"
 #include "hash.hpp"
@@ -29,6 +38,7 @@
 #include "message_manager.hpp"
 #include "missionregistry.hpp"
 #include "smartfile.hpp"
+#include "survey.hpp"
 #include "units_manager.hpp"
 
 extern const char *menu_team_names[];
@@ -40,7 +50,39 @@ extern int32_t SaveLoadMenu_SaveSlot;
 extern uint16_t SaveLoadMenu_TurnTimer;
 extern uint8_t SaveLoadMenu_GameState;
 
+enum : uint32_t {
+    SAVELOAD_SECTION_HEADER,
+    SAVELOAD_SECTION_OPTIONS,
+    SAVELOAD_SECTION_MAP,
+    SAVELOAD_SECTION_TEAMS,
+    SAVELOAD_SECTION_UNITS,
+    SAVELOAD_SECTION_HASHES,
+    SAVELOAD_SECTION_HEAT_MAPS,
+    SAVELOAD_SECTION_MESSAGES,
+    SAVELOAD_SECTION_AI,
+};
+
+enum : int32_t {
+    SAVELOAD_SAVE_STATUS_IDLE,
+    SAVELOAD_SAVE_STATUS_IN_PROGRESS,
+    SAVELOAD_SAVE_STATUS_SUCCEEDED,
+    SAVELOAD_SAVE_STATUS_FAILED,
+};
+
+struct SaveLoad_SaveJob {
+    std::filesystem::path filepath;
+    SmartFileImage image;
+};
+
+static SDL_Thread *SaveLoad_SaveThread;
+static SDL_atomic_t SaveLoad_SaveStatus;
+
 static void SaveLoad_TeamClearUnitList(SmartList<UnitInfo> &units, uint16_t team);
+static void SaveLoad_WriteGame(SmartFileWriter &file, const char *const save_name, const uint32_t rng_seed);
+static bool SaveLoad_WriteSaveFile(const std::filesystem::path &filepath, const uint8_t *const buffer,
+                                   const size_t size);
+static bool SaveLoad_WriteImage(const std::filesystem::path &filepath, SmartFileImage &image);
+static int32_t SaveLoad_SaveWorker(void *data);
 static std::filesystem::path SaveLoad_GetFilePath(const int32_t save_slot, const int32_t game_file_type,
                                                   std::string *file_name = nullptr);
 
@@ -57,9 +99,12 @@ bool SaveLoad_LoadIniOptions(const int32_t save_slot, const int32_t game_file_ty
     auto filepath = SaveLoad_GetFilePath(save_slot, game_file_type);
     bool result;
 
-    if (file.Open(filepath.string().c_str())) {
+    SaveLoad_WaitForSave();
+
+    if (file.Open(filepath.string().c_str(), SAVELOAD_SECTION_OPTIONS + 1)) {
         switch (file.GetFormat()) {
-            case SmartFileFormat::V70: {
+            case SmartFileFormat::V70:
+            case SmartFileFormat::V72: {
                 uint8_t buffer[176];
 
                 file.Read(buffer);
@@ -118,9 +163,12 @@ bool SaveLoad_GetSaveFileInfo(const int32_t save_slot, const int32_t game_file_t
     bool result;
     auto filepath = SaveLoad_GetFilePath(save_slot, game_file_type, &file_name);
 
-    if (file.Open(filepath.string().c_str())) {
+    SaveLoad_WaitForSave();
+
+    if (file.Open(filepath.string().c_str(), SAVELOAD_SECTION_HEADER + 1)) {
         switch (file.GetFormat()) {
-            case SmartFileFormat::V70: {
+            case SmartFileFormat::V70:
+            case SmartFileFormat::V72: {
                 uint16_t version;
                 uint8_t save_game_type;
                 char save_name[30];
@@ -221,6 +269,10 @@ bool SaveLoad_GetSaveFileInfo(const int32_t save_slot, const int32_t game_file_t
             result = false;
         } break;
 
+        case static_cast<uint32_t>(SmartFileFormat::V72): {
+            result = true;
+        } break;
+
         default: {
             result = false;
         } break;
@@ -229,166 +281,336 @@ bool SaveLoad_GetSaveFileInfo(const int32_t save_slot, const int32_t game_file_t
     return result;
 }
 
-void SaveLoad_Save(const std::filesystem::path &filepath, const char *const save_name, const uint32_t rng_seed) {
-    SmartFileWriter file;
-    if (file.Open(filepath.string().c_str())) {
-        uint16_t version;
-        uint8_t save_game_type;
-        char local_save_name[30] = {0};
-        uint8_t world;
-        uint16_t mission_index;
-        char team_names[4][30] = {{0}};
-        uint8_t team_type[5] = {0};
-        uint8_t team_clan[5] = {0};
-        int8_t opponent;
-        uint16_t turn_timer_time;
-        uint16_t endturn_time;
-        int8_t play_mode;
-        uint16_t game_state;
-        const uint32_t map_cell_count{static_cast<uint32_t>(ResourceManager_MapSize.x * ResourceManager_MapSize.y)};
-
-        version = static_cast<uint16_t>(SmartFileFormat::V70);
-        save_game_type = ini_get_setting(INI_GAME_FILE_TYPE);
-
-        SDL_utf8strlcpy(local_save_name, save_name, sizeof(local_save_name));
-
-        world = ini_get_setting(INI_WORLD);
-        mission_index = GameManager_GameFileNumber;
-        opponent = ini_get_setting(INI_OPPONENT);
-        turn_timer_time = ini_get_setting(INI_TIMER);
-        endturn_time = ini_get_setting(INI_ENDTURN);
-        play_mode = ini_get_setting(INI_PLAY_MODE);
+void SaveLoad_WriteGame(SmartFileWriter &file, const char *const save_name, const uint32_t rng_seed) {
+    uint16_t version;
+    uint8_t save_game_type;
+    char local_save_name[30] = {0};
+    uint8_t world;
+    uint16_t mission_index;
+    char team_names[4][30] = {{0}};
+    uint8_t team_type[5] = {0};
+    uint8_t team_clan[5] = {0};
+    int8_t opponent;
+    uint16_t turn_timer_time;
+    uint16_t endturn_time;
+    int8_t play_mode;
+    uint16_t game_state;
+    const uint32_t map_cell_count{static_cast<uint32_t>(ResourceManager_MapSize.x * ResourceManager_MapSize.y)};
 
-        for (int32_t team = PLAYER_TEAM_RED; team < PLAYER_TEAM_MAX - 1; ++team) {
-            if ((save_game_type == GAME_TYPE_TRAINING || save_game_type == GAME_TYPE_SCENARIO ||
-                 save_game_type == GAME_TYPE_CAMPAIGN) &&
-                team != PLAYER_TEAM_RED && UnitsManager_TeamInfo[team].team_type == TEAM_TYPE_PLAYER) {
-                UnitsManager_TeamInfo[team].team_type = TEAM_TYPE_COMPUTER;
-            }
+    version = static_cast<uint16_t>(file.GetFormat());
+    save_game_type = ini_get_setting(INI_GAME_FILE_TYPE);
 
-            if (save_game_type == GAME_TYPE_DEMO && UnitsManager_TeamInfo[team].team_type != TEAM_TYPE_NONE) {
-                UnitsManager_TeamInfo[team].team_type = TEAM_TYPE_COMPUTER;
-            }
+    SDL_utf8strlcpy(local_save_name, save_name, sizeof(local_save_name));
 
-            if (UnitsManager_TeamInfo[team].team_type != TEAM_TYPE_NONE) {
-                ini_config.GetStringValue(static_cast<IniParameter>(INI_RED_TEAM_NAME + team), team_names[team],
-                                          sizeof(team_names[team]));
-                if (!strlen(team_names[team])) {
-                    strcpy(team_names[team], menu_team_names[team]);
-                }
-            }
+    world = ini_get_setting(INI_WORLD);
+    mission_index = GameManager_GameFileNumber;
+    opponent = ini_get_setting(INI_OPPONENT);
+    turn_timer_time = ini_get_setting(INI_TIMER);
+    endturn_time = ini_get_setting(INI_ENDTURN);
+    play_mode = ini_get_setting(INI_PLAY_MODE);
 
-            team_type[team] = UnitsManager_TeamInfo[team].team_type;
-            team_clan[team] = UnitsManager_TeamInfo[team].team_clan;
+    for (int32_t team = PLAYER_TEAM_RED; team < PLAYER_TEAM_MAX - 1; ++team) {
+        if ((save_game_type == GAME_TYPE_TRAINING || save_game_type == GAME_TYPE_SCENARIO ||
+             save_game_type == GAME_TYPE_CAMPAIGN) &&
+            team != PLAYER_TEAM_RED && UnitsManager_TeamInfo[team].team_type == TEAM_TYPE_PLAYER) {
+            UnitsManager_TeamInfo[team].team_type = TEAM_TYPE_COMPUTER;
         }
 
-        file.Write(version);
-        file.Write(save_game_type);
-        file.Write(local_save_name);
-        file.Write(world);
-        file.Write(mission_index);
-        file.Write(team_names);
-        file.Write(team_type);
-        file.Write(team_clan);
-        file.Write(rng_seed);
-        file.Write(opponent);
-        file.Write(turn_timer_time);
-        file.Write(endturn_time);
-        file.Write(play_mode);
-
-        ini_config.SaveSection(file, INI_OPTIONS);
-
-        file.Write(ResourceManager_MapSurfaceMap, map_cell_count * sizeof(uint8_t));
-        file.Write(ResourceManager_CargoMap, map_cell_count * sizeof(uint16_t));
+        if (save_game_type == GAME_TYPE_DEMO && UnitsManager_TeamInfo[team].team_type != TEAM_TYPE_NONE) {
+            UnitsManager_TeamInfo[team].team_type = TEAM_TYPE_COMPUTER;
+        }
 
-        for (int32_t team = PLAYER_TEAM_RED; team < PLAYER_TEAM_MAX - 1; ++team) {
-            CTInfo *team_info;
-            uint16_t unit_id;
-
-            team_info = &UnitsManager_TeamInfo[team];
-
-            file.Write(team_info->markers);
-            file.Write(team_info->team_type);
-            file.Write(team_info->finished_turn);
-            file.Write(team_info->team_clan);
-            file.Write(team_info->research_topics);
-            file.Write(team_info->team_points);
-            file.Write(team_info->number_of_objects_created);
-            file.Write(team_info->unit_counters);
-            file.Write(team_info->screen_locations);
-            file.Write(team_info->score_graph, sizeof(team_info->score_graph));
-
-            if (team_info->selected_unit != nullptr) {
-                unit_id = team_info->selected_unit->GetId();
-            } else {
-                unit_id = 0xFFFF;
+        if (UnitsManager_TeamInfo[team].team_type != TEAM_TYPE_NONE) {
+            ini_config.GetStringValue(static_cast<IniParameter>(INI_RED_TEAM_NAME + team), team_names[team],
+                                      sizeof(team_names[team]));
+            if (!strlen(team_names[team])) {
+                strcpy(team_names[team], menu_team_names[team]);
             }
+        }
+
+        team_type[team] = UnitsManager_TeamInfo[team].team_type;
+        team_clan[team] = UnitsManager_TeamInfo[team].team_clan;
+    }
+
+    file.BeginSection(SAVELOAD_SECTION_HEADER);
+
+    file.Write(version);
+    file.Write(save_game_type);
+    file.Write(local_save_name);
+    file.Write(world);
+    file.Write(mission_index);
+    file.Write(team_names);
+    file.Write(team_type);
+    file.Write(team_clan);
+    file.Write(rng_seed);
+    file.Write(opponent);
+    file.Write(turn_timer_time);
+    file.Write(endturn_time);
+    file.Write(play_mode);
+
+    file.BeginSection(SAVELOAD_SECTION_OPTIONS);
+
+    ini_config.SaveSection(file, INI_OPTIONS);
+
+    file.BeginSection(SAVELOAD_SECTION_MAP);
 
-            file.Write(unit_id);
-            file.Write(team_info->zoom_level);
-            file.Write(team_info->camera_position.x);
-            file.Write(team_info->camera_position.y);
-            file.Write(team_info->display_button_range);
-            file.Write(team_info->display_button_scan);
-            file.Write(team_info->display_button_status);
-            file.Write(team_info->display_button_colors);
-            file.Write(team_info->display_button_hits);
-            file.Write(team_info->display_button_ammo);
-            file.Write(team_info->display_button_names);
-            file.Write(team_info->display_button_minimap_2x);
-            file.Write(team_info->display_button_minimap_tnt);
-            file.Write(team_info->display_button_grid);
-            file.Write(team_info->display_button_survey);
-            file.Write(team_info->stats_factories_built);
-            file.Write(team_info->stats_mines_built);
-            file.Write(team_info->stats_buildings_built);
-            file.Write(team_info->stats_units_built);
-            file.Write(team_info->casualties);
-            file.Write(team_info->stats_gold_spent_on_upgrades);
+    file.Write(ResourceManager_MapSurfaceMap, map_cell_count * sizeof(uint8_t));
+    file.Write(ResourceManager_CargoMap, map_cell_count * sizeof(uint16_t));
+
+    file.BeginSection(SAVELOAD_SECTION_TEAMS);
+
+    for (int32_t team = PLAYER_TEAM_RED; team < PLAYER_TEAM_MAX - 1; ++team) {
+        CTInfo *team_info;
+        uint16_t unit_id;
+
+        team_info = &UnitsManager_TeamInfo[team];
+
+        file.Write(team_info->markers);
+        file.Write(team_info->team_type);
+        file.Write(team_info->finished_turn);
+        file.Write(team_info->team_clan);
+        file.Write(team_info->research_topics);
+        file.Write(team_info->team_points);
+        file.Write(team_info->number_of_objects_created);
+        file.Write(team_info->unit_counters);
+        file.Write(team_info->screen_locations);
+        file.Write(team_info->score_graph, sizeof(team_info->score_graph));
+
+        if (team_info->selected_unit != nullptr) {
+            unit_id = team_info->selected_unit->GetId();
+        } else {
+            unit_id = 0xFFFF;
         }
 
-        file.Write(GameManager_ActiveTurnTeam);
-        file.Write(GameManager_PlayerTeam);
-        file.Write(GameManager_TurnCounter);
+        file.Write(unit_id);
+        file.Write(team_info->zoom_level);
+        file.Write(team_info->camera_position.x);
+        file.Write(team_info->camera_position.y);
+        file.Write(team_info->display_button_range);
+        file.Write(team_info->display_button_scan);
+        file.Write(team_info->display_button_status);
+        file.Write(team_info->display_button_colors);
+        file.Write(team_info->display_button_hits);
+        file.Write(team_info->display_button_ammo);
+        file.Write(team_info->display_button_names);
+        file.Write(team_info->display_button_minimap_2x);
+        file.Write(team_info->display_button_minimap_tnt);
+        file.Write(team_info->display_button_grid);
+        file.Write(team_info->display_button_survey);
+        file.Write(team_info->stats_factories_built);
+        file.Write(team_info->stats_mines_built);
+        file.Write(team_info->stats_buildings_built);
+        file.Write(team_info->stats_units_built);
+        file.Write(team_info->casualties);
+        file.Write(team_info->stats_gold_spent_on_upgrades);
+    }
 
-        game_state = GameManager_GameState;
+    file.Write(GameManager_ActiveTurnTeam);
+    file.Write(GameManager_PlayerTeam);
+    file.Write(GameManager_TurnCounter);
 
-        file.Write(game_state);
+    game_state = GameManager_GameState;
 
-        uint16_t timer_value = GameManager_TurnTimerValue;
+    file.Write(game_state);
 
-        file.Write(timer_value);
+    uint16_t timer_value = GameManager_TurnTimerValue;
 
-        ini_config.SaveSection(file, INI_PREFERENCES);
+    file.Write(timer_value);
 
-        ResourceManager_TeamUnitsRed.FileSave(file);
-        ResourceManager_TeamUnitsGreen.FileSave(file);
-        ResourceManager_TeamUnitsBlue.FileSave(file);
-        ResourceManager_TeamUnitsGray.FileSave(file);
+    ini_config.SaveSection(file, INI_PREFERENCES);
 
-        SmartList_UnitInfo_FileSave(UnitsManager_GroundCoverUnits, file);
-        SmartList_UnitInfo_FileSave(UnitsManager_MobileLandSeaUnits, file);
-        SmartList_UnitInfo_FileSave(UnitsManager_StationaryUnits, file);
-        SmartList_UnitInfo_FileSave(UnitsManager_MobileAirUnits, file);
-        SmartList_UnitInfo_FileSave(UnitsManager_ParticleUnits, file);
+    file.BeginSection(SAVELOAD_SECTION_UNITS);
 
-        Hash_UnitHash.FileSave(file);
-        Hash_MapHash.FileSave(file);
+    ResourceManager_TeamUnitsRed.FileSave(file);
+    ResourceManager_TeamUnitsGreen.FileSave(file);
+    ResourceManager_TeamUnitsBlue.FileSave(file);
+    ResourceManager_TeamUnitsGray.FileSave(file);
 
-        for (int32_t team = PLAYER_TEAM_RED; team < PLAYER_TEAM_MAX - 1; ++team) {
-            if (UnitsManager_TeamInfo[team].team_type != TEAM_TYPE_NONE) {
-                file.Write(UnitsManager_TeamInfo[team].heat_map_complete, map_cell_count);
-                file.Write(UnitsManager_TeamInfo[team].heat_map_stealth_sea, map_cell_count);
-                file.Write(UnitsManager_TeamInfo[team].heat_map_stealth_land, map_cell_count);
-            }
+    SmartList_UnitInfo_FileSave(UnitsManager_GroundCoverUnits, file);
+    SmartList_UnitInfo_FileSave(UnitsManager_MobileLandSeaUnits, file);
+    SmartList_UnitInfo_FileSave(UnitsManager_StationaryUnits, file);
+    SmartList_UnitInfo_FileSave(UnitsManager_MobileAirUnits, file);
+    SmartList_UnitInfo_FileSave(UnitsManager_ParticleUnits, file);
+
+    file.BeginSection(SAVELOAD_SECTION_HASHES);
+
+    Hash_UnitHash.FileSave(file);
+    Hash_MapHash.FileSave(file);
+
+    file.BeginSection(SAVELOAD_SECTION_HEAT_MAPS);
+
+    for (int32_t team = PLAYER_TEAM_RED; team < PLAYER_TEAM_MAX - 1; ++team) {
+        if (UnitsManager_TeamInfo[team].team_type != TEAM_TYPE_NONE) {
+            file.Write(UnitsManager_TeamInfo[team].heat_map_complete, map_cell_count);
+            file.Write(UnitsManager_TeamInfo[team].heat_map_stealth_sea, map_cell_count);
+            file.Write(UnitsManager_TeamInfo[team].heat_map_stealth_land, map_cell_count);
+        }
+    }
+
+    file.BeginSection(SAVELOAD_SECTION_MESSAGES);
+
+    MessageManager_SaveMessageLogs(file);
+
+    file.BeginSection(SAVELOAD_SECTION_AI);
+
+    Ai_FileSave(file);
+}
+
+bool SaveLoad_WriteSaveFile(const std::filesystem::path &filepath, const uint8_t *const buffer, const size_t size) {
+    auto temp_path = filepath;
+    std::error_code ec;
+    bool result{false};
+
+    temp_path += ".TMP";
+
+    /* an empty image is never a valid save file, keep the previous one */
+    if (!buffer || size == 0) {
+        return false;
+    }
+
+    FILE *fp = fopen(temp_path.string().c_str(), "wb");
+
+    if (fp) {
+        result = fwrite(buffer, size, 1, fp) == 1 && fflush(fp) == 0;
+
+        if (result) {
+#if defined(_WIN32)
+            result = _commit(_fileno(fp)) == 0;
+#else
+            result = fsync(fileno(fp)) == 0;
+#endif
+        }
+
+        result = (fclose(fp) == 0) && result;
+
+        if (result) {
+            std::filesystem::rename(temp_path, filepath, ec);
+
+            result = !ec;
+        }
+
+        if (!result) {
+            std::filesystem::remove(temp_path, ec);
+        }
+    }
+
+    return result;
+}
+
+bool SaveLoad_WriteImage(const std::filesystem::path &filepath, SmartFileImage &image) {
+    bool result = image.Pack();
+
+    if (result) {
+        result = SaveLoad_WriteSaveFile(filepath, image.GetData(), image.GetSize());
+
+        if (!result) {
+            SDL_Log("Failed to write save file %s\n", filepath.string().c_str());
         }
 
-        MessageManager_SaveMessageLogs(file);
+    } else {
+        SDL_Log("Failed to compress save file %s\n", filepath.string().c_str());
+    }
+
+    return result;
+}
+
+int32_t SaveLoad_SaveWorker(void *data) {
+    auto job = static_cast<SaveLoad_SaveJob *>(data);
+    const bool result = SaveLoad_WriteImage(job->filepath, job->image);
+
+    /* the message manager is not thread safe, the main thread reports the outcome */
+    SDL_AtomicSet(&SaveLoad_SaveStatus, result ? SAVELOAD_SAVE_STATUS_SUCCEEDED : SAVELOAD_SAVE_STATUS_FAILED);
+
+    delete job;
+
+    return result;
+}
+
+bool SaveLoad_Save(const std::filesystem::path &filepath, const char *const save_name, const uint32_t rng_seed) {
+    SmartFileWriter file;
+    SmartFileImage image;
+    bool result{false};
+
+    SaveLoad_WaitForSave();
 
-        Ai_FileSave(file);
+    /* the image goes through the same temporary file as autosaves, so a failed save never truncates the slot. Manual
+     * saves stay in the uncompressed V70 format that earlier releases can load, only autosaves are written as V72.
+     */
+    if (file.SetFormat(static_cast<uint16_t>(SmartFileFormat::V70)) && file.OpenMemory()) {
+        SaveLoad_WriteGame(file, save_name, rng_seed);
+
+        if (file.ReleaseBuffer(image)) {
+            result = SaveLoad_WriteImage(filepath, image);
+
+        } else {
+            SDL_Log("Failed to serialize save file %s\n", filepath.string().c_str());
+        }
 
         file.Close();
     }
+
+    if (!result) {
+        MessageManager_DrawMessage(_(5e1a), 2, 0);
+    }
+
+    return result;
+}
+
+void SaveLoad_SaveAsync(const std::filesystem::path &filepath, const char *const save_name, const uint32_t rng_seed) {
+    SmartFileWriter file;
+
+    SaveLoad_WaitForSave();
+
+    SDL_AtomicSet(&SaveLoad_SaveStatus, SAVELOAD_SAVE_STATUS_FAILED);
+
+    if (file.OpenMemory()) {
+        auto job = new (std::nothrow) SaveLoad_SaveJob;
+
+        SaveLoad_WriteGame(file, save_name, rng_seed);
+
+        if (!job) {
+            SDL_Log("Failed to allocate save job for %s\n", filepath.string().c_str());
+
+        } else if (!file.ReleaseBuffer(job->image)) {
+            SDL_Log("Failed to serialize save file %s\n", filepath.string().c_str());
+
+            delete job;
+            job = nullptr;
+        }
+
+        if (job) {
+            job->filepath = filepath;
+
+            SDL_AtomicSet(&SaveLoad_SaveStatus, SAVELOAD_SAVE_STATUS_IN_PROGRESS);
+
+            SaveLoad_SaveThread = SDL_CreateThread(&SaveLoad_SaveWorker, "SaveLoad", job);
+
+            if (!SaveLoad_SaveThread) {
+                SaveLoad_SaveWorker(job);
+            }
+        }
+
+        file.Close();
+    }
+}
+
+bool SaveLoad_IsSaveInProgress() { return SDL_AtomicGet(&SaveLoad_SaveStatus) == SAVELOAD_SAVE_STATUS_IN_PROGRESS; }
+
+void SaveLoad_ReportSaveStatus() {
+    if (!SaveLoad_IsSaveInProgress()) {
+        SaveLoad_WaitForSave();
+
+        if (SDL_AtomicSet(&SaveLoad_SaveStatus, SAVELOAD_SAVE_STATUS_IDLE) == SAVELOAD_SAVE_STATUS_FAILED) {
+            MessageManager_DrawMessage(_(5e1a), 2, 0);
+        }
+    }
+}
+
+void SaveLoad_WaitForSave() {
+    if (SaveLoad_SaveThread) {
+        SDL_WaitThread(SaveLoad_SaveThread, nullptr);
+        SaveLoad_SaveThread = nullptr;
+    }
 }
 
 bool SaveLoad_LoadFormatV70(SmartFileReader &file, int32_t save_slot, bool is_remote_game, bool ini_load_mode,
@@ -479,6 +701,8 @@ bool SaveLoad_LoadFormatV70(SmartFileReader &file, int32_t save_slot, bool is_re
     file.Read(ResourceManager_MapSurfaceMap, map_cell_count * sizeof(uint8_t));
     file.Read(ResourceManager_CargoMap, map_cell_count * sizeof(uint16_t));
 
+    Survey_InvalidateResourceTables();
+
     ResourceManager_InitTeamInfo();
 
     for (int32_t team = PLAYER_TEAM_RED; team < PLAYER_TEAM_MAX - 1; ++team) {
@@ -668,9 +892,12 @@ bool SaveLoad_Load(const std::filesystem::path &filepath, int32_t save_slot, int
     bool result;
     SmartFileReader file;
 
+    SaveLoad_WaitForSave();
+
     if (file.Open(filepath.string().c_str())) {
         switch (file.GetFormat()) {
-            case SmartFileFormat::V70: {
+            case SmartFileFormat::V70:
+            case SmartFileFormat::V72: {
                 result = SaveLoad_LoadFormatV70(file, save_slot, is_remote_game, ini_load_mode, game_file_type);
             } break;
 
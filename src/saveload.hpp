@@ -46,7 +46,11 @@ bool SaveLoad_LoadIniOptions(const int32_t save_slot, const int32_t game_file_ty
 bool SaveLoad_GetSaveFileInfo(const int32_t save_slot, const int32_t game_file_type,
                               struct SaveFileInfo &save_file_header);
 [[nodiscard]] bool SaveLoad_IsSaveFileFormatSupported(const uint32_t format_version);
-void SaveLoad_Save(const std::filesystem::path &filepath, const char *const save_name, const uint32_t rng_seed);
+bool SaveLoad_Save(const std::filesystem::path &filepath, const char *const save_name, const uint32_t rng_seed);
+void SaveLoad_SaveAsync(const std::filesystem::path &filepath, const char *const save_name, const uint32_t rng_seed);
+[[nodiscard]] bool SaveLoad_IsSaveInProgress();
+void SaveLoad_ReportSaveStatus();
+void SaveLoad_WaitForSave();
 bool SaveLoad_Load(const std::filesystem::path &filepath, int32_t save_slot, int32_t game_file_type, bool ini_load_mode,
                    bool is_remote_game);
 
@@ -602,11 +602,12 @@ int32_t SaveLoadMenu_MenuLoop(int32_t is_saving_allowed) {
     return result;
 }
 
-void SaveLoadMenu_Save(const char *file_name, const char *save_name, bool play_voice, bool backup) {
+bool SaveLoadMenu_Save(const char *file_name, const char *save_name, bool play_voice, bool backup, bool async) {
     SmartString filename{file_name};
     std::filesystem::path filepath;
     char team_types[PLAYER_TEAM_MAX - 1];
     uint32_t rng_seed;
+    bool result{true};
 
     if (!play_voice) {
         bool corruption_detected = SaveLoadMenu_RunPlausibilityTests();
@@ -614,7 +615,7 @@ void SaveLoadMenu_Save(const char *file_name, const char *save_name, bool play_v
         SDL_assert(!corruption_detected);
 
         if (corruption_detected) {
-            return;
+            return false;
         }
     }
 
@@ -642,15 +643,22 @@ void SaveLoadMenu_Save(const char *file_name, const char *save_name, bool play_v
         rng_seed += file_name[i];
     }
 
-    SaveLoad_Save(filepath, save_name, rng_seed);
+    if (async) {
+        SaveLoad_SaveAsync(filepath, save_name, rng_seed);
+
+    } else {
+        result = SaveLoad_Save(filepath, save_name, rng_seed);
+    }
 
     for (int32_t team = PLAYER_TEAM_RED; team < PLAYER_TEAM_MAX - 1; ++team) {
         UnitsManager_TeamInfo[team].team_type = team_types[team];
     }
 
-    if (play_voice) {
+    if (play_voice && result) {
         SoundManager_PlayVoice(V_M013, V_F013);
     }
+
+    return result;
 }
 
 bool SaveLoadMenu_Load(int32_t save_slot, int32_t game_file_type, bool ini_load_mode) {
@@ -801,6 +809,8 @@ void SaveLoadMenu_CreateBackup(const char *file_name) {
     const auto save_path = std::filesystem::path(file_name).lexically_normal();
     std::error_code ec;
 
+    SaveLoad_WaitForSave();
+
     if (std::filesystem::exists(save_path, ec)) {
         const auto backup_path = std::filesystem::path(file_name).replace_extension(".BAK");
 
@@ -36,7 +36,8 @@ extern uint8_t SaveLoadMenu_GameState;
 
 void SaveLoadMenu_CreateBackup(const char* file_name);
 int32_t SaveLoadMenu_MenuLoop(int32_t is_saving_allowed);
-void SaveLoadMenu_Save(const char* file_name, const char* save_name, bool play_voice, bool backup = false);
+bool SaveLoadMenu_Save(const char* file_name, const char* save_name, bool play_voice, bool backup = false,
+                       bool async = false);
 bool SaveLoadMenu_Load(int32_t save_slot, int32_t game_file_type, bool ini_load_mode);
 int32_t SaveLoadMenu_GetGameFileType();
 
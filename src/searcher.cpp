@@ -29,9 +29,10 @@
 #include "window_manager.hpp"
 
 static void Searcher_DrawMarker(int32_t angle, int32_t grid_x, int32_t grid_y, int32_t color);
-static int32_t Searcher_EvaluateCost(const Point position, const Point new_position, const bool air_support);
+static int32_t Searcher_EvaluateCost(uint8_t** const map, const Point position, const Point new_position,
+                                     const bool air_support);
 
-int32_t Searcher::Searcher_MarkerColor = COLOR_RED;
+thread_local int32_t Searcher::Searcher_MarkerColor = COLOR_RED;
 
 void Searcher_DrawMarker(int32_t angle, int32_t grid_x, int32_t grid_y, int32_t color) {
     WindowInfo* window;
@@ -60,17 +61,18 @@ void Searcher_DrawMarker(int32_t angle, int32_t grid_x, int32_t grid_y, int32_t
     }
 }
 
-int32_t Searcher_EvaluateCost(const Point position, const Point new_position, const bool air_support) {
+int32_t Searcher_EvaluateCost(uint8_t** const map, const Point position, const Point new_position,
+                              const bool air_support) {
     uint8_t value1;
     uint8_t value2;
     int32_t result;
 
-    value2 = PathsManager_GetAccessMap()[new_position.x][new_position.y];
+    value2 = map[new_position.x][new_position.y];
 
     ++Paths_EvaluatorCallCount;
 
     if (air_support) {
-        value1 = PathsManager_GetAccessMap()[position.x][position.y];
+        value1 = map[position.x][position.y];
 
         if ((value2 & 0x40) && (value1 & 0x80)) {
             result = 0;
@@ -89,24 +91,18 @@ int32_t Searcher_EvaluateCost(const Point position, const Point new_position, co
     return result;
 }
 
-Searcher::Searcher(const Point start_point, const Point end_point, const bool air_support)
-    : use_air_support(air_support) {
+Searcher::Searcher(uint8_t** const map, const Point start_point, const Point end_point, const bool air_support,
+                   const bool worker_search)
+    : access_map(map),
+      costs_map(ResourceManager_MapSize.x, ResourceManager_MapSize.y),
+      directions_map(ResourceManager_MapSize.x, ResourceManager_MapSize.y),
+      use_air_support(air_support),
+      is_worker_search(worker_search) {
     Point map_size;
     PathSquare square;
 
-    costs_map = new (std::nothrow) uint16_t*[ResourceManager_MapSize.x];
-    directions_map = new (std::nothrow) uint8_t*[ResourceManager_MapSize.x];
-
-    for (int32_t i = 0; i < ResourceManager_MapSize.x; ++i) {
-        costs_map[i] = new (std::nothrow) uint16_t[ResourceManager_MapSize.y];
-        directions_map[i] = new (std::nothrow) uint8_t[ResourceManager_MapSize.y];
-
-        memset(directions_map[i], 0xFF, ResourceManager_MapSize.y);
-
-        for (int32_t j = 0; j < ResourceManager_MapSize.y; ++j) {
-            costs_map[i][j] = 0x3FFF;
-        }
-    }
+    costs_map.Fill(0x3FFF);
+    directions_map.Fill(0xFF);
 
     line_distance_max = 0;
 
@@ -147,16 +143,7 @@ Searcher::Searcher(const Point start_point, const Point end_point, const bool ai
     }
 }
 
-Searcher::~Searcher() {
-    for (int32_t i = 0; i < ResourceManager_MapSize.x; ++i) {
-        delete[] costs_map[i];
-        delete[] directions_map[i];
-    }
-
-    delete[] costs_map;
-    delete[] directions_map;
-    delete[] distance_vector;
-}
+Searcher::~Searcher() { delete[] distance_vector; }
 
 void Searcher::EvaluateSquare(const Point position, const int32_t cost, const int32_t direction,
                               Searcher* const searcher) {
@@ -233,7 +220,7 @@ void Searcher::EvaluateSquare(const Point position, const int32_t cost, const in
 
                 squares.Insert(&path_square, square_count);
 
-                if (Paths_DebugMode >= 2) {
+                if (Paths_DebugMode >= 2 && !is_worker_search) {
                     Searcher_DrawMarker(direction, position.x, position.y, Searcher_MarkerColor);
                 }
             }
@@ -242,7 +229,7 @@ void Searcher::EvaluateSquare(const Point position, const int32_t cost, const in
     } else if (costs_map[position.x][position.y] == cost) {
         directions_map[position.x][position.y] = direction;
 
-        if (Paths_DebugMode >= 2) {
+        if (Paths_DebugMode >= 2 && !is_worker_search) {
             Searcher_DrawMarker(direction, position.x, position.y, Searcher_MarkerColor);
         }
     }
@@ -376,14 +363,14 @@ void Searcher::Process(Point position, const bool mode_flag) {
 
         new_position = position + Paths_8DirPointsArray[unit_angle];
 
-        step_cost = Searcher_EvaluateCost(position, new_position, use_air_support);
+        step_cost = Searcher_EvaluateCost(access_map, position, new_position, use_air_support);
 
         if (step_cost == 0) {
             return;
         }
 
         if (!mode_flag) {
-            step_cost = Searcher_EvaluateCost(new_position, position, use_air_support);
+            step_cost = Searcher_EvaluateCost(access_map, new_position, position, use_air_support);
         }
 
         if (unit_angle & 1) {
@@ -428,7 +415,7 @@ bool Searcher::ForwardSearch(Searcher* const backward_searcher) {
             if (step.x >= 0 && step.x < ResourceManager_MapSize.x && step.y >= 0 &&
                 step.y < ResourceManager_MapSize.y) {
                 if (position_cost < costs_map[step.x][step.y]) {
-                    cost = Searcher_EvaluateCost(position, step, use_air_support);
+                    cost = Searcher_EvaluateCost(access_map, position, step, use_air_support);
 
                     if (cost > 0) {
                         if (direction & 1) {
@@ -465,7 +452,7 @@ bool Searcher::BackwardSearch(Searcher* const forward_searcher) {
 
         Searcher_MarkerColor = COLOR_BLUE;
 
-        const int32_t reference_cost = Searcher_EvaluateCost(position, position, use_air_support);
+        const int32_t reference_cost = Searcher_EvaluateCost(access_map, position, position, use_air_support);
 
         for (int32_t direction = 0; direction < 8; ++direction) {
             const Point step = position + Paths_8DirPointsArray[direction];
@@ -473,7 +460,7 @@ bool Searcher::BackwardSearch(Searcher* const forward_searcher) {
             if (step.x >= 0 && step.x < ResourceManager_MapSize.x && step.y >= 0 &&
                 step.y < ResourceManager_MapSize.y) {
                 if (position_cost < costs_map[step.x][step.y]) {
-                    if (Searcher_EvaluateCost(position, step, use_air_support) > 0) {
+                    if (Searcher_EvaluateCost(access_map, position, step, use_air_support) > 0) {
                         int32_t cost = reference_cost;
 
                         if (direction & 1) {
@@ -515,7 +502,7 @@ SmartPointer<GroundPath> Searcher::DeterminePath(const Point position, const int
                     destination_x += steps[steps_count]->x;
                     destination_y += steps[steps_count]->y;
 
-                    int32_t accessmap_cost = PathsManager_GetAccessMap()[destination_x][destination_y] & 0x1F;
+                    int32_t accessmap_cost = access_map[destination_x][destination_y] & 0x1F;
 
                     if (steps[steps_count]->x && steps[steps_count]->y) {
                         accessmap_cost = (accessmap_cost * 3) / 2;
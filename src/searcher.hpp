@@ -22,6 +22,7 @@
 #ifndef SEARCHER_HPP
 #define SEARCHER_HPP
 
+#include "grid2d.hpp"
 #include "point.hpp"
 #include "smartobjectarray.hpp"
 
@@ -33,22 +34,25 @@ struct PathSquare {
 };
 
 class Searcher {
-    static int32_t Searcher_MarkerColor;
+    static thread_local int32_t Searcher_MarkerColor;
 
-    uint16_t **costs_map;
-    uint8_t **directions_map;
+    uint8_t **access_map;
+    Grid2D<uint16_t> costs_map;
+    Grid2D<uint8_t> directions_map;
     uint16_t *distance_vector;
     int16_t line_distance_max;
     int32_t line_distance_limit;
     ObjectArray<PathSquare> squares;
     Point destination;
     bool use_air_support;
+    bool is_worker_search;
 
     void EvaluateSquare(const Point position, const int32_t cost, const int32_t direction, Searcher *const searcher);
     void UpdateCost(const Point start_point, const Point end_point, const int32_t cost);
 
 public:
-    Searcher(const Point start_point, const Point end_point, const bool air_support);
+    Searcher(uint8_t **const map, const Point start_point, const Point end_point, const bool air_support,
+             const bool worker_search = false);
     ~Searcher();
 
     void Process(Point position, const bool mode_flag);
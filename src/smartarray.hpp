@@ -23,6 +23,7 @@
 #define SMARTARRAY_HPP
 
 #include <climits>
+#include <utility>
 
 #include "smartpointer.hpp"
 
@@ -50,8 +51,7 @@ public:
             auto* array = new (std::nothrow) SmartPointer<T>[growth_factor + capacity];
 
             for (int32_t i = 0; i < count; ++i) {
-                array[i] = smartarray[i];
-                smartarray[i] = nullptr;
+                array[i] = std::move(smartarray[i]);
             }
 
             delete[] smartarray;
@@ -65,7 +65,7 @@ public:
         }
 
         for (int32_t i = count; i > index; --i) {
-            smartarray[i] = smartarray[i - 1];
+            smartarray[i] = std::move(smartarray[i - 1]);
         }
 
         smartarray[index] = object;
@@ -78,7 +78,7 @@ public:
         SDL_assert(index < count);
 
         for (int32_t i = index; i < count - 1; ++i) {
-            smartarray[i] = smartarray[i + 1];
+            smartarray[i] = std::move(smartarray[i + 1]);
         }
 
         smartarray[count - 1] = nullptr;
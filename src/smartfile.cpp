@@ -21,8 +21,15 @@
 
 #include "smartfile.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+#include "lzcodec.hpp"
 #include "registerarray.hpp"
 
+#define SMARTFILE_WRITER_BLOCK_SIZE (64 * 1024)
+
 SmartFileReader::SmartFileReader() noexcept : m_format(static_cast<uint16_t>(SmartFileFormat::UNSPECIFIED)) {};
 
 SmartFileReader::SmartFileReader(const char* const path) noexcept
@@ -42,16 +49,117 @@ void SmartFileReader::SetFormat(const uint16_t format) noexcept {
             m_format = static_cast<uint16_t>(SmartFileFormat::V71);
         } break;
 
+        case static_cast<uint16_t>(SmartFileFormat::V72): {
+            m_format = static_cast<uint16_t>(SmartFileFormat::V72);
+        } break;
+
         default: {
             m_format = static_cast<uint16_t>(SmartFileFormat::UNSUPPORTED);
         } break;
     }
 }
 
-bool SmartFileReader::Open(const char* const path) noexcept {
+bool SmartFileReader::LoadFile(FILE* const file) noexcept {
+    long file_size{-1};
+
+    if (fseek(file, 0, SEEK_END) == 0) {
+        file_size = ftell(file);
+    }
+
+    if (file_size >= 0 && fseek(file, 0, SEEK_SET) == 0) {
+        data = new (std::nothrow) uint8_t[file_size > 0 ? file_size : 1];
+
+        if (data && file_size > 0 && fread(data, file_size, 1, file) != 1) {
+            delete[] data;
+            data = nullptr;
+
+        } else if (data) {
+            data_size = file_size;
+        }
+    }
+
+    return data != nullptr;
+}
+
+bool SmartFileReader::LoadSections(FILE* const file, const uint16_t section_limit) noexcept {
+    SmartFileSection sections[SMARTFILE_MAX_SECTIONS];
+    uint16_t section_count;
+    uint8_t* packed_data{nullptr};
+    uint64_t size{0};
+    size_t packed_size{0};
+    bool result;
+
+    result = fread(&section_count, sizeof(section_count), 1, file) == 1 && section_count > 0 &&
+             section_count <= SMARTFILE_MAX_SECTIONS &&
+             fread(sections, sizeof(SmartFileSection), section_count, file) == section_count;
+
+    if (result) {
+        const long header_size = ftell(file);
+        long file_size{-1};
+
+        if (header_size >= 0 && fseek(file, 0, SEEK_END) == 0) {
+            file_size = ftell(file);
+        }
+
+        result = file_size >= header_size && header_size >= 0;
+
+        section_count = std::min(section_count, section_limit);
+
+        /* reject section tables that point outside of the file or claim more data than the packed bytes can hold,
+         * a token of the codec expands to at most 255 bytes per input byte
+         */
+        for (uint16_t i = 0; result && i < section_count; ++i) {
+            const SmartFileSection& section = sections[i];
+
+            result = section.offset >= static_cast<uint64_t>(header_size) &&
+                     static_cast<uint64_t>(section.offset) + section.packed_size <= static_cast<uint64_t>(file_size) &&
+                     section.packed_size <= section.size && section.size / 255 <= section.packed_size;
+
+            size += section.size;
+            packed_size = std::max(packed_size, static_cast<size_t>(section.packed_size));
+        }
+
+        result = result && size <= SIZE_MAX;
+    }
+
+    if (result) {
+        data = new (std::nothrow) uint8_t[size > 0 ? size : 1];
+        packed_data = new (std::nothrow) uint8_t[packed_size > 0 ? packed_size : 1];
+
+        result = data && packed_data;
+    }
+
+    for (uint16_t i = 0; result && i < section_count; ++i) {
+        const SmartFileSection& section = sections[i];
+
+        result = fseek(file, section.offset, SEEK_SET) == 0;
+
+        if (result && section.packed_size == section.size) {
+            result = section.size == 0 || fread(&data[data_size], section.size, 1, file) == 1;
+
+        } else if (result) {
+            result = section.packed_size > 0 && fread(packed_data, section.packed_size, 1, file) == 1 &&
+                     LzCodec_Decompress(packed_data, section.packed_size, &data[data_size], section.size);
+        }
+
+        data_size += section.size;
+    }
+
+    delete[] packed_data;
+
+    if (!result) {
+        delete[] data;
+        data = nullptr;
+        data_size = 0;
+    }
+
+    return result;
+}
+
+bool SmartFileReader::Open(const char* const path, const uint16_t section_limit) noexcept {
     Close();
 
-    file = fopen(path, "rb");
+    FILE* file = fopen(path, "rb");
 
     if (file) {
         uint16_t format;
@@ -60,12 +168,19 @@ bool SmartFileReader::Open(const char* const path) noexcept {
             format = static_cast<uint16_t>(SmartFileFormat::UNSPECIFIED);
         }
 
-        fseek(file, 0, SEEK_SET);
-
         SetFormat(format);
+
+        if (m_format == static_cast<uint16_t>(SmartFileFormat::V72)) {
+            LoadSections(file, section_limit);
+
+        } else {
+            LoadFile(file);
+        }
+
+        fclose(file);
     }
 
-    return file != nullptr;
+    return data != nullptr;
 }
 
 bool SmartFileReader::Close() noexcept {
@@ -73,15 +188,28 @@ bool SmartFileReader::Close() noexcept {
 
     read_objects.Release();
 
-    if (file != nullptr) {
-        result = fclose(file) != EOF;
-        file = nullptr;
+    if (data != nullptr) {
+        delete[] data;
+        data = nullptr;
+        data_size = 0;
+        data_position = 0;
+        result = true;
     }
 
     return result;
 }
 
-bool SmartFileReader::Read(void* const buffer, const size_t size) noexcept { return fread(buffer, size, 1, file) == 1; }
+bool SmartFileReader::Read(void* const buffer, const size_t size) noexcept {
+    bool result{false};
+
+    if (data && size <= data_size - data_position) {
+        memcpy(buffer, &data[data_position], size);
+        data_position += size;
+        result = true;
+    }
+
+    return result;
+}
 
 void SmartFileReader::LoadObject(FileObject& object) noexcept {
     read_objects.Insert(&object);
@@ -127,7 +255,9 @@ void SmartFileReader::LoadObject(FileObject& object) noexcept {
 SmartFileWriter::SmartFileWriter() noexcept : m_format(static_cast<uint16_t>(SmartFileFormat::LATEST)) {};
 
 SmartFileWriter::SmartFileWriter(const char* const path) noexcept
-    : m_format(static_cast<uint16_t>(SmartFileFormat::LATEST)), file(fopen(path, "wb")) {}
+    : m_format(static_cast<uint16_t>(SmartFileFormat::LATEST)) {
+    Open(path);
+}
 
 SmartFileWriter::~SmartFileWriter() noexcept { Close(); }
 
@@ -136,9 +266,133 @@ bool SmartFileWriter::Open(const char* const path) noexcept {
 
     file = fopen(path, "wb");
 
+    if (file) {
+        BeginSection(0);
+    }
+
     return file != nullptr;
 }
 
+bool SmartFileWriter::OpenMemory() noexcept {
+    Close();
+
+    is_memory_only = true;
+
+    BeginSection(0);
+
+    return true;
+}
+
+void SmartFileWriter::BeginSection(const uint32_t id) noexcept {
+    if (section_count > 0 && sections[section_count - 1].offset == buffer_size) {
+        sections[section_count - 1].id = id;
+
+    } else {
+        SDL_assert(section_count < SMARTFILE_MAX_SECTIONS);
+
+        if (section_count < SMARTFILE_MAX_SECTIONS) {
+            sections[section_count].id = id;
+            sections[section_count].offset = buffer_size;
+            ++section_count;
+        }
+    }
+}
+
+static bool SmartFile_PackSections(uint8_t*& buffer, size_t& buffer_size, SmartFileSection* const sections,
+                                   uint16_t& section_count) noexcept {
+    const uint16_t format{static_cast<uint16_t>(SmartFileFormat::V72)};
+    const size_t header_size{sizeof(format) + sizeof(section_count) + sizeof(SmartFileSection) * section_count};
+    size_t capacity{header_size};
+    size_t position{header_size};
+
+    for (uint16_t i = 0; i < section_count; ++i) {
+        const size_t end = (i + 1 < section_count) ? sections[i + 1].offset : buffer_size;
+
+        sections[i].size = end - sections[i].offset;
+        capacity += LzCodec_GetBound(sections[i].size);
+    }
+
+    uint8_t* const image = new (std::nothrow) uint8_t[capacity];
+
+    if (!image) {
+        return false;
+    }
+
+    for (uint16_t i = 0; i < section_count; ++i) {
+        const uint8_t* const source = &buffer[sections[i].offset];
+        size_t packed_size = LzCodec_Compress(source, sections[i].size, &image[position], capacity - position);
+
+        /* sections that do not shrink are stored as is */
+        if (packed_size == 0 || packed_size >= sections[i].size) {
+            memcpy(&image[position], source, sections[i].size);
+            packed_size = sections[i].size;
+        }
+
+        sections[i].offset = position;
+        sections[i].packed_size = packed_size;
+        position += packed_size;
+    }
+
+    memcpy(image, &format, sizeof(format));
+    memcpy(&image[sizeof(format)], &section_count, sizeof(section_count));
+    memcpy(&image[sizeof(format) + sizeof(section_count)], sections, sizeof(SmartFileSection) * section_count);
+
+    delete[] buffer;
+    buffer = image;
+    buffer_size = position;
+    section_count = 0;
+
+    return true;
+}
+
+SmartFileImage::~SmartFileImage() noexcept { delete[] buffer; }
+
+[[nodiscard]] bool SmartFileImage::Pack() noexcept {
+    bool result{buffer != nullptr};
+
+    if (result && format == static_cast<uint16_t>(SmartFileFormat::V72) && section_count > 0) {
+        result = SmartFile_PackSections(buffer, buffer_size, sections, section_count);
+    }
+
+    return result;
+}
+
+[[nodiscard]] const uint8_t* SmartFileImage::GetData() const noexcept { return buffer; }
+
+[[nodiscard]] size_t SmartFileImage::GetSize() const noexcept { return buffer_size; }
+
+bool SmartFileWriter::Pack() noexcept {
+    const bool result = SmartFile_PackSections(buffer, buffer_size, sections, section_count);
+
+    if (result) {
+        buffer_capacity = buffer_size;
+    }
+
+    return result;
+}
+
+[[nodiscard]] bool SmartFileWriter::ReleaseBuffer(SmartFileImage& image) noexcept {
+    if (!is_memory_only || is_failed || !buffer || buffer_size == 0) {
+        return false;
+    }
+
+    delete[] image.buffer;
+
+    image.format = m_format;
+    image.buffer = buffer;
+    image.buffer_size = buffer_size;
+    image.section_count = section_count;
+
+    memcpy(image.sections, sections, sizeof(SmartFileSection) * section_count);
+
+    buffer = nullptr;
+    buffer_size = 0;
+    buffer_capacity = 0;
+    section_count = 0;
+
+    return true;
+}
+
 bool SmartFileWriter::Close() noexcept {
     bool result{false};
 
@@ -149,15 +403,81 @@ bool SmartFileWriter::Close() noexcept {
     objects.Clear();
 
     if (file != nullptr) {
-        result = fclose(file) != EOF;
+        result = Flush() && !is_failed;
+        result = (fclose(file) != EOF) && result;
         file = nullptr;
+
+    } else if (is_memory_only) {
+        is_memory_only = false;
+        result = !is_failed;
     }
 
+    is_failed = false;
+
+    delete[] buffer;
+    buffer = nullptr;
+    buffer_size = 0;
+    buffer_capacity = 0;
+    section_count = 0;
+
     return result;
 }
 
-bool SmartFileWriter::Write(const void* const buffer, const size_t size) noexcept {
-    return fwrite(buffer, size, 1, file) == 1;
+bool SmartFileWriter::Flush() noexcept {
+    bool result{true};
+
+    if (m_format == static_cast<uint16_t>(SmartFileFormat::V72) && section_count > 0) {
+        result = Pack();
+    }
+
+    if (result && buffer_size > 0) {
+        result = fwrite(buffer, buffer_size, 1, file) == 1;
+        buffer_size = 0;
+    }
+
+    return result;
+}
+
+bool SmartFileWriter::Write(const void* const data, const size_t size) noexcept {
+    bool result{false};
+
+    if (file != nullptr || is_memory_only) {
+        if (buffer_size + size > buffer_capacity) {
+            size_t capacity = buffer_capacity ? buffer_capacity : SMARTFILE_WRITER_BLOCK_SIZE;
+
+            while (capacity < buffer_size + size) {
+                capacity *= 2;
+            }
+
+            uint8_t* const new_buffer = new (std::nothrow) uint8_t[capacity];
+
+            if (new_buffer) {
+                if (buffer_size > 0) {
+                    memcpy(new_buffer, buffer, buffer_size);
+                }
+
+                delete[] buffer;
+                buffer = new_buffer;
+                buffer_capacity = capacity;
+            }
+        }
+
+        if (buffer_size + size <= buffer_capacity) {
+            memcpy(&buffer[buffer_size], data, size);
+            buffer_size += size;
+            result = true;
+
+        } else if (file != nullptr && m_format != static_cast<uint16_t>(SmartFileFormat::V72)) {
+            /* out of memory, fall back to writing through the stream */
+            result = Flush() && fwrite(data, size, 1, file) == 1;
+        }
+
+        if (!result) {
+            is_failed = true;
+        }
+    }
+
+    return result;
 }
 
 void SmartFileWriter::AddObject(FileObject* const object) noexcept {
@@ -208,6 +528,10 @@ SmartFileFormat SmartFileWriter::GetFormat() noexcept { return static_cast<Smart
             m_format = static_cast<uint16_t>(SmartFileFormat::V71);
         } break;
 
+        case static_cast<uint16_t>(SmartFileFormat::V72): {
+            m_format = static_cast<uint16_t>(SmartFileFormat::V72);
+        } break;
+
         default: {
             result = false;
         } break;
@@ -32,19 +32,39 @@ enum class SmartFileFormat : uint16_t {
     UNSPECIFIED = 0,
     V70 = 70,
     V71 = 71,
-    LATEST = 71,
+    V72 = 72,
+    LATEST = 72,
     UNSUPPORTED = 0xFFFF,
 };
 
+#define SMARTFILE_MAX_SECTIONS 16
+
+/// Section table entry of a V72 file. The V72 format stores the same object stream as V70, split into sections that
+/// are compressed independently and listed in a table behind the format field. Readers may load a leading subset of
+/// the sections, e.g. only the header, without touching the rest of the file.
+struct SmartFileSection {
+    uint32_t id;
+    uint32_t offset;
+    uint32_t size;
+    uint32_t packed_size;
+};
+
+/// Reads a serialized object graph. The whole file is loaded into memory by Open so that the many small field reads
+/// of the FileLoad implementations are plain memory copies. Sections of V72 files are decompressed on load, those
+/// beyond the section limit are skipped.
 class SmartFileReader {
     uint16_t m_format;
 
     void LoadObject(FileObject& object) noexcept;
     [[nodiscard]] uint16_t ReadIndex() noexcept;
     void SetFormat(const uint16_t format) noexcept;
+    bool LoadFile(FILE* file) noexcept;
+    bool LoadSections(FILE* file, uint16_t section_limit) noexcept;
 
 protected:
-    FILE* file{nullptr};
+    uint8_t* data{nullptr};
+    size_t data_size{0};
+    size_t data_position{0};
     SmartArray<FileObject> read_objects;
 
 public:
@@ -52,7 +72,7 @@ public:
     explicit SmartFileReader(const char* path) noexcept;
     ~SmartFileReader() noexcept;
 
-    bool Open(const char* path) noexcept;
+    bool Open(const char* path, uint16_t section_limit = UINT16_MAX) noexcept;
     bool Close() noexcept;
     bool Read(void* buffer, size_t size) noexcept;
     template <typename T>
@@ -62,14 +82,51 @@ public:
     [[nodiscard]] SmartFileFormat GetFormat() noexcept;
 };
 
+/// Serialized image taken over from a writer opened by OpenMemory. The sections of a V72 image are still uncompressed,
+/// Pack turns the image into the file layout so that the compression can run on a thread other than the one that
+/// wrote the objects.
+class SmartFileImage {
+    uint16_t format{static_cast<uint16_t>(SmartFileFormat::UNSPECIFIED)};
+    uint8_t* buffer{nullptr};
+    size_t buffer_size{0};
+    SmartFileSection sections[SMARTFILE_MAX_SECTIONS];
+    uint16_t section_count{0};
+
+    friend class SmartFileWriter;
+
+public:
+    SmartFileImage() noexcept = default;
+    ~SmartFileImage() noexcept;
+    SmartFileImage(const SmartFileImage&) = delete;
+    SmartFileImage& operator=(const SmartFileImage&) = delete;
+
+    [[nodiscard]] bool Pack() noexcept;
+    [[nodiscard]] const uint8_t* GetData() const noexcept;
+    [[nodiscard]] size_t GetSize() const noexcept;
+};
+
+/// Writes a serialized object graph. Fields are collected in a growable memory buffer that is written to the file
+/// with a single call when the writer is closed. A writer opened by OpenMemory has no file, the serialized image is
+/// taken over by the caller through ReleaseBuffer instead. A failed Write marks the whole image as incomplete, Close
+/// reports it and ReleaseBuffer refuses to hand the image over. In V72 format the buffer is split into sections by
+/// BeginSection and every section is compressed once the writer is done.
 class SmartFileWriter {
     uint16_t m_format;
 
     void SaveObject(FileObject* object) noexcept;
     void WriteIndex(uint16_t index) noexcept;
+    bool Pack() noexcept;
+    bool Flush() noexcept;
 
 protected:
     FILE* file{nullptr};
+    uint8_t* buffer{nullptr};
+    size_t buffer_size{0};
+    size_t buffer_capacity{0};
+    bool is_memory_only{false};
+    bool is_failed{false};
+    SmartFileSection sections[SMARTFILE_MAX_SECTIONS];
+    uint16_t section_count{0};
     SmartList<FileObject> objects;
 
     void AddObject(FileObject* object) noexcept;
@@ -80,7 +137,10 @@ public:
     ~SmartFileWriter() noexcept;
 
     bool Open(const char* path) noexcept;
+    bool OpenMemory() noexcept;
     bool Close() noexcept;
+    [[nodiscard]] bool ReleaseBuffer(SmartFileImage& image) noexcept;
+    void BeginSection(uint32_t id) noexcept;
     bool Write(const void* buffer, size_t size) noexcept;
     template <typename T>
     bool Write(const T& buffer) noexcept;
@@ -22,8 +22,84 @@
 #ifndef SMARTLIST_HPP
 #define SMARTLIST_HPP
 
+#include <SDL_thread.h>
+
+#include <cstddef>
+#include <new>
+#include <utility>
+
 #include "smartpointer.hpp"
 
+/// Free list allocator for the nodes of all lists with nodes of the same size. Nodes are carved out of blocks that
+/// are retained for the lifetime of the process so that growing and shrinking unit and task lists does not go through
+/// the heap and consecutive nodes tend to share cache lines. Like SmartObject reference counting the pool is not
+/// thread safe, so lists may only be created, modified and destroyed on the main thread. The path workers, the asset
+/// loader and the save thread must not touch SmartList instances, which is asserted in debug builds.
+template <size_t Size>
+class SmartListNodePool {
+    union Slot {
+        Slot* next;
+        alignas(std::max_align_t) uint8_t storage[Size];
+    };
+
+    struct Block {
+        Block* next;
+        Slot slots[256];
+    };
+
+    static inline Block* blocks{nullptr};
+    static inline Slot* free_slots{nullptr};
+    static inline SDL_threadID owner_thread{0};
+
+    [[nodiscard]] static inline bool IsOwnerThread() noexcept {
+        const SDL_threadID thread = SDL_ThreadID();
+
+        // the first list is set up on the main thread by the static initializers
+        if (owner_thread == 0) {
+            owner_thread = thread;
+        }
+
+        return owner_thread == thread;
+    }
+
+public:
+    [[nodiscard]] static inline void* Allocate() noexcept {
+        SDL_assert(IsOwnerThread());
+
+        if (!free_slots) {
+            Block* block = new (std::nothrow) Block;
+
+            if (!block) {
+                return nullptr;
+            }
+
+            block->next = blocks;
+            blocks = block;
+
+            for (auto& slot : block->slots) {
+                slot.next = free_slots;
+                free_slots = &slot;
+            }
+        }
+
+        Slot* slot = free_slots;
+        free_slots = slot->next;
+
+        return slot;
+    }
+
+    static inline void Free(void* pointer) noexcept {
+        SDL_assert(IsOwnerThread());
+
+        if (pointer) {
+            Slot* slot = static_cast<Slot*>(pointer);
+
+            slot->next = free_slots;
+            free_slots = slot;
+        }
+    }
+};
+
 template <class T>
 class SmartList {
     template <class N>
@@ -31,6 +107,7 @@ class SmartList {
         SmartPointer<N> object;
         SmartPointer<ListNode<N>> next;
         SmartPointer<ListNode<N>> prev;
+        bool is_linked{false};
 
         friend class SmartList;
 
@@ -39,7 +116,18 @@ class SmartList {
         explicit ListNode(N& object) noexcept : object(object) {}
         ~ListNode() noexcept override = default;
 
+        [[nodiscard]] static inline void* operator new(size_t size, const std::nothrow_t&) noexcept {
+            SDL_assert(size == sizeof(ListNode<N>));
+
+            return SmartListNodePool<sizeof(ListNode<N>)>::Allocate();
+        }
+
+        static inline void operator delete(void* pointer) noexcept {
+            SmartListNodePool<sizeof(ListNode<N>)>::Free(pointer);
+        }
+
         inline void InsertAfter(ListNode<N>& node) noexcept {
+            node.is_linked = true;
             node.next = this->next;
             node.prev = this;
             this->next->prev = node;
@@ -47,6 +135,7 @@ class SmartList {
         }
 
         inline void InsertBefore(ListNode<N>& node) noexcept {
+            node.is_linked = true;
             node.prev = this->prev;
             node.next = this;
             this->prev->next = node;
@@ -56,6 +145,7 @@ class SmartList {
         inline void RemoveSelf() noexcept {
             SmartPointer<ListNode<T>> backup(this);
 
+            is_linked = false;
             this->prev->next = this->next;
             this->next->prev = this->prev;
         }
@@ -63,8 +153,13 @@ class SmartList {
         [[nodiscard]] inline N* Get() const noexcept { return object.Get(); }
     };
 
+public:
+    class ListIterator;
+
+private:
     uint16_t count{0};
     SmartPointer<ListNode<T>> list_node;
+    mutable ListIterator* iterators{nullptr};
 
     [[nodiscard]] inline ListNode<T>& Get(int32_t index) const noexcept {
         Iterator it;
@@ -86,37 +181,144 @@ class SmartList {
     }
 
 public:
-    class ListIterator : public SmartPointer<ListNode<T>> {
+    /// Iterators do not hold a reference to the node they point to while it is linked into the list, so stepping
+    /// through a list does not touch any reference counts. Instead the list keeps track of its iterators and pins the
+    /// node of every iterator that points to a node being removed, which keeps the links of the removed node valid
+    /// until the iterator advances. Iterators that outlive their list pin their node the same way.
+    class ListIterator {
         friend class SmartList;
 
-        [[nodiscard]] ListNode<T>& GetNode() const noexcept { return *this->Get(); }
+        ListNode<T>* node{nullptr};
+        const SmartList<T>* list{nullptr};
+        ListIterator* prev_iterator{nullptr};
+        ListIterator* next_iterator{nullptr};
+        SmartPointer<ListNode<T>> pin;
+
+        [[nodiscard]] ListNode<T>& GetNode() const noexcept { return *node; }
+
+        inline void Attach(const SmartList<T>* owner) noexcept {
+            list = owner;
+
+            if (list) {
+                prev_iterator = nullptr;
+                next_iterator = list->iterators;
+
+                if (next_iterator) {
+                    next_iterator->prev_iterator = this;
+                }
+
+                list->iterators = this;
+            }
+        }
+
+        inline void Detach() noexcept {
+            if (list) {
+                if (prev_iterator) {
+                    prev_iterator->next_iterator = next_iterator;
+
+                } else {
+                    list->iterators = next_iterator;
+                }
+
+                if (next_iterator) {
+                    next_iterator->prev_iterator = prev_iterator;
+                }
+
+                list = nullptr;
+                prev_iterator = nullptr;
+                next_iterator = nullptr;
+            }
+        }
+
+        inline void Step(ListNode<T>* target) noexcept {
+            // the target is only pinned if the list cannot do it, the new pin is taken before the old one is released
+            if (list && target->is_linked) {
+                pin = nullptr;
+
+            } else {
+                pin = target;
+            }
+
+            node = target;
+        }
 
     protected:
-        ListIterator(const ListNode<T>* object) noexcept : SmartPointer<ListNode<T>>(object) {}
-        ListIterator(ListNode<T>& object) noexcept : SmartPointer<ListNode<T>>(object) {}
-        ListIterator(const ListNode<T>& object) noexcept : SmartPointer<ListNode<T>>(object) {}
-        ListIterator(SmartPointer<ListNode<T>>& object) noexcept : SmartPointer<ListNode<T>>(object) {}
-        ListIterator(const SmartPointer<ListNode<T>>& object) noexcept : SmartPointer<ListNode<T>>(object) {}
+        ListIterator(const SmartList<T>* owner, ListNode<T>* object) noexcept : node(object) {
+            Attach(owner);
+
+            if (!list) {
+                pin = node;
+            }
+        }
+
+        ListIterator(ListNode<T>& object) noexcept : node(&object), pin(object) {}
 
     public:
-        ListIterator() noexcept : SmartPointer<ListNode<T>>() {}
-        ListIterator(ListIterator& other) noexcept : SmartPointer<ListNode<T>>(other.GetNode()) {}
-        ListIterator(const ListIterator& other) noexcept : SmartPointer<ListNode<T>>(other.GetNode()) {}
+        ListIterator() noexcept = default;
+        ListIterator(const ListIterator& other) noexcept : node(other.node), pin(other.pin) { Attach(other.list); }
+        ListIterator(ListIterator&& other) noexcept : node(other.node), pin(std::move(other.pin)) {
+            Attach(other.list);
+            other.Detach();
+            other.node = nullptr;
+        }
+
+        ~ListIterator() noexcept { Detach(); }
+
+        inline ListIterator& operator=(const ListIterator& other) noexcept {
+            if (this != &other) {
+                if (list != other.list) {
+                    Detach();
+                    Attach(other.list);
+                }
+
+                pin = other.pin;
+                node = other.node;
+            }
+
+            return *this;
+        }
+
+        inline ListIterator& operator=(ListIterator&& other) noexcept {
+            if (this != &other) {
+                if (list != other.list) {
+                    Detach();
+                    Attach(other.list);
+                }
+
+                pin = std::move(other.pin);
+                node = other.node;
 
-        inline T& operator*() const noexcept { return *(this->Get()->Get()); }
+                other.Detach();
+                other.node = nullptr;
+            }
+
+            return *this;
+        }
+
+        [[nodiscard]] inline ListNode<T>* Get() const noexcept { return node; }
+
+        inline ListNode<T>* operator->() const noexcept { return node; }
+
+        inline T& operator*() const noexcept { return *(node->Get()); }
 
         inline ListIterator& operator++() noexcept {
-            // must not use operator=(ConstReference other) as the node could be deleted
-            SmartPointer<ListNode<T>>::operator=(*this->Get()->next);
+            Step(node->next.Get());
             return *this;
         }
 
         inline ListIterator& operator--() noexcept {
-            // must not use operator=(ConstReference other) as the node could be deleted
-            SmartPointer<ListNode<T>>::operator=(*this->Get()->prev);
+            Step(node->prev.Get());
             return *this;
         }
 
+        friend inline bool operator==(const ListIterator& lhs, const ListIterator& rhs) noexcept {
+            return lhs.node == rhs.node;
+        }
+
+        friend inline bool operator!=(const ListIterator& lhs, const ListIterator& rhs) noexcept {
+            return lhs.node != rhs.node;
+        }
+
         inline bool operator==(std::nullptr_t) = delete;
         inline bool operator!=(std::nullptr_t) = delete;
         inline operator bool() = delete;
@@ -128,44 +330,58 @@ public:
     SmartList() noexcept : list_node(new(std::nothrow) ListNode<T>()) {
         list_node->next = list_node;
         list_node->prev = list_node;
+        list_node->is_linked = true;
     }
 
     SmartList(const SmartList<T>& other) noexcept : list_node(new(std::nothrow) ListNode<T>()) {
         list_node->next = list_node;
         list_node->prev = list_node;
+        list_node->is_linked = true;
 
         for (Iterator it = other.Begin(); it != other.End(); ++it) {
             PushBack(*it);
         }
     }
 
-    ~SmartList() noexcept { Clear(); }
+    ~SmartList() noexcept {
+        Clear();
+
+        list_node->is_linked = false;
+
+        // iterators that outlive the list keep their nodes alive on their own
+        while (iterators) {
+            ListIterator* it = iterators;
 
-    [[nodiscard]] inline Iterator Begin() noexcept { return Iterator(list_node->next); }
-    [[nodiscard]] inline Iterator Begin() const noexcept { return Iterator(list_node->next); }
-    [[nodiscard]] inline Iterator End() noexcept { return Iterator(list_node); }
-    [[nodiscard]] inline Iterator End() const noexcept { return Iterator(list_node); }
+            it->pin = it->node;
+            it->Detach();
+        }
+    }
+
+    [[nodiscard]] inline Iterator Begin() noexcept { return Iterator(this, list_node->next.Get()); }
+    [[nodiscard]] inline Iterator Begin() const noexcept { return Iterator(this, list_node->next.Get()); }
+    [[nodiscard]] inline Iterator End() noexcept { return Iterator(this, list_node.Get()); }
+    [[nodiscard]] inline Iterator End() const noexcept { return Iterator(this, list_node.Get()); }
     [[nodiscard]] inline T& Front() const noexcept { return *Begin(); }
     [[nodiscard]] inline T& Back() const noexcept { return *(--End()); }
 
     /* compatibility interfaces */
-    [[nodiscard]] inline Iterator begin() noexcept { return Iterator(list_node->next); }
-    [[nodiscard]] inline Iterator begin() const noexcept { return Iterator(list_node->next); }
-    [[nodiscard]] inline Iterator end() noexcept { return Iterator(list_node); }
-    [[nodiscard]] inline Iterator end() const noexcept { return Iterator(list_node); }
+    [[nodiscard]] inline Iterator begin() noexcept { return Begin(); }
+    [[nodiscard]] inline Iterator begin() const noexcept { return Begin(); }
+    [[nodiscard]] inline Iterator end() noexcept { return End(); }
+    [[nodiscard]] inline Iterator end() const noexcept { return End(); }
 
     inline void PushBack(T& object) noexcept {
-        End()->InsertBefore(*(new (std::nothrow) ListNode<T>(object)));
+        list_node->InsertBefore(*(new (std::nothrow) ListNode<T>(object)));
         ++count;
     }
 
     inline void PushFront(T& object) noexcept {
-        Begin()->InsertBefore(*(new (std::nothrow) ListNode<T>(object)));
+        list_node->next->InsertBefore(*(new (std::nothrow) ListNode<T>(object)));
         ++count;
     }
 
     inline void InsertAfter(Iterator& position, T& object) noexcept {
-        if (position == list_node || position.Get() == nullptr) {
+        if (position.Get() == list_node.Get() || position.Get() == nullptr) {
             PushFront(object);
 
         } else {
@@ -175,7 +391,7 @@ public:
     }
 
     inline void InsertBefore(Iterator& position, T& object) noexcept {
-        if (position == list_node || position.Get() == nullptr) {
+        if (position.Get() == list_node.Get() || position.Get() == nullptr) {
             PushBack(object);
 
         } else {
@@ -187,7 +403,7 @@ public:
     [[nodiscard]] inline Iterator Find(T& object) const noexcept {
         for (Iterator it = Begin(), end = End(); it != end; ++it) {
             if (&*it == &object) {
-                return Iterator(it.GetNode());
+                return it;
             }
         }
 
@@ -205,7 +421,7 @@ public:
         Iterator it = Find(object);
 
         if (it != End()) {
-            Erase(it);
+            Erase(it.GetNode());
             result = true;
 
         } else {
@@ -219,13 +435,13 @@ public:
         Iterator it = Find(*position);
 
         if (it != End()) {
-            Erase(it);
+            Erase(it.GetNode());
         }
     }
 
     inline void Clear() noexcept {
-        while (Begin() != End()) {
-            Erase(Begin());
+        while (list_node->next != list_node) {
+            Erase(*list_node->next);
         }
 
         SDL_assert(count == 0 && Begin() == End());
@@ -258,9 +474,15 @@ public:
     }
 
 private:
-    inline void Erase(Iterator position) noexcept {
-        if (list_node != position.Get()) {
-            position->RemoveSelf();
+    inline void Erase(ListNode<T>& node) noexcept {
+        if (list_node != node) {
+            for (ListIterator* it = iterators; it; it = it->next_iterator) {
+                if (it->node == &node) {
+                    it->pin = node;
+                }
+            }
+
+            node.RemoveSelf();
             --count;
         }
 
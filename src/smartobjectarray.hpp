@@ -25,6 +25,7 @@
 #include <cstdint>
 #include <cstring>
 #include <type_traits>
+#include <utility>
 
 #include "smartfile.hpp"
 
@@ -139,6 +140,12 @@ public:
         : SmartPointer<ObjectSmartArrayData<T>>(deep_copy ? (*new(std::nothrow) ObjectSmartArrayData<T>(*other.Get()))
                                                           : (*other.Get())) {}
 
+    /// The moved from array does not reference any storage and may only be assigned to or destroyed.
+    SmartObjectArray(SmartObjectArray&& other) noexcept : SmartPointer<ObjectSmartArrayData<T>>(std::move(other)) {}
+
+    SmartObjectArray& operator=(const SmartObjectArray& other) noexcept = default;
+    SmartObjectArray& operator=(SmartObjectArray&& other) noexcept = default;
+
     inline void Clear() noexcept { GetArray()->Clear(); }
     [[nodiscard]] inline T* operator[](uint16_t position) const noexcept { return (*GetArray())[position]; }
     [[nodiscard]] inline uint16_t GetCount() const noexcept { return GetArray()->GetCount(); }
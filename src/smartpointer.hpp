@@ -82,6 +82,10 @@ public:
         }
     }
 
+    SmartPointer(SmartPointer<T>&& other) noexcept : object_pointer(other.object_pointer) {
+        other.object_pointer = nullptr;
+    }
+
     ~SmartPointer() noexcept {
         if (object_pointer) {
             object_pointer->Decrement();
@@ -106,6 +110,23 @@ public:
         return *this;
     }
 
+    Reference operator=(SmartPointer<T>&& other) noexcept {
+        if (this != &other) {
+            // other could be owned by the released object
+            T* object = other.object_pointer;
+
+            other.object_pointer = nullptr;
+
+            if (object_pointer) {
+                object_pointer->Decrement();
+            }
+
+            object_pointer = object;
+        }
+
+        return *this;
+    }
+
     Reference operator=(T* other) noexcept {
         if (other) {
             other->Increment();
@@ -136,6 +157,25 @@ public:
 
     inline T* Get() const noexcept { return object_pointer; };
 
+    /// Gives up ownership without touching the reference count. The reference held so far has to be handed back to a
+    /// smart pointer via Adopt() eventually.
+    [[nodiscard]] inline T* Release() noexcept {
+        T* object = object_pointer;
+
+        object_pointer = nullptr;
+
+        return object;
+    }
+
+    /// Takes over a reference previously given up by Release() without touching the reference count.
+    inline void Adopt(T* object) noexcept {
+        if (object_pointer) {
+            object_pointer->Decrement();
+        }
+
+        object_pointer = object;
+    }
+
     friend inline bool operator==(ConstReference lhs, ConstReference rhs) noexcept { return lhs.Get() == rhs.Get(); }
 
     friend inline bool operator==(ConstReference lhs, const T* rhs) noexcept { return lhs.Get() == rhs; }
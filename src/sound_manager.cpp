@@ -30,12 +30,15 @@
 #include "gnw.h"
 #include "inifile.hpp"
 #include "localization.hpp"
+#include "lrulist.hpp"
 #include "miniaudio.h"
 #include "mvelib32.h"
 #include "resource_manager.hpp"
+#include "units_manager.hpp"
 
 #define SOUND_MANAGER_SAMPLE_RATE (48000)
 #define SOUND_MANAGER_CHANNELS (2)
+#define SOUND_MANAGER_BUFFER_CACHE_SIZE (32 * 1024 * 1024)
 
 #define SOUND_MANAGER_MAX_VOLUME (1.f)
 #define SOUND_MANAGER_PANNING_LEFT (-1.f)
@@ -71,6 +74,24 @@ public:
     uint16_t unit_id{0xFFFF};
 };
 
+class SoundBuffer : public SmartObject {
+public:
+    virtual ~SoundBuffer() { ma_free(frames, nullptr); }
+
+    void* frames{nullptr};
+    ma_uint64 frame_count{0};
+    ma_uint32 channels{0};
+    size_t size{0};
+    ResourceID id{INVALID_ID};
+    uint32_t loop_point_start{0};
+    int32_t loop_point_length{0};
+};
+
+/* cache entry of a decoded buffer, the cache holds a reference so that the buffer outlives its users */
+struct SoundBufferEntry : public LruListNode<SoundBufferEntry> {
+    SmartPointer<SoundBuffer> buffer;
+};
+
 class SoundSample : public SmartObject {
 public:
     virtual ~SoundSample() {
@@ -78,9 +99,16 @@ public:
             ma_sound_uninit(&sound);
             initialized = false;
         }
+
+        if (is_buffered) {
+            ma_audio_buffer_uninit(&buffer);
+            is_buffered = false;
+        }
     }
 
     ma_sound sound;
+    ma_audio_buffer buffer;
+    SmartPointer<SoundBuffer> data;
     ResourceID id{INVALID_ID};
     JOB_TYPE type{JOB_TYPE_INVALID};
     float volume_1{0.f};
@@ -93,6 +121,7 @@ public:
     int32_t loop_point_length{0};
     uint8_t fade_out{SOUND_MANAGER_NO_FADING};
     bool initialized{false};
+    bool is_buffered{false};
 };
 
 class SoundGroup : public SmartObject {
@@ -176,6 +205,8 @@ public:
     void FreeMusic() noexcept;
     void FreeAllSamples() noexcept;
 
+    void PrewarmSfx(const ResourceID unit_type) noexcept;
+
     void ProcessJobs() noexcept;
 
 private:
@@ -196,6 +227,10 @@ private:
 
     SmartList<SoundJob> jobs;
 
+    SoundBufferEntry* buffer_entries[RESOURCE_E]{};
+    LruList<SoundBufferEntry> buffers;
+    size_t buffers_size{0};
+
     SmartPointer<SoundSample> music;
     SmartPointer<SoundSample> voice;
     SmartPointer<SoundSample> sfx;
@@ -210,7 +245,11 @@ private:
     [[nodiscard]] static float GetPanning(int32_t distance, const bool reverse) noexcept;
     [[nodiscard]] bool PlayMusic(const ResourceID id) noexcept;
     int32_t LoadSound(SoundJob& job, SoundSample& sample) noexcept;
-    void LoadLoopPoints(FILE* const fp, SoundSample& sample) noexcept;
+    [[nodiscard]] SmartPointer<SoundBuffer> GetBuffer(const ResourceID id, const ResourceType type) noexcept;
+    [[nodiscard]] SmartPointer<SoundBuffer> LoadBuffer(const ResourceID id, const ResourceType type) noexcept;
+    void FreeBuffer(SoundBufferEntry* const entry) noexcept;
+    void PrewarmBuffer(const int32_t resource_id) noexcept;
+    void LoadLoopPoints(FILE* const fp, uint32_t& loop_point_start, int32_t& loop_point_length) noexcept;
 };
 
 static SoundManager SoundManager_Manager;
@@ -322,6 +361,10 @@ void SoundManager::Deinit() noexcept {
 
     jobs.Clear();
 
+    while (buffers.Back()) {
+        FreeBuffer(buffers.Back());
+    }
+
     DeinitVolumeTable();
 }
 
@@ -645,6 +688,10 @@ void SoundManager::PlaySfx(UnitInfo* const unit, const int32_t sound, const bool
 }
 
 void SoundManager::UpdateSfxPosition() noexcept {
+    if (!is_audio_enabled) {
+        return;
+    }
+
     const int32_t grid_center_x = (GameManager_MapView.ulx + GameManager_MapView.lrx) / 2;
     const int32_t grid_center_y = (GameManager_MapView.uly + GameManager_MapView.lry) / 2;
 
@@ -691,8 +738,11 @@ void SoundManager::UpdateSfxPosition(UnitInfo* const unit) noexcept {
 
 void SoundManager::HaltSfxPlayback(const bool disable) noexcept {
     if (disable) {
-        for (auto it = sfx_group->GetSamples()->Begin(), it_end = sfx_group->GetSamples()->End(); it != it_end; ++it) {
-            FreeSample(it->Get());
+        if (is_audio_enabled) {
+            for (auto it = sfx_group->GetSamples()->Begin(), it_end = sfx_group->GetSamples()->End(); it != it_end;
+                 ++it) {
+                FreeSample(it->Get());
+            }
         }
 
     } else if (GameManager_SelectedUnit != nullptr) {
@@ -1067,10 +1117,39 @@ int32_t SoundManager::LoadSound(SoundJob& job, SoundSample& sample) noexcept {
         flags = MA_SOUND_FLAG_NO_SPATIALIZATION | MA_SOUND_FLAG_DECODE;
     }
 
+    if (JOB_TYPE_MUSIC != job.type) {
+        /* sound effects and voices are played from decoded buffers that are shared by all instances */
+        SmartPointer<SoundBuffer> data = GetBuffer(job.id, type);
+
+        if (data) {
+            ma_audio_buffer_config config =
+                ma_audio_buffer_config_init(ma_format_f32, data->channels, data->frame_count, data->frames, nullptr);
+
+            config.sampleRate = SOUND_MANAGER_SAMPLE_RATE;
+
+            if (ma_audio_buffer_init(&config, &sample.buffer) == MA_SUCCESS) {
+                sample.is_buffered = true;
+
+                /* same flags as the streamed path, the decode and stream flags have no effect on a data source */
+                if (ma_sound_init_from_data_source(engine, &sample.buffer, flags, group, &sample.sound) == MA_SUCCESS) {
+                    sample.initialized = true;
+                    sample.data = data;
+                    sample.loop_point_start = data->loop_point_start;
+                    sample.loop_point_length = data->loop_point_length;
+
+                    return 0;
+                }
+
+                ma_audio_buffer_uninit(&sample.buffer);
+                sample.is_buffered = false;
+            }
+        }
+    }
+
     auto fp{ResourceManager_OpenFileResource(job.id, type, "rb", &filepath)};
 
     if (fp) {
-        LoadLoopPoints(fp, sample);
+        LoadLoopPoints(fp, sample.loop_point_start, sample.loop_point_length);
         fclose(fp);
 
         if (ma_sound_init_from_file(engine, filepath.string().c_str(), flags, group, nullptr, &sample.sound) ==
@@ -1089,12 +1168,144 @@ int32_t SoundManager::LoadSound(SoundJob& job, SoundSample& sample) noexcept {
     return result;
 }
 
-void SoundManager::LoadLoopPoints(FILE* const fp, SoundSample& sample) noexcept {
+SmartPointer<SoundBuffer> SoundManager::GetBuffer(const ResourceID id, const ResourceType type) noexcept {
+    SmartPointer<SoundBuffer> result;
+
+    SDL_assert(id >= 0 && id < RESOURCE_E);
+
+    if (buffer_entries[id]) {
+        buffers.MoveToFront(buffer_entries[id]);
+
+        return buffer_entries[id]->buffer;
+    }
+
+    result = LoadBuffer(id, type);
+
+    if (result) {
+        SoundBufferEntry* entry = new (std::nothrow) SoundBufferEntry;
+
+        if (entry) {
+            entry->buffer = result;
+
+            buffer_entries[id] = entry;
+            buffers.PushFront(entry);
+            buffers_size += result->size;
+
+            /* instances that still play an evicted buffer keep it alive until they are freed */
+            while (buffers_size > SOUND_MANAGER_BUFFER_CACHE_SIZE && buffers.GetCount() > 1) {
+                FreeBuffer(buffers.Back());
+            }
+        }
+    }
+
+    return result;
+}
+
+void SoundManager::FreeBuffer(SoundBufferEntry* const entry) noexcept {
+    buffers.Remove(entry);
+    buffers_size -= entry->buffer->size;
+    buffer_entries[entry->buffer->id] = nullptr;
+
+    delete entry;
+}
+
+SmartPointer<SoundBuffer> SoundManager::LoadBuffer(const ResourceID id, const ResourceType type) noexcept {
+    SmartPointer<SoundBuffer> result;
+    std::filesystem::path filepath;
+    auto fp{ResourceManager_OpenFileResource(id, type, "rb", &filepath)};
+
+    if (fp) {
+        SmartPointer<SoundBuffer> buffer(new (std::nothrow) SoundBuffer);
+        ma_decoder_config config = ma_decoder_config_init(ma_format_f32, 0, SOUND_MANAGER_SAMPLE_RATE);
+        ma_decoder decoder;
+
+        if (!buffer) {
+            fclose(fp);
+
+            return result;
+        }
+
+        buffer->id = id;
+
+        LoadLoopPoints(fp, buffer->loop_point_start, buffer->loop_point_length);
+        fclose(fp);
+
+        if (ma_decoder_init_file(filepath.string().c_str(), &config, &decoder) == MA_SUCCESS) {
+            ma_uint64 frame_count;
+
+            if (ma_decoder_get_length_in_pcm_frames(&decoder, &frame_count) == MA_SUCCESS && frame_count > 0) {
+                buffer->channels = decoder.outputChannels;
+                buffer->size = frame_count * buffer->channels * sizeof(float);
+                buffer->frames = ma_malloc(buffer->size, nullptr);
+
+                if (buffer->frames) {
+                    ma_decoder_read_pcm_frames(&decoder, buffer->frames, frame_count, &buffer->frame_count);
+
+                    if (buffer->frame_count > 0) {
+                        result = buffer;
+                    }
+                }
+            }
+
+            ma_decoder_uninit(&decoder);
+        }
+    }
+
+    return result;
+}
+
+void SoundManager::PrewarmSfx(const ResourceID unit_type) noexcept {
+    const std::vector<SoundElement>* const sound_table = UnitInfo_GetSoundTable(unit_type);
+
+    if (is_audio_enabled && !ini_get_setting(INI_DISABLE_FX) && sound_table) {
+        const uint32_t amphibious_flags = MOBILE_LAND_UNIT | MOBILE_SEA_UNIT;
+        const bool is_amphibious = (UnitsManager_BaseUnits[unit_type].flags & amphibious_flags) == amphibious_flags;
+
+        for (const auto& element : *sound_table) {
+            /* only the effects that are triggered in bulk during battles and unit movements are decoded up front */
+            if (element.type == SFX_TYPE_DRIVE || element.type == SFX_TYPE_STOP || element.type == SFX_TYPE_FIRE ||
+                element.type == SFX_TYPE_HIT || element.type == SFX_TYPE_EXPLOAD) {
+                PrewarmBuffer(element.resource_id);
+
+                /* amphibious units at sea play the effect that follows the land effect, see PlaySfx() */
+                if (is_amphibious && element.type >= SFX_TYPE_IDLE && element.type <= SFX_TYPE_STOP) {
+                    PrewarmBuffer(element.resource_id + 1);
+                }
+            }
+        }
+    }
+}
+
+void SoundManager::PrewarmBuffer(const int32_t resource_id) noexcept {
+    if (resource_id > FXS_STRT && resource_id < FXS_END) {
+        const int32_t volume_index = resource_id - GEN_IDLE;
+
+        if (volumes[volume_index].flags != 1) {
+            if (GetBuffer(static_cast<ResourceID>(resource_id), ResourceType_Sfx)) {
+                volumes[volume_index].flags = 0;
+
+            } else if (volumes[volume_index].flags == -1) {
+                /* effects that fail to decode are streamed from the file, only a missing file silences them */
+                auto fp{ResourceManager_OpenFileResource(static_cast<ResourceID>(resource_id), ResourceType_Sfx)};
+
+                if (fp) {
+                    volumes[volume_index].flags = 0;
+                    fclose(fp);
+
+                } else {
+                    volumes[volume_index].flags = 1;
+                }
+            }
+        }
+    }
+}
+
+void SoundManager::LoadLoopPoints(FILE* const fp, uint32_t& loop_point_start, int32_t& loop_point_length) noexcept {
     char chunk_id[4];
     uint32_t chunk_size;
 
-    sample.loop_point_start = 0;
-    sample.loop_point_length = 0;
+    loop_point_start = 0;
+    loop_point_length = 0;
 
     if (fread(chunk_id, sizeof(chunk_id), 1, fp)) {
         if (!strncmp(chunk_id, "RIFF", sizeof(chunk_id))) {
@@ -1136,7 +1347,7 @@ void SoundManager::LoadLoopPoints(FILE* const fp, SoundSample& sample) noexcept
                                     for (uint32_t i = 0; i < sampler_chunk.num_sample_loops &&
                                                          fread(&sample_loop, sizeof(sample_loop), 1, fp);
                                          ++i) {
-                                        sample.loop_point_start =
+                                        loop_point_start =
                                             (static_cast<uint64_t>(sample_loop.start) * SOUND_MANAGER_SAMPLE_RATE *
                                              sampler_chunk.sample_period) /
                                             1000000000LL;
@@ -1146,7 +1357,7 @@ void SoundManager::LoadLoopPoints(FILE* const fp, SoundSample& sample) noexcept
                                              sampler_chunk.sample_period) /
                                             1000000000LL;
 
-                                        sample.loop_point_length = loop_point_end - sample_loop.start;
+                                        loop_point_length = loop_point_end - sample_loop.start;
 
                                         return; /* only one loop point is supported */
                                     }
@@ -1198,6 +1409,10 @@ void SoundManager_HaltVoicePlayback(const bool disable) noexcept { SoundManager_
 
 void SoundManager_FreeAllSamples() noexcept { SoundManager_Manager.FreeAllSamples(); }
 
+void SoundManager_PrewarmSfx(const ResourceID unit_type) noexcept {
+    SoundManager_Manager.PrewarmSfx(unit_type);
+}
+
 void SoundManager_SetVolume(const int32_t type, const float volume) noexcept {
     SoundManager_Manager.SetVolume(type, volume);
 }
@@ -45,6 +45,7 @@ void SoundManager_HaltSfxPlayback(const bool disable) noexcept;
 void SoundManager_PlayVoice(const ResourceID id1, const ResourceID id2, const int16_t priority = 0) noexcept;
 void SoundManager_HaltVoicePlayback(const bool disable) noexcept;
 void SoundManager_FreeAllSamples() noexcept;
+void SoundManager_PrewarmSfx(const ResourceID unit_type) noexcept;
 void SoundManager_SetVolume(const int32_t type, const float volume) noexcept;
 
 #endif /* SOUND_MANAGER_HPP */
@@ -0,0 +1,167 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "spritecache.hpp"
+
+#include <cstring>
+#include <new>
+
+bool SpriteCacheKey::operator==(const SpriteCacheKey &other) const {
+    return frame == other.frame && color_indices == other.color_indices && width == other.width &&
+           height == other.height && brightness == other.brightness && team_color == other.team_color;
+}
+
+SpriteCache::SpriteCache(size_t memory_limit)
+    : buckets(nullptr), memory_usage(0), memory_limit(memory_limit) {}
+
+SpriteCache::~SpriteCache() {
+    Clear();
+
+    delete[] buckets;
+}
+
+uint32_t SpriteCache::Hash(const SpriteCacheKey &key) {
+    uint64_t hash = reinterpret_cast<uintptr_t>(key.frame) ^ (reinterpret_cast<uintptr_t>(key.color_indices) << 7);
+
+    hash ^= (static_cast<uint64_t>(key.width) << 32) ^ (static_cast<uint64_t>(key.height) << 48);
+    hash ^= (static_cast<uint64_t>(key.brightness) << 16) ^ (static_cast<uint64_t>(key.team_color) << 24);
+    hash *= UINT64_C(0x9E3779B97F4A7C15);
+
+    return static_cast<uint32_t>(hash >> 32) % SPRITECACHE_BUCKET_COUNT;
+}
+
+void SpriteCache::Remove(SpriteCacheEntry *entry) {
+    SpriteCacheEntry **link = &buckets[Hash(entry->key)];
+
+    while (*link != entry) {
+        link = &(*link)->bucket_next;
+    }
+
+    *link = entry->bucket_next;
+
+    lru.Remove(entry);
+
+    memory_usage -= entry->size;
+
+    delete[] entry->pixels;
+    delete[] entry->spans;
+    delete[] entry->row_spans;
+    delete entry;
+}
+
+void SpriteCache::Clear() {
+    while (lru.Back()) {
+        Remove(lru.Back());
+    }
+}
+
+const SpriteCacheEntry *SpriteCache::Find(const SpriteCacheKey &key) {
+    if (!buckets) {
+        return nullptr;
+    }
+
+    for (SpriteCacheEntry *entry = buckets[Hash(key)]; entry; entry = entry->bucket_next) {
+        if (entry->key == key) {
+            lru.MoveToFront(entry);
+
+            return entry;
+        }
+    }
+
+    return nullptr;
+}
+
+const SpriteCacheEntry *SpriteCache::Insert(const SpriteCacheKey &key, const uint8_t *pixels, const SpriteSpan *spans,
+                                            uint32_t span_count) {
+    const size_t pixel_count = pixels ? key.width * key.height : 0;
+    const size_t size = sizeof(SpriteCacheEntry) + pixel_count + span_count * sizeof(SpriteSpan) +
+                        (key.height + 1) * sizeof(uint32_t);
+
+    if (size > memory_limit) {
+        return nullptr;
+    }
+
+    if (!buckets) {
+        buckets = new (std::nothrow) SpriteCacheEntry *[SPRITECACHE_BUCKET_COUNT]();
+
+        if (!buckets) {
+            return nullptr;
+        }
+    }
+
+    while (lru.Back() && memory_usage + size > memory_limit) {
+        Remove(lru.Back());
+    }
+
+    SpriteCacheEntry *entry = new (std::nothrow) SpriteCacheEntry();
+
+    if (!entry) {
+        return nullptr;
+    }
+
+    entry->key = key;
+    entry->pixels = pixel_count ? new (std::nothrow) uint8_t[pixel_count] : nullptr;
+    entry->spans = new (std::nothrow) SpriteSpan[span_count + 1];
+    entry->row_spans = new (std::nothrow) uint32_t[key.height + 1];
+    entry->span_count = span_count;
+    entry->size = size;
+
+    if ((pixel_count && !entry->pixels) || !entry->spans || !entry->row_spans) {
+        delete[] entry->pixels;
+        delete[] entry->spans;
+        delete[] entry->row_spans;
+        delete entry;
+
+        return nullptr;
+    }
+
+    if (pixel_count) {
+        memcpy(entry->pixels, pixels, pixel_count);
+    }
+
+    if (span_count) {
+        memcpy(entry->spans, spans, span_count * sizeof(SpriteSpan));
+    }
+
+    /* spans are ordered by offset, the first span of each row is indexed to skip clipped rows */
+    for (uint32_t row = 0, span = 0; row <= key.height; ++row) {
+        while (span < span_count && spans[span].offset < row * key.width) {
+            ++span;
+        }
+
+        entry->row_spans[row] = span;
+    }
+
+    SpriteCacheEntry **bucket = &buckets[Hash(key)];
+
+    entry->bucket_next = *bucket;
+    *bucket = entry;
+
+    lru.PushFront(entry);
+
+    memory_usage += size;
+
+    return entry;
+}
+
+size_t SpriteCache::GetMemoryUsage() const { return memory_usage; }
+
+int32_t SpriteCache::GetEntryCount() const { return lru.GetCount(); }
@@ -0,0 +1,84 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SPRITECACHE_HPP
+#define SPRITECACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include "lrulist.hpp"
+
+#define SPRITECACHE_MEMORY_LIMIT (32 * 1024 * 1024)
+#define SPRITECACHE_BUCKET_COUNT 4096
+
+struct SpriteCacheKey {
+    const void *frame;
+    const void *color_indices;
+    uint16_t width;
+    uint16_t height;
+    uint8_t brightness;
+    uint8_t team_color;
+
+    bool operator==(const SpriteCacheKey &other) const;
+};
+
+struct SpriteSpan {
+    uint32_t offset;
+    uint32_t length;
+};
+
+struct SpriteCacheEntry : public LruListNode<SpriteCacheEntry> {
+    SpriteCacheKey key;
+    SpriteCacheEntry *bucket_next;
+    uint8_t *pixels;
+    SpriteSpan *spans;
+    uint32_t *row_spans;
+    uint32_t span_count;
+    size_t size;
+};
+
+/// Least recently used cache of sprite frames that are already scaled and color translated. An entry holds the
+/// opaque spans of the frame row by row and, for sprites, the pixels behind them. Shadow entries only hold the spans.
+/// Entries are evicted once the memory limit is exceeded.
+class SpriteCache {
+    SpriteCacheEntry **buckets;
+    LruList<SpriteCacheEntry> lru;
+    size_t memory_usage;
+    size_t memory_limit;
+
+    static uint32_t Hash(const SpriteCacheKey &key);
+
+    void Remove(SpriteCacheEntry *entry);
+
+public:
+    explicit SpriteCache(size_t memory_limit = SPRITECACHE_MEMORY_LIMIT);
+    ~SpriteCache();
+
+    void Clear();
+    const SpriteCacheEntry *Find(const SpriteCacheKey &key);
+    const SpriteCacheEntry *Insert(const SpriteCacheKey &key, const uint8_t *pixels, const SpriteSpan *spans,
+                                   uint32_t span_count);
+    size_t GetMemoryUsage() const;
+    int32_t GetEntryCount() const;
+};
+
+#endif /* SPRITECACHE_HPP */
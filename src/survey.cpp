@@ -29,6 +29,27 @@
 #include "units_manager.hpp"
 #include "window_manager.hpp"
 
+/* the last table serves queries that ignore the survey state of the team */
+#define SURVEY_RESOURCE_TABLE_ALL_TEAMS (PLAYER_TEAM_MAX)
+#define SURVEY_RESOURCE_TABLE_COUNT (PLAYER_TEAM_MAX + 1)
+
+enum { SURVEY_RESOURCE_RAW, SURVEY_RESOURCE_GOLD, SURVEY_RESOURCE_FUEL, SURVEY_RESOURCE_TYPES };
+
+/// Summed-area table of the capped resource amounts that are visible with a given survey mask. Entry (x, y) holds the
+/// totals of all grid cells left of x and above y, so any rectangle is resolved with four lookups. Rows from
+/// dirty_row onwards are out of date and are rebuilt on the next query.
+struct SurveyResourceTable {
+    int32_t* sums;
+    int32_t dirty_row;
+};
+
+static SurveyResourceTable Survey_ResourceTables[SURVEY_RESOURCE_TABLE_COUNT];
+static Point Survey_ResourceTableSize;
+static const uint16_t* Survey_ResourceTableCargoMap;
+
+static void Survey_MarkResourceTableDirty(int32_t table, int32_t grid_y);
+static const int32_t* Survey_GetResourceTable(int32_t table, uint16_t mask);
+
 void Survey_RenderMarker(WindowInfo* window, int32_t grid_x, int32_t grid_y, uint16_t material_type) {
     int32_t resource_value;
     ResourceID marker_big;
@@ -106,11 +127,14 @@ void Survey_SurveyArea(UnitInfo* unit, int32_t radius) {
                 }
 
                 if (unit->GetUnitType() == SURVEYOR) {
-                    if (team == GameManager_PlayerTeam &&
-                        !(ResourceManager_CargoMap[ResourceManager_MapSize.x * j + i] &
+                    if (!(ResourceManager_CargoMap[ResourceManager_MapSize.x * j + i] &
                           team_info->team_units->hash_team_id)) {
-                        rect_init(&bounds, i * 64, j * 64, i * 64 + 63, j * 64 + 63);
-                        GameManager_AddDrawBounds(&bounds);
+                        if (team == GameManager_PlayerTeam) {
+                            rect_init(&bounds, i * 64, j * 64, i * 64 + 63, j * 64 + 63);
+                            GameManager_AddDrawBounds(&bounds);
+                        }
+
+                        Survey_MarkResourceTableDirty(team, j);
                     }
 
                     ResourceManager_CargoMap[ResourceManager_MapSize.x * j + i] |= team_info->team_units->hash_team_id;
@@ -154,40 +178,126 @@ void Survey_RenderMarkers(uint16_t team, int32_t grid_ulx, int32_t grid_uly, int
     }
 }
 
-void Survey_GetResourcesInArea(int32_t grid_x, int32_t grid_y, int32_t radius, int32_t resource_limit, int16_t* raw,
-                               int16_t* gold, int16_t* fuel, bool mode, uint16_t team) {
-    CTInfo* team_info;
-    uint16_t mask;
-    uint16_t value;
+void Survey_InvalidateResourceTables() {
+    for (int32_t i = 0; i < SURVEY_RESOURCE_TABLE_COUNT; ++i) {
+        Survey_ResourceTables[i].dirty_row = 0;
+    }
+}
 
-    team_info = &UnitsManager_TeamInfo[team];
+void Survey_MarkResourceTableDirty(int32_t table, int32_t grid_y) {
+    if (Survey_ResourceTables[table].dirty_row > grid_y) {
+        Survey_ResourceTables[table].dirty_row = grid_y;
+    }
+}
 
-    *raw = 0;
-    *gold = 0;
-    *fuel = 0;
+void Survey_FreeResourceTables() {
+    for (int32_t i = 0; i < SURVEY_RESOURCE_TABLE_COUNT; ++i) {
+        delete[] Survey_ResourceTables[i].sums;
+        Survey_ResourceTables[i].sums = nullptr;
+        Survey_ResourceTables[i].dirty_row = 0;
+    }
 
-    if (mode) {
-        mask = 0xFFFF;
-    } else {
-        mask = 0x0000;
+    Survey_ResourceTableSize = Point(0, 0);
+    Survey_ResourceTableCargoMap = nullptr;
+}
+
+const int32_t* Survey_GetResourceTable(int32_t table, uint16_t mask) {
+    const int32_t stride = (ResourceManager_MapSize.x + 1) * SURVEY_RESOURCE_TYPES;
+
+    if (Survey_ResourceTableSize != ResourceManager_MapSize ||
+        Survey_ResourceTableCargoMap != ResourceManager_CargoMap) {
+        Survey_FreeResourceTables();
+
+        Survey_ResourceTableSize = ResourceManager_MapSize;
+        Survey_ResourceTableCargoMap = ResourceManager_CargoMap;
     }
 
-    mask |= team_info->team_units->hash_team_id;
+    SurveyResourceTable* resource_table = &Survey_ResourceTables[table];
+
+    if (!resource_table->sums) {
+        resource_table->sums = new (std::nothrow) int32_t[stride * (ResourceManager_MapSize.y + 1)];
+        resource_table->dirty_row = 0;
 
-    for (int32_t i = grid_x; i <= std::min(ResourceManager_MapSize.x - 1, grid_x + radius); ++i) {
-        for (int32_t j = grid_y; j <= std::min(ResourceManager_MapSize.y - 1, grid_y + radius); ++j) {
-            value = ResourceManager_CargoMap[ResourceManager_MapSize.x * j + i];
+        if (!resource_table->sums) {
+            return nullptr;
+        }
+
+        /* the first row and column stay zero */
+        memset(resource_table->sums, 0, stride * sizeof(int32_t));
+    }
+
+    for (int32_t j = resource_table->dirty_row; j < ResourceManager_MapSize.y; ++j) {
+        const int32_t* previous_row = &resource_table->sums[stride * j];
+        int32_t* row = &resource_table->sums[stride * (j + 1)];
+        int32_t row_sums[SURVEY_RESOURCE_TYPES] = {0, 0, 0};
+
+        for (int32_t k = 0; k < SURVEY_RESOURCE_TYPES; ++k) {
+            row[k] = 0;
+        }
+
+        for (int32_t i = 0; i < ResourceManager_MapSize.x; ++i) {
+            const uint16_t value = ResourceManager_CargoMap[ResourceManager_MapSize.x * j + i];
 
-            if ((value & mask) && Access_GetModifiedSurfaceType(i, j) != SURFACE_TYPE_AIR) {
+            /* modified surface types only turn water or coast into land, the air test can use the plain map */
+            if ((value & mask) && Access_GetSurfaceType(i, j) != SURFACE_TYPE_AIR) {
                 if (value & CARGO_GOLD) {
-                    *gold += std::min(value & CARGO_MASK, 16);
+                    row_sums[SURVEY_RESOURCE_GOLD] += std::min(value & CARGO_MASK, 16);
                 } else if (value & CARGO_FUEL) {
-                    *fuel += std::min(value & CARGO_MASK, 16);
+                    row_sums[SURVEY_RESOURCE_FUEL] += std::min(value & CARGO_MASK, 16);
                 } else {
-                    *raw += std::min(value & CARGO_MASK, 16);
+                    row_sums[SURVEY_RESOURCE_RAW] += std::min(value & CARGO_MASK, 16);
                 }
             }
+
+            for (int32_t k = 0; k < SURVEY_RESOURCE_TYPES; ++k) {
+                row[(i + 1) * SURVEY_RESOURCE_TYPES + k] =
+                    previous_row[(i + 1) * SURVEY_RESOURCE_TYPES + k] + row_sums[k];
+            }
+        }
+    }
+
+    resource_table->dirty_row = ResourceManager_MapSize.y;
+
+    return resource_table->sums;
+}
+
+void Survey_GetResourcesInArea(int32_t grid_x, int32_t grid_y, int32_t radius, int32_t resource_limit, int16_t* raw,
+                               int16_t* gold, int16_t* fuel, bool mode, uint16_t team) {
+    const int32_t ulx = std::max(0, grid_x);
+    const int32_t uly = std::max(0, grid_y);
+    const int32_t lrx = std::min(ResourceManager_MapSize.x - 1, grid_x + radius);
+    const int32_t lry = std::min(ResourceManager_MapSize.y - 1, grid_y + radius);
+
+    *raw = 0;
+    *gold = 0;
+    *fuel = 0;
+
+    if (ulx <= lrx && uly <= lry) {
+        const int32_t* sums;
+        const int32_t stride = (ResourceManager_MapSize.x + 1) * SURVEY_RESOURCE_TYPES;
+
+        if (mode) {
+            sums = Survey_GetResourceTable(SURVEY_RESOURCE_TABLE_ALL_TEAMS, 0xFFFF);
+
+        } else {
+            sums = Survey_GetResourceTable(team, UnitsManager_TeamInfo[team].team_units->hash_team_id);
         }
+
+        if (!sums) {
+            return;
+        }
+
+        const int32_t* upper_left = &sums[stride * uly + ulx * SURVEY_RESOURCE_TYPES];
+        const int32_t* upper_right = &sums[stride * uly + (lrx + 1) * SURVEY_RESOURCE_TYPES];
+        const int32_t* lower_left = &sums[stride * (lry + 1) + ulx * SURVEY_RESOURCE_TYPES];
+        const int32_t* lower_right = &sums[stride * (lry + 1) + (lrx + 1) * SURVEY_RESOURCE_TYPES];
+
+        *raw = lower_right[SURVEY_RESOURCE_RAW] - upper_right[SURVEY_RESOURCE_RAW] - lower_left[SURVEY_RESOURCE_RAW] +
+               upper_left[SURVEY_RESOURCE_RAW];
+        *gold = lower_right[SURVEY_RESOURCE_GOLD] - upper_right[SURVEY_RESOURCE_GOLD] -
+                lower_left[SURVEY_RESOURCE_GOLD] + upper_left[SURVEY_RESOURCE_GOLD];
+        *fuel = lower_right[SURVEY_RESOURCE_FUEL] - upper_right[SURVEY_RESOURCE_FUEL] -
+                lower_left[SURVEY_RESOURCE_FUEL] + upper_left[SURVEY_RESOURCE_FUEL];
     }
 
     if (*raw > resource_limit) {
@@ -21,17 +21,39 @@
 
 #include "svga.h"
 
+#include <algorithm>
+#include <new>
+
 #include "ailog.hpp"
 #include "gnw.h"
+#include "headless.hpp"
 #include "ini.hpp"
+#include "palettekernels.hpp"
 
 #define SVGA_DEFAULT_WIDTH (640)
 #define SVGA_DEFAULT_HEIGHT (480)
 #define SVGA_DEFAULT_REFRESH_RATE (30)
+#define SVGA_DIRTY_RECT_LIMIT (32)
+#define SVGA_TILE_SIZE (64)
+#define SVGA_COLOR_MASK_WORDS (PALETTE_SIZE / 64)
+
+struct SvgaTile {
+    uint64_t colors[SVGA_COLOR_MASK_WORDS];
+    bool is_stale;
+};
 
 static Uint32 Svga_SetupDisplayMode(SDL_Rect *bounds);
 static void Svga_CorrectAspectRatio(SDL_DisplayMode *display_mode);
 static void Svga_RefreshSystemPalette(bool force);
+static void Svga_AddDirtyRect(SDL_Rect rect);
+static void Svga_UpdateTexture(SDL_Rect *bounds);
+static bool Svga_InitTiles(void);
+static void Svga_MarkStaleTiles(const SDL_Rect *bounds);
+static void Svga_UpdateTileColors(int32_t tile_x, int32_t tile_y);
+static void Svga_UpdateColorTable(void);
+static int32_t Svga_InitHeadless(void);
+static void Svga_BlitHeadless(uint8_t *srcBuf, uint32_t srcW, uint32_t srcH, uint32_t subX, uint32_t subY,
+                              uint32_t subW, uint32_t subH, uint32_t dstX, uint32_t dstY);
 
 static const bool SVGA_NO_TEXTURE_UPDATE = true;
 
@@ -40,9 +62,16 @@ static SDL_Renderer *sdlRenderer;
 static SDL_Surface *sdlWindowSurface;
 static SDL_Surface *sdlPaletteSurface;
 static SDL_Texture *sdlTexture;
+static SDL_PixelFormat *sdlTextureFormat;
 static uint32_t Svga_RenderTimer;
 static int32_t sdl_win_init_flag;
-static bool Svga_PaletteChanged;
+static uint64_t Svga_ChangedColors[SVGA_COLOR_MASK_WORDS];
+static uint32_t Svga_ColorTable[PALETTE_SIZE];
+static SvgaTile *Svga_Tiles;
+static int32_t Svga_TileCountX;
+static int32_t Svga_TileCountY;
+static SDL_Rect Svga_DirtyRects[SVGA_DIRTY_RECT_LIMIT];
+static int32_t Svga_DirtyRectCount;
 
 static int32_t Svga_ScreenWidth;
 static int32_t Svga_ScreenHeight;
@@ -138,6 +167,10 @@ int32_t Svga_Init(void) {
         return 0;
     }
 
+    if (Headless_IsEnabled()) {
+        return Svga_InitHeadless();
+    }
+
     SDL_Rect bounds;
     Uint32 flags = Svga_SetupDisplayMode(&bounds);
 
@@ -186,6 +219,18 @@ int32_t Svga_Init(void) {
     sdlTexture = SDL_CreateTexture(sdlRenderer, Svga_DisplayPixelFormat, SDL_TEXTUREACCESS_STREAMING, Svga_ScreenWidth,
                                    Svga_ScreenHeight);
 
+    if (sdlTexture) {
+        Uint32 texture_format;
+
+        /* the color table is written straight into the texture, so the colors are mapped with its format */
+        if (SDL_QueryTexture(sdlTexture, &texture_format, nullptr, nullptr, nullptr)) {
+            AiLog log("SDL_QueryTexture failed: %s\n", SDL_GetError());
+
+        } else {
+            sdlTextureFormat = SDL_AllocFormat(texture_format);
+        }
+    }
+
     scr_blit = &Svga_Blit;
 
     scr_size.lrx = Svga_ScreenWidth - 1;
@@ -199,7 +244,37 @@ int32_t Svga_Init(void) {
 
     SDL_RenderPresent(sdlRenderer);
 
-    if (sdlWindowSurface && sdlTexture && sdlPaletteSurface) {
+    if (sdlWindowSurface && sdlTexture && sdlTextureFormat && sdlPaletteSurface && Svga_InitTiles()) {
+        sdl_win_init_flag = 1;
+        return 0;
+    } else {
+        sdl_win_init_flag = 0;
+        return -1;
+    }
+}
+
+int32_t Svga_InitHeadless(void) {
+    /* displays are not queried, the screen has the default size independent of the host and its settings */
+    Svga_ScreenWidth = SVGA_DEFAULT_WIDTH;
+    Svga_ScreenHeight = SVGA_DEFAULT_HEIGHT;
+
+    /* the window is never shown, the mouse and keyboard handlers only need a valid window to query */
+    if ((sdlWindow = SDL_CreateWindow("M.A.X.: Mechanized Assault & Exploration", 0, 0, Svga_ScreenWidth,
+                                      Svga_ScreenHeight, SDL_WINDOW_HIDDEN)) == nullptr) {
+        AiLog log("SDL_CreateWindow failed: %s\n", SDL_GetError());
+    }
+
+    sdlPaletteSurface =
+        SDL_CreateRGBSurfaceWithFormat(0, Svga_ScreenWidth, Svga_ScreenHeight, 8, SDL_PIXELFORMAT_INDEX8);
+
+    scr_blit = &Svga_BlitHeadless;
+
+    scr_size.lrx = Svga_ScreenWidth - 1;
+    scr_size.lry = Svga_ScreenHeight - 1;
+    scr_size.ulx = 0;
+    scr_size.uly = 0;
+
+    if (sdlWindow && sdlPaletteSurface) {
         sdl_win_init_flag = 1;
         return 0;
     } else {
@@ -208,6 +283,9 @@ int32_t Svga_Init(void) {
     }
 }
 
+void Svga_BlitHeadless(uint8_t *srcBuf, uint32_t srcW, uint32_t srcH, uint32_t subX, uint32_t subY, uint32_t subW,
+                       uint32_t subH, uint32_t dstX, uint32_t dstY) {}
+
 void Svga_Deinit(void) {
     if (sdl_win_init_flag) {
         /// \todo Clean Up
@@ -225,35 +303,187 @@ void Svga_Blit(uint8_t *srcBuf, uint32_t srcW, uint32_t srcH, uint32_t subX, uin
                    sdlPaletteSurface->pitch);
     }
 
-    SDL_Rect bounds = {static_cast<int32_t>(dstX), static_cast<int32_t>(dstY), static_cast<int32_t>(subW),
-                       static_cast<int32_t>(subH)};
+    const SDL_Rect bounds = {static_cast<int32_t>(dstX), static_cast<int32_t>(dstY), static_cast<int32_t>(subW),
+                             static_cast<int32_t>(subH)};
+
+    /* the texture is updated and presented once per frame by Svga_Present */
+    Svga_AddDirtyRect(bounds);
+    Svga_MarkStaleTiles(&bounds);
+}
+
+bool Svga_InitTiles(void) {
+    Svga_TileCountX = (Svga_ScreenWidth + SVGA_TILE_SIZE - 1) / SVGA_TILE_SIZE;
+    Svga_TileCountY = (Svga_ScreenHeight + SVGA_TILE_SIZE - 1) / SVGA_TILE_SIZE;
+
+    delete[] Svga_Tiles;
+    Svga_Tiles = new (std::nothrow) SvgaTile[Svga_TileCountX * Svga_TileCountY];
+
+    if (!Svga_Tiles) {
+        return false;
+    }
+
+    for (int32_t i = 0; i < Svga_TileCountX * Svga_TileCountY; ++i) {
+        Svga_Tiles[i].is_stale = true;
+    }
+
+    SDL_memset(Svga_ChangedColors, 0xFF, sizeof(Svga_ChangedColors));
+
+    return true;
+}
+
+void Svga_MarkStaleTiles(const SDL_Rect *bounds) {
+    if (bounds->w <= 0 || bounds->h <= 0) {
+        return;
+    }
+
+    const int32_t ulx = bounds->x / SVGA_TILE_SIZE;
+    const int32_t uly = bounds->y / SVGA_TILE_SIZE;
+    const int32_t lrx = std::min((bounds->x + bounds->w - 1) / SVGA_TILE_SIZE, Svga_TileCountX - 1);
+    const int32_t lry = std::min((bounds->y + bounds->h - 1) / SVGA_TILE_SIZE, Svga_TileCountY - 1);
+
+    for (int32_t tile_y = uly; tile_y <= lry; ++tile_y) {
+        for (int32_t tile_x = ulx; tile_x <= lrx; ++tile_x) {
+            Svga_Tiles[tile_x + Svga_TileCountX * tile_y].is_stale = true;
+        }
+    }
+}
+
+void Svga_UpdateTileColors(int32_t tile_x, int32_t tile_y) {
+    SvgaTile &tile = Svga_Tiles[tile_x + Svga_TileCountX * tile_y];
+    const int32_t ulx = tile_x * SVGA_TILE_SIZE;
+    const int32_t uly = tile_y * SVGA_TILE_SIZE;
+    const int32_t width = std::min(ulx + SVGA_TILE_SIZE, sdlPaletteSurface->w) - ulx;
+    const int32_t height = std::min(uly + SVGA_TILE_SIZE, sdlPaletteSurface->h) - uly;
+
+    SDL_memset(tile.colors, 0, sizeof(tile.colors));
+
+    for (int32_t y = uly; y < uly + height; ++y) {
+        const uint8_t *pixels = &((uint8_t *)sdlPaletteSurface->pixels)[ulx + sdlPaletteSurface->pitch * y];
+
+        for (int32_t x = 0; x < width; ++x) {
+            tile.colors[pixels[x] / 64] |= 1ull << (pixels[x] % 64);
+        }
+    }
+
+    tile.is_stale = false;
+}
 
-    if (Svga_PaletteChanged) {
-        Svga_PaletteChanged = false;
+void Svga_UpdateColorTable(void) {
+    bool is_changed = false;
 
-        bounds.x = 0;
-        bounds.y = 0;
-        bounds.w = sdlPaletteSurface->w;
-        bounds.h = sdlPaletteSurface->h;
+    for (int32_t i = 0; i < SVGA_COLOR_MASK_WORDS; ++i) {
+        is_changed |= (Svga_ChangedColors[i] != 0);
     }
 
-    /* Blit 8-bit palette surface onto the window surface that's closer to the texture's format */
-    if (SDL_LowerBlit(sdlPaletteSurface, &bounds, sdlWindowSurface, &bounds) != 0) {
-        AiLog log("SDL_BlitSurface failed: %s\n", SDL_GetError());
+    if (!is_changed) {
+        return;
     }
 
+    const SDL_Color *colors = sdlPaletteSurface->format->palette->colors;
+
+    /* the span kernels write whole 32-bit pixels into the texture and the window surface */
+    SDL_assert(sdlTextureFormat->BytesPerPixel == sizeof(Uint32));
+    SDL_assert(sdlTextureFormat->format == sdlWindowSurface->format->format);
+
+    for (int32_t i = 0; i < PALETTE_SIZE; ++i) {
+        if (Svga_ChangedColors[i / 64] & (1ull << (i % 64))) {
+            Svga_ColorTable[i] = SDL_MapRGB(sdlTextureFormat, colors[i].r, colors[i].g, colors[i].b);
+        }
+    }
+
+    /* only the screen tiles that show any of the changed colors have to be expanded again */
+    for (int32_t tile_y = 0; tile_y < Svga_TileCountY; ++tile_y) {
+        for (int32_t tile_x = 0; tile_x < Svga_TileCountX; ++tile_x) {
+            const SvgaTile &tile = Svga_Tiles[tile_x + Svga_TileCountX * tile_y];
+
+            if (tile.is_stale) {
+                Svga_UpdateTileColors(tile_x, tile_y);
+            }
+
+            for (int32_t i = 0; i < SVGA_COLOR_MASK_WORDS; ++i) {
+                if (tile.colors[i] & Svga_ChangedColors[i]) {
+                    const int32_t ulx = tile_x * SVGA_TILE_SIZE;
+                    const int32_t uly = tile_y * SVGA_TILE_SIZE;
+
+                    Svga_AddDirtyRect({ulx, uly, std::min(SVGA_TILE_SIZE, sdlPaletteSurface->w - ulx),
+                                       std::min(SVGA_TILE_SIZE, sdlPaletteSurface->h - uly)});
+                    break;
+                }
+            }
+        }
+    }
+
+    SDL_memset(Svga_ChangedColors, 0, sizeof(Svga_ChangedColors));
+}
+
+void Svga_AddDirtyRect(SDL_Rect rect) {
+    if (rect.w <= 0 || rect.h <= 0) {
+        return;
+    }
+
+    /* merge the new rectangle with every overlapping or adjacent one until it is disjoint from the rest */
+    for (int32_t i = 0; i < Svga_DirtyRectCount;) {
+        const SDL_Rect &dirty = Svga_DirtyRects[i];
+
+        if (rect.x <= dirty.x + dirty.w && dirty.x <= rect.x + rect.w && rect.y <= dirty.y + dirty.h &&
+            dirty.y <= rect.y + rect.h) {
+            SDL_UnionRect(&rect, &dirty, &rect);
+
+            Svga_DirtyRects[i] = Svga_DirtyRects[--Svga_DirtyRectCount];
+            i = 0;
+
+        } else {
+            ++i;
+        }
+    }
+
+    if (Svga_DirtyRectCount == SVGA_DIRTY_RECT_LIMIT) {
+        /* out of slots, grow the rectangle whose area increases the least */
+        int64_t best_growth = INT64_MAX;
+        int32_t best_index = 0;
+
+        for (int32_t i = 0; i < Svga_DirtyRectCount; ++i) {
+            const SDL_Rect &dirty = Svga_DirtyRects[i];
+            SDL_Rect merged;
+
+            SDL_UnionRect(&rect, &dirty, &merged);
+
+            const int64_t growth =
+                static_cast<int64_t>(merged.w) * merged.h - static_cast<int64_t>(dirty.w) * dirty.h;
+
+            if (growth < best_growth) {
+                best_growth = growth;
+                best_index = i;
+            }
+        }
+
+        SDL_UnionRect(&rect, &Svga_DirtyRects[best_index], &rect);
+
+        Svga_DirtyRects[best_index] = Svga_DirtyRects[--Svga_DirtyRectCount];
+
+        Svga_AddDirtyRect(rect);
+
+    } else {
+        Svga_DirtyRects[Svga_DirtyRectCount++] = rect;
+    }
+}
+
+void Svga_UpdateTexture(SDL_Rect *bounds) {
+    const uint8_t *source_pixels =
+        &((uint8_t *)sdlPaletteSurface->pixels)[bounds->x + sdlPaletteSurface->pitch * bounds->y];
+
     if (SVGA_NO_TEXTURE_UPDATE) {
-        Uint32 *source_pixels = &((Uint32 *)sdlWindowSurface->pixels)[bounds.x + sdlWindowSurface->w * bounds.y];
         void *target_pixels = nullptr;
         int32_t target_pitch = 0;
 
-        if (SDL_LockTexture(sdlTexture, &bounds, &target_pixels, &target_pitch)) {
+        if (SDL_LockTexture(sdlTexture, bounds, &target_pixels, &target_pitch)) {
             AiLog log("SDL_LockTexture failed: %s\n", SDL_GetError());
 
         } else {
-            for (int32_t h = 0; h < bounds.h; ++h) {
-                SDL_memcpy(target_pixels, source_pixels, bounds.w * sizeof(Uint32));
-                source_pixels += sdlWindowSurface->w;
+            for (int32_t h = 0; h < bounds->h; ++h) {
+                PaletteKernels_ExpandSpan(static_cast<Uint32 *>(target_pixels), source_pixels, bounds->w,
+                                          Svga_ColorTable);
+                source_pixels += sdlPaletteSurface->pitch;
                 target_pixels = &(static_cast<Uint32 *>(target_pixels)[target_pitch / sizeof(Uint32)]);
             }
 
@@ -261,12 +491,38 @@ void Svga_Blit(uint8_t *srcBuf, uint32_t srcW, uint32_t srcH, uint32_t subX, uin
         }
 
     } else {
-        if (SDL_UpdateTexture(sdlTexture, &bounds,
-                              &((Uint32 *)sdlWindowSurface->pixels)[bounds.x + sdlPaletteSurface->pitch * bounds.y],
+        Uint32 *target_pixels = &((Uint32 *)sdlWindowSurface->pixels)[bounds->x + sdlWindowSurface->w * bounds->y];
+
+        for (int32_t h = 0; h < bounds->h; ++h) {
+            PaletteKernels_ExpandSpan(&target_pixels[sdlWindowSurface->w * h], source_pixels, bounds->w,
+                                      Svga_ColorTable);
+            source_pixels += sdlPaletteSurface->pitch;
+        }
+
+        if (SDL_UpdateTexture(sdlTexture, bounds,
+                              &((Uint32 *)sdlWindowSurface->pixels)[bounds->x + sdlWindowSurface->w * bounds->y],
                               sdlWindowSurface->pitch) != 0) {
             AiLog log("SDL_UpdateTexture failed: %s\n", SDL_GetError());
         }
     }
+}
+
+void Svga_Present(void) {
+    if (!sdlRenderer) {
+        return;
+    }
+
+    Svga_UpdateColorTable();
+
+    if (Svga_DirtyRectCount == 0) {
+        return;
+    }
+
+    for (int32_t i = 0; i < Svga_DirtyRectCount; ++i) {
+        Svga_UpdateTexture(&Svga_DirtyRects[i]);
+    }
+
+    Svga_DirtyRectCount = 0;
 
     /* Make the modified texture visible by rendering it */
     if (SDL_RenderCopy(sdlRenderer, sdlTexture, nullptr, nullptr) != 0) {
@@ -291,13 +547,13 @@ int32_t Svga_WarpMouse(int32_t window_x, int32_t window_y) {
 }
 
 void Svga_RefreshSystemPalette(bool force) {
+    if (Headless_IsEnabled()) {
+        return;
+    }
+
     if (force || (timer_elapsed_time(Svga_RenderTimer) >= TIMER_FPS_TO_MS(SVGA_DEFAULT_REFRESH_RATE))) {
         Svga_RenderTimer = timer_get();
-        Svga_PaletteChanged = true;
-
-        uint8_t srcBuf;
-
-        Svga_Blit(&srcBuf, 0, 0, 0, 0, 0, 0, 0, 0);
+        Svga_Present();
     }
 }
 
@@ -306,6 +562,8 @@ void Svga_SetPaletteColor(int32_t index, SDL_Color *color) {
         AiLog log("SDL_SetPaletteColors failed: %s\n", SDL_GetError());
     }
 
+    Svga_ChangedColors[index / 64] |= 1ull << (index % 64);
+
     Svga_RefreshSystemPalette(index == PALETTE_SIZE - 1);
 }
 
@@ -314,6 +572,8 @@ void Svga_SetPalette(SDL_Palette *palette) {
         AiLog log("SDL_SetSurfacePalette failed: %s\n", SDL_GetError());
     }
 
+    SDL_memset(Svga_ChangedColors, 0xFF, sizeof(Svga_ChangedColors));
+
     Svga_RefreshSystemPalette(true);
 }
 
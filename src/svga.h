@@ -42,6 +42,7 @@ int32_t Svga_Init(void);
 void Svga_Deinit(void);
 void Svga_Blit(uint8_t *srcBuf, uint32_t srcW, uint32_t srcH, uint32_t subX, uint32_t subY, uint32_t subW,
                uint32_t subH, uint32_t dstX, uint32_t dstY);
+void Svga_Present(void);
 int32_t Svga_WarpMouse(int32_t window_x, int32_t window_y);
 void Svga_SetPaletteColor(int32_t index, SDL_Color *color);
 void Svga_SetPalette(SDL_Palette *palette);
@@ -32,21 +32,14 @@
 #define TERRAINMAP_PATH_MAX_DISTANCE SHRT_MAX
 #define TERRAINMAP_PATH_BLOCKED (TERRAINMAP_PATH_PROCESSED | TERRAINMAP_PATH_MAX_DISTANCE)
 
-TerrainMap::TerrainMap() : water_map(nullptr), land_map(nullptr), dimension_x(0) {}
+TerrainMap::TerrainMap() = default;
 
 TerrainMap::~TerrainMap() { Deinit(); }
 
 void TerrainMap::Init() {
-    if (!water_map) {
-        dimension_x = ResourceManager_MapSize.x;
-
-        water_map = new (std::nothrow) uint16_t*[ResourceManager_MapSize.x];
-        land_map = new (std::nothrow) uint16_t*[ResourceManager_MapSize.x];
-
-        for (int32_t i = 0; i < ResourceManager_MapSize.x; ++i) {
-            water_map[i] = new (std::nothrow) uint16_t[ResourceManager_MapSize.y];
-            land_map[i] = new (std::nothrow) uint16_t[ResourceManager_MapSize.y];
-        }
+    if (!water_map.IsInited()) {
+        water_map.Init(ResourceManager_MapSize.x, ResourceManager_MapSize.y);
+        land_map.Init(ResourceManager_MapSize.x, ResourceManager_MapSize.y);
 
         for (int32_t j = 0; j < ResourceManager_MapSize.y; ++j) {
             for (int32_t i = 0; i < ResourceManager_MapSize.x; ++i) {
@@ -98,21 +91,11 @@ void TerrainMap::Init() {
 }
 
 void TerrainMap::Deinit() {
-    if (water_map) {
-        for (int32_t i = 0; i < dimension_x; ++i) {
-            delete[] water_map[i];
-            delete[] land_map[i];
-        }
-
-        delete[] water_map;
-        delete[] land_map;
-
-        water_map = nullptr;
-        land_map = nullptr;
-    }
+    water_map.Deinit();
+    land_map.Deinit();
 }
 
-int32_t TerrainMap::TerrainMap_sub_68EEF(uint16_t** map, Point location) {
+int32_t TerrainMap::TerrainMap_sub_68EEF(Grid2D<uint16_t>& map, Point location) {
     uint16_t stored_distance;
     int32_t result;
 
@@ -163,7 +146,7 @@ int32_t TerrainMap::TerrainMap_sub_68EEF(uint16_t** map, Point location) {
     return result;
 }
 
-void TerrainMap::SetTerrain(uint16_t** map, Point location) {
+void TerrainMap::SetTerrain(Grid2D<uint16_t>& map, Point location) {
     Point position;
     bool flag;
     int32_t distance;
@@ -212,7 +195,7 @@ void TerrainMap::SetTerrain(uint16_t** map, Point location) {
     }
 }
 
-void TerrainMap::ClearTerrain(uint16_t** map, Point location) {
+void TerrainMap::ClearTerrain(Grid2D<uint16_t>& map, Point location) {
     Point position;
     bool flag;
     int32_t distance;
@@ -278,7 +261,7 @@ int32_t TerrainMap::TerrainMap_sub_690D6(Point location, int32_t surface_type) {
 }
 
 void TerrainMap::UpdateTerrain(Point location, int32_t surface_type) {
-    if (water_map) {
+    if (water_map.IsInited()) {
         if (surface_type & SURFACE_TYPE_LAND) {
             SetTerrain(water_map, location);
 
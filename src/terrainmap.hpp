@@ -22,16 +22,16 @@
 #ifndef TERRAINMAP_HPP
 #define TERRAINMAP_HPP
 
+#include "grid2d.hpp"
 #include "point.hpp"
 
 class TerrainMap {
-    int16_t dimension_x;
-    uint16_t **land_map;
-    uint16_t **water_map;
+    Grid2D<uint16_t> land_map;
+    Grid2D<uint16_t> water_map;
 
-    int32_t TerrainMap_sub_68EEF(uint16_t **map, Point location);
-    void SetTerrain(uint16_t **map, Point location);
-    void ClearTerrain(uint16_t **map, Point location);
+    int32_t TerrainMap_sub_68EEF(Grid2D<uint16_t> &map, Point location);
+    void SetTerrain(Grid2D<uint16_t> &map, Point location);
+    void ClearTerrain(Grid2D<uint16_t> &map, Point location);
 
 public:
     TerrainMap();
@@ -0,0 +1,354 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "threatkernels.hpp"
+
+#include <SDL_cpuinfo.h>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+
+#define THREAT_KERNELS_X86 1
+
+/* GCC and Clang only emit instructions beyond the baseline for functions that ask for them, MSVC always does */
+#if defined(__GNUC__) || defined(__clang__)
+#define THREAT_KERNELS_TARGET(instruction_set) __attribute__((target(instruction_set)))
+#else
+#define THREAT_KERNELS_TARGET(instruction_set)
+#endif
+#endif
+
+struct ThreatKernels {
+    uint8_t instruction_set;
+    void (*add_span)(int16_t* span, size_t count, int16_t value);
+    void (*add_span_normalized)(int16_t* span, size_t count, int16_t value);
+    void (*sum_span)(int16_t* target, const int16_t* source, size_t count);
+    void (*normalize_span)(int16_t* damage_potential, int16_t* shots, size_t count);
+    void (*rebase_span)(int16_t* damage_potential, const int16_t* shots, size_t count, int16_t difference);
+};
+
+static void ThreatKernels_AddSpanScalar(int16_t* span, size_t count, int16_t value);
+static void ThreatKernels_AddSpanNormalizedScalar(int16_t* span, size_t count, int16_t value);
+static void ThreatKernels_SumSpanScalar(int16_t* target, const int16_t* source, size_t count);
+static void ThreatKernels_NormalizeSpanScalar(int16_t* damage_potential, int16_t* shots, size_t count);
+static void ThreatKernels_RebaseSpanScalar(int16_t* damage_potential, const int16_t* shots, size_t count,
+                                           int16_t difference);
+static const ThreatKernels& ThreatKernels_Get();
+
+static const ThreatKernels ThreatKernels_Scalar = {
+    THREAT_KERNELS_SCALAR,           &ThreatKernels_AddSpanScalar,       &ThreatKernels_AddSpanNormalizedScalar,
+    &ThreatKernels_SumSpanScalar,    &ThreatKernels_NormalizeSpanScalar, &ThreatKernels_RebaseSpanScalar,
+};
+
+static const ThreatKernels* ThreatKernels_Active;
+
+void ThreatKernels_AddSpanScalar(int16_t* span, size_t count, int16_t value) {
+    for (size_t i = 0; i < count; ++i) {
+        span[i] += value;
+    }
+}
+
+void ThreatKernels_AddSpanNormalizedScalar(int16_t* span, size_t count, int16_t value) {
+    for (size_t i = 0; i < count; ++i) {
+        if (span[i] < 0) {
+            span[i] = 0;
+        }
+
+        span[i] += value;
+    }
+}
+
+void ThreatKernels_SumSpanScalar(int16_t* target, const int16_t* source, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        target[i] += source[i];
+    }
+}
+
+void ThreatKernels_NormalizeSpanScalar(int16_t* damage_potential, int16_t* shots, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        if (damage_potential[i] < 0) {
+            damage_potential[i] = 0;
+            shots[i] = 0;
+        }
+    }
+}
+
+void ThreatKernels_RebaseSpanScalar(int16_t* damage_potential, const int16_t* shots, size_t count,
+                                    int16_t difference) {
+    for (size_t i = 0; i < count; ++i) {
+        damage_potential[i] += shots[i] * difference;
+    }
+}
+
+#if defined(THREAT_KERNELS_X86)
+
+#define THREAT_KERNELS_SSE2_LANES 8
+
+THREAT_KERNELS_TARGET("sse2")
+static void ThreatKernels_AddSpanSse2(int16_t* span, size_t count, int16_t value) {
+    const __m128i values = _mm_set1_epi16(value);
+    size_t i = 0;
+
+    for (; i + THREAT_KERNELS_SSE2_LANES <= count; i += THREAT_KERNELS_SSE2_LANES) {
+        __m128i* address = reinterpret_cast<__m128i*>(&span[i]);
+
+        _mm_storeu_si128(address, _mm_add_epi16(_mm_loadu_si128(address), values));
+    }
+
+    ThreatKernels_AddSpanScalar(&span[i], count - i, value);
+}
+
+THREAT_KERNELS_TARGET("sse2")
+static void ThreatKernels_AddSpanNormalizedSse2(int16_t* span, size_t count, int16_t value) {
+    const __m128i values = _mm_set1_epi16(value);
+    const __m128i zeros = _mm_setzero_si128();
+    size_t i = 0;
+
+    for (; i + THREAT_KERNELS_SSE2_LANES <= count; i += THREAT_KERNELS_SSE2_LANES) {
+        __m128i* address = reinterpret_cast<__m128i*>(&span[i]);
+
+        _mm_storeu_si128(address, _mm_add_epi16(_mm_max_epi16(_mm_loadu_si128(address), zeros), values));
+    }
+
+    ThreatKernels_AddSpanNormalizedScalar(&span[i], count - i, value);
+}
+
+THREAT_KERNELS_TARGET("sse2")
+static void ThreatKernels_SumSpanSse2(int16_t* target, const int16_t* source, size_t count) {
+    size_t i = 0;
+
+    for (; i + THREAT_KERNELS_SSE2_LANES <= count; i += THREAT_KERNELS_SSE2_LANES) {
+        __m128i* address = reinterpret_cast<__m128i*>(&target[i]);
+        const __m128i sources = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&source[i]));
+
+        _mm_storeu_si128(address, _mm_add_epi16(_mm_loadu_si128(address), sources));
+    }
+
+    ThreatKernels_SumSpanScalar(&target[i], &source[i], count - i);
+}
+
+THREAT_KERNELS_TARGET("sse2")
+static void ThreatKernels_NormalizeSpanSse2(int16_t* damage_potential, int16_t* shots, size_t count) {
+    const __m128i zeros = _mm_setzero_si128();
+    size_t i = 0;
+
+    for (; i + THREAT_KERNELS_SSE2_LANES <= count; i += THREAT_KERNELS_SSE2_LANES) {
+        __m128i* damage_address = reinterpret_cast<__m128i*>(&damage_potential[i]);
+        __m128i* shots_address = reinterpret_cast<__m128i*>(&shots[i]);
+        const __m128i damages = _mm_loadu_si128(damage_address);
+        const __m128i mask = _mm_cmplt_epi16(damages, zeros);
+
+        _mm_storeu_si128(damage_address, _mm_andnot_si128(mask, damages));
+        _mm_storeu_si128(shots_address, _mm_andnot_si128(mask, _mm_loadu_si128(shots_address)));
+    }
+
+    ThreatKernels_NormalizeSpanScalar(&damage_potential[i], &shots[i], count - i);
+}
+
+THREAT_KERNELS_TARGET("sse2")
+static void ThreatKernels_RebaseSpanSse2(int16_t* damage_potential, const int16_t* shots, size_t count,
+                                         int16_t difference) {
+    const __m128i differences = _mm_set1_epi16(difference);
+    size_t i = 0;
+
+    for (; i + THREAT_KERNELS_SSE2_LANES <= count; i += THREAT_KERNELS_SSE2_LANES) {
+        __m128i* address = reinterpret_cast<__m128i*>(&damage_potential[i]);
+        const __m128i products =
+            _mm_mullo_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&shots[i])), differences);
+
+        _mm_storeu_si128(address, _mm_add_epi16(_mm_loadu_si128(address), products));
+    }
+
+    ThreatKernels_RebaseSpanScalar(&damage_potential[i], &shots[i], count - i, difference);
+}
+
+#define THREAT_KERNELS_AVX2_LANES 16
+
+THREAT_KERNELS_TARGET("avx2")
+static void ThreatKernels_AddSpanAvx2(int16_t* span, size_t count, int16_t value) {
+    const __m256i values = _mm256_set1_epi16(value);
+    size_t i = 0;
+
+    for (; i + THREAT_KERNELS_AVX2_LANES <= count; i += THREAT_KERNELS_AVX2_LANES) {
+        __m256i* address = reinterpret_cast<__m256i*>(&span[i]);
+
+        _mm256_storeu_si256(address, _mm256_add_epi16(_mm256_loadu_si256(address), values));
+    }
+
+    if (i + THREAT_KERNELS_SSE2_LANES <= count) {
+        __m128i* address = reinterpret_cast<__m128i*>(&span[i]);
+
+        _mm_storeu_si128(address, _mm_add_epi16(_mm_loadu_si128(address), _mm256_castsi256_si128(values)));
+        i += THREAT_KERNELS_SSE2_LANES;
+    }
+
+    ThreatKernels_AddSpanScalar(&span[i], count - i, value);
+}
+
+THREAT_KERNELS_TARGET("avx2")
+static void ThreatKernels_AddSpanNormalizedAvx2(int16_t* span, size_t count, int16_t value) {
+    const __m256i values = _mm256_set1_epi16(value);
+    const __m256i zeros = _mm256_setzero_si256();
+    size_t i = 0;
+
+    for (; i + THREAT_KERNELS_AVX2_LANES <= count; i += THREAT_KERNELS_AVX2_LANES) {
+        __m256i* address = reinterpret_cast<__m256i*>(&span[i]);
+
+        _mm256_storeu_si256(address, _mm256_add_epi16(_mm256_max_epi16(_mm256_loadu_si256(address), zeros), values));
+    }
+
+    if (i + THREAT_KERNELS_SSE2_LANES <= count) {
+        __m128i* address = reinterpret_cast<__m128i*>(&span[i]);
+
+        _mm_storeu_si128(address, _mm_add_epi16(_mm_max_epi16(_mm_loadu_si128(address), _mm256_castsi256_si128(zeros)),
+                                                _mm256_castsi256_si128(values)));
+        i += THREAT_KERNELS_SSE2_LANES;
+    }
+
+    ThreatKernels_AddSpanNormalizedScalar(&span[i], count - i, value);
+}
+
+THREAT_KERNELS_TARGET("avx2")
+static void ThreatKernels_SumSpanAvx2(int16_t* target, const int16_t* source, size_t count) {
+    size_t i = 0;
+
+    for (; i + THREAT_KERNELS_AVX2_LANES <= count; i += THREAT_KERNELS_AVX2_LANES) {
+        __m256i* address = reinterpret_cast<__m256i*>(&target[i]);
+        const __m256i sources = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&source[i]));
+
+        _mm256_storeu_si256(address, _mm256_add_epi16(_mm256_loadu_si256(address), sources));
+    }
+
+    ThreatKernels_SumSpanScalar(&target[i], &source[i], count - i);
+}
+
+THREAT_KERNELS_TARGET("avx2")
+static void ThreatKernels_NormalizeSpanAvx2(int16_t* damage_potential, int16_t* shots, size_t count) {
+    const __m256i zeros = _mm256_setzero_si256();
+    size_t i = 0;
+
+    for (; i + THREAT_KERNELS_AVX2_LANES <= count; i += THREAT_KERNELS_AVX2_LANES) {
+        __m256i* damage_address = reinterpret_cast<__m256i*>(&damage_potential[i]);
+        __m256i* shots_address = reinterpret_cast<__m256i*>(&shots[i]);
+        const __m256i damages = _mm256_loadu_si256(damage_address);
+        const __m256i mask = _mm256_cmpgt_epi16(zeros, damages);
+
+        _mm256_storeu_si256(damage_address, _mm256_andnot_si256(mask, damages));
+        _mm256_storeu_si256(shots_address, _mm256_andnot_si256(mask, _mm256_loadu_si256(shots_address)));
+    }
+
+    ThreatKernels_NormalizeSpanScalar(&damage_potential[i], &shots[i], count - i);
+}
+
+THREAT_KERNELS_TARGET("avx2")
+static void ThreatKernels_RebaseSpanAvx2(int16_t* damage_potential, const int16_t* shots, size_t count,
+                                         int16_t difference) {
+    const __m256i differences = _mm256_set1_epi16(difference);
+    size_t i = 0;
+
+    for (; i + THREAT_KERNELS_AVX2_LANES <= count; i += THREAT_KERNELS_AVX2_LANES) {
+        __m256i* address = reinterpret_cast<__m256i*>(&damage_potential[i]);
+        const __m256i products =
+            _mm256_mullo_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&shots[i])), differences);
+
+        _mm256_storeu_si256(address, _mm256_add_epi16(_mm256_loadu_si256(address), products));
+    }
+
+    ThreatKernels_RebaseSpanScalar(&damage_potential[i], &shots[i], count - i, difference);
+}
+
+static const ThreatKernels ThreatKernels_Sse2 = {
+    THREAT_KERNELS_SSE2,       &ThreatKernels_AddSpanSse2,       &ThreatKernels_AddSpanNormalizedSse2,
+    &ThreatKernels_SumSpanSse2, &ThreatKernels_NormalizeSpanSse2, &ThreatKernels_RebaseSpanSse2,
+};
+
+static const ThreatKernels ThreatKernels_Avx2 = {
+    THREAT_KERNELS_AVX2,       &ThreatKernels_AddSpanAvx2,       &ThreatKernels_AddSpanNormalizedAvx2,
+    &ThreatKernels_SumSpanAvx2, &ThreatKernels_NormalizeSpanAvx2, &ThreatKernels_RebaseSpanAvx2,
+};
+
+#endif /* defined(THREAT_KERNELS_X86) */
+
+const ThreatKernels& ThreatKernels_Get() {
+    if (!ThreatKernels_Active) {
+        ThreatKernels_SetInstructionSet(THREAT_KERNELS_AVX2);
+    }
+
+    return *ThreatKernels_Active;
+}
+
+uint8_t ThreatKernels_SetInstructionSet(uint8_t instruction_set) {
+    ThreatKernels_Active = &ThreatKernels_Scalar;
+
+#if defined(THREAT_KERNELS_X86)
+    if (instruction_set >= THREAT_KERNELS_AVX2 && SDL_HasAVX2()) {
+        ThreatKernels_Active = &ThreatKernels_Avx2;
+
+    } else if (instruction_set >= THREAT_KERNELS_SSE2 && SDL_HasSSE2()) {
+        ThreatKernels_Active = &ThreatKernels_Sse2;
+    }
+#endif
+
+    return ThreatKernels_Active->instruction_set;
+}
+
+uint8_t ThreatKernels_GetInstructionSet() { return ThreatKernels_Get().instruction_set; }
+
+const char* ThreatKernels_GetInstructionSetName(uint8_t instruction_set) {
+    const char* result;
+
+    switch (instruction_set) {
+        case THREAT_KERNELS_SSE2: {
+            result = "SSE2";
+        } break;
+
+        case THREAT_KERNELS_AVX2: {
+            result = "AVX2";
+        } break;
+
+        default: {
+            result = "Scalar";
+        } break;
+    }
+
+    return result;
+}
+
+void ThreatKernels_AddSpan(int16_t* span, size_t count, int32_t value, bool normalize) {
+    if (normalize) {
+        ThreatKernels_Get().add_span_normalized(span, count, value);
+
+    } else {
+        ThreatKernels_Get().add_span(span, count, value);
+    }
+}
+
+void ThreatKernels_SumSpan(int16_t* target, const int16_t* source, size_t count) {
+    ThreatKernels_Get().sum_span(target, source, count);
+}
+
+void ThreatKernels_NormalizeSpan(int16_t* damage_potential, int16_t* shots, size_t count) {
+    ThreatKernels_Get().normalize_span(damage_potential, shots, count);
+}
+
+void ThreatKernels_RebaseSpan(int16_t* damage_potential, const int16_t* shots, size_t count, int32_t difference) {
+    ThreatKernels_Get().rebase_span(damage_potential, shots, count, difference);
+}
@@ -0,0 +1,46 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef THREATKERNELS_HPP
+#define THREATKERNELS_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+enum : uint8_t {
+    THREAT_KERNELS_SCALAR,
+    THREAT_KERNELS_SSE2,
+    THREAT_KERNELS_AVX2,
+};
+
+/// Span kernels used to build threat maps. All kernels wrap around on int16_t overflow exactly like the scalar code,
+/// so every instruction set produces bit identical maps. The fastest instruction set supported by the CPU is selected
+/// on first use.
+void ThreatKernels_AddSpan(int16_t* span, size_t count, int32_t value, bool normalize);
+void ThreatKernels_SumSpan(int16_t* target, const int16_t* source, size_t count);
+void ThreatKernels_NormalizeSpan(int16_t* damage_potential, int16_t* shots, size_t count);
+void ThreatKernels_RebaseSpan(int16_t* damage_potential, const int16_t* shots, size_t count, int32_t difference);
+
+uint8_t ThreatKernels_GetInstructionSet();
+uint8_t ThreatKernels_SetInstructionSet(uint8_t instruction_set);
+const char* ThreatKernels_GetInstructionSetName(uint8_t instruction_set);
+
+#endif /* THREATKERNELS_HPP */
@@ -21,63 +21,70 @@
 
 #include "threatmap.hpp"
 
+#include <algorithm>
+
 #include "resource_manager.hpp"
+#include "threatkernels.hpp"
 #include "units_manager.hpp"
+#include "zonewalker.hpp"
 
-ThreatMap::ThreatMap() : dimension(0, 0) {
-    damage_potential_map = nullptr;
-    shots_map = nullptr;
+ThreatMap::ThreatMap() {
     id = 0;
     risk_level = 0;
+    dirty_bounds = {0, 0, 0, 0};
+    is_dirty = false;
 }
 
 ThreatMap::~ThreatMap() { Deinit(); }
 
 void ThreatMap::Init() {
-    if (damage_potential_map) {
-        if (dimension.x != ResourceManager_MapSize.x || dimension.y != ResourceManager_MapSize.y) {
-            Deinit();
-        }
-    }
+    /* storage is only reallocated if the map dimensions changed */
+    damage_potential_map.Init(ResourceManager_MapSize.x, ResourceManager_MapSize.y);
+    shots_map.Init(ResourceManager_MapSize.x, ResourceManager_MapSize.y);
 
-    if (!damage_potential_map) {
-        dimension = ResourceManager_MapSize;
+    damage_potential_map.Clear();
+    shots_map.Clear();
 
-        damage_potential_map = new (std::nothrow) int16_t*[dimension.x];
-        shots_map = new (std::nothrow) int16_t*[dimension.x];
+    contributions.clear();
+    dirty_units.Clear();
+    dirty_bounds = {0, 0, 0, 0};
+    is_dirty = false;
+}
 
-        for (int32_t i = 0; i < dimension.x; ++i) {
-            damage_potential_map[i] = new (std::nothrow) int16_t[dimension.y];
-            shots_map[i] = new (std::nothrow) int16_t[dimension.y];
-        }
-    }
+void ThreatMap::InitIncremental() {
+    Init();
 
-    for (int32_t i = 0; i < dimension.x; ++i) {
-        memset(damage_potential_map[i], 0, dimension.y * sizeof(int16_t));
-        memset(shots_map[i], 0, dimension.y * sizeof(int16_t));
-    }
+    raw_damage_potential_map.Init(ResourceManager_MapSize.x, ResourceManager_MapSize.y);
+    raw_shots_map.Init(ResourceManager_MapSize.x, ResourceManager_MapSize.y);
+
+    raw_damage_potential_map.Clear();
+    raw_shots_map.Clear();
+
+    /* contributions are collected on next use */
+    is_dirty = true;
 }
 
-void ThreatMap::Deinit() {
+void ThreatMap::Reset() {
+    /* a new game must not diff against contributions recorded in the previous one */
     risk_level = 0;
+    is_dirty = false;
 
-    if (damage_potential_map) {
-        for (int32_t i = 0; i < dimension.x; ++i) {
-            delete[] damage_potential_map[i];
-        }
+    contributions.clear();
+    dirty_units.Clear();
+    dirty_bounds = {0, 0, 0, 0};
+}
 
-        delete[] damage_potential_map;
-        damage_potential_map = nullptr;
-    }
+void ThreatMap::Deinit() {
+    risk_level = 0;
 
-    if (shots_map) {
-        for (int32_t i = 0; i < dimension.x; ++i) {
-            delete[] shots_map[i];
-        }
+    damage_potential_map.Deinit();
+    shots_map.Deinit();
+    raw_damage_potential_map.Deinit();
+    raw_shots_map.Deinit();
 
-        delete[] shots_map;
-        shots_map = nullptr;
-    }
+    contributions.clear();
+    dirty_units.Clear();
+    dirty_bounds = {0, 0, 0, 0};
 }
 
 uint16_t ThreatMap::GetRiskLevel(ResourceID unit_type) {
@@ -145,10 +152,142 @@ void ThreatMap::Update(int32_t armor_) {
 
         armor = armor_;
 
-        for (int32_t grid_x = 0; grid_x < dimension.x; ++grid_x) {
-            for (int32_t grid_y = 0; grid_y < dimension.y; ++grid_y) {
-                damage_potential_map[grid_x][grid_y] += shots_map[grid_x][grid_y] * difference;
+        ThreatKernels_RebaseSpan(damage_potential_map.GetData(), shots_map.GetData(), damage_potential_map.GetSize(),
+                                 difference);
+    }
+}
+
+void ThreatMap::UpdateMap(int16_t** map, Point position, int32_t range, int32_t damage_potential, bool normalize) {
+    const int32_t distance = range * range;
+    const int32_t limit_x = std::min(position.x + range, ResourceManager_MapSize.x - 1);
+
+    for (int32_t grid_x = std::max(position.x - range, 0); grid_x <= limit_x; ++grid_x) {
+        const int32_t map_offset = (grid_x - position.x) * (grid_x - position.x);
+        int32_t half_height = range;
+
+        while (half_height >= 0 && (half_height * half_height + map_offset) > distance) {
+            --half_height;
+        }
+
+        /* each column of the disc is a contiguous span of the map */
+        const int32_t grid_y = std::max(position.y - half_height, 0);
+        const int32_t limit_y = std::min(position.y + half_height, ResourceManager_MapSize.y - 1);
+
+        ThreatKernels_AddSpan(&map[grid_x][grid_y], limit_y - grid_y + 1, damage_potential, normalize);
+    }
+}
+
+void ThreatMap::ApplyContribution(const ThreatContribution* contribution, int32_t sign) {
+    const int32_t damage_potential = contribution->damage_potential * sign;
+    const int32_t shots = contribution->shots * sign;
+    Rect bounds;
+
+    if (contribution->surface_types) {
+        ZoneWalker walker(contribution->position, contribution->range);
+
+        do {
+            if (ResourceManager_MapSurfaceMap[walker.GetGridY() * ResourceManager_MapSize.x + walker.GetGridX()] &
+                contribution->surface_types) {
+                raw_damage_potential_map[walker.GetGridX()][walker.GetGridY()] += damage_potential;
+                raw_shots_map[walker.GetGridX()][walker.GetGridY()] += shots;
             }
+        } while (walker.FindNext());
+
+    } else {
+        UpdateMap(raw_damage_potential_map.GetMap(), contribution->position, contribution->range, damage_potential,
+                  false);
+        UpdateMap(raw_shots_map.GetMap(), contribution->position, contribution->range, shots, false);
+    }
+
+    bounds.ulx = contribution->position.x - contribution->range;
+    bounds.uly = contribution->position.y - contribution->range;
+    bounds.lrx = contribution->position.x + contribution->range + 1;
+    bounds.lry = contribution->position.y + contribution->range + 1;
+
+    AddDirtyBounds(&bounds);
+}
+
+void ThreatMap::UpdateContribution(UnitInfo* unit, const ThreatContribution* contribution) {
+    auto it = contributions.find(unit);
+
+    if (it != contributions.end()) {
+        /* padding is cleared by the producers of contributions so that they can be compared as a whole */
+        if (contribution && !memcmp(&it->second, contribution, sizeof(*contribution))) {
+            return;
+        }
+
+        /* the raw maps are plain sums, so the old values are withdrawn before the new ones are added */
+        ApplyContribution(&it->second, -1);
+
+        if (contribution) {
+            it->second = *contribution;
+
+            ApplyContribution(contribution, 1);
+
+        } else {
+            contributions.erase(it);
         }
+
+    } else if (contribution) {
+        contributions.emplace(unit, *contribution);
+
+        ApplyContribution(contribution, 1);
+    }
+}
+
+void ThreatMap::RemoveContribution(UnitInfo* unit) {
+    UpdateContribution(unit, nullptr);
+
+    dirty_units.Remove(*unit);
+}
+
+void ThreatMap::MarkUnit(UnitInfo* unit) {
+    if (dirty_units.Find(*unit) == dirty_units.End()) {
+        dirty_units.PushBack(*unit);
     }
 }
+
+void ThreatMap::AddDirtyBounds(const Rect* bounds) {
+    const int32_t ulx = std::max(bounds->ulx, 0);
+    const int32_t uly = std::max(bounds->uly, 0);
+    const int32_t lrx = std::min(bounds->lrx, static_cast<int32_t>(ResourceManager_MapSize.x));
+    const int32_t lry = std::min(bounds->lry, static_cast<int32_t>(ResourceManager_MapSize.y));
+
+    if (ulx < lrx && uly < lry) {
+        if (dirty_bounds.ulx < dirty_bounds.lrx) {
+            dirty_bounds.ulx = std::min(dirty_bounds.ulx, ulx);
+            dirty_bounds.uly = std::min(dirty_bounds.uly, uly);
+            dirty_bounds.lrx = std::max(dirty_bounds.lrx, lrx);
+            dirty_bounds.lry = std::max(dirty_bounds.lry, lry);
+
+        } else {
+            dirty_bounds = {ulx, uly, lrx, lry};
+        }
+    }
+}
+
+bool ThreatMap::IsModified() const { return is_dirty || dirty_units.GetCount() || dirty_bounds.ulx < dirty_bounds.lrx; }
+
+bool ThreatMap::CommitDirtyBounds(Rect* bounds) {
+    bool result;
+
+    if (dirty_bounds.ulx < dirty_bounds.lrx) {
+        const size_t size = (dirty_bounds.lry - dirty_bounds.uly) * sizeof(int16_t);
+
+        /* tiles outside of the window keep their finalized values */
+        for (int32_t x = dirty_bounds.ulx; x < dirty_bounds.lrx; ++x) {
+            memcpy(&damage_potential_map[x][dirty_bounds.uly], &raw_damage_potential_map[x][dirty_bounds.uly], size);
+            memcpy(&shots_map[x][dirty_bounds.uly], &raw_shots_map[x][dirty_bounds.uly], size);
+        }
+
+        *bounds = dirty_bounds;
+        dirty_bounds = {0, 0, 0, 0};
+
+        result = true;
+
+    } else {
+        result = false;
+    }
+
+    return result;
+}
@@ -22,18 +22,34 @@
 #ifndef THREATMAP_HPP
 #define THREATMAP_HPP
 
+#include <unordered_map>
+
+#include "grid2d.hpp"
+#include "smartlist.hpp"
 #include "unitinfo.hpp"
 
-class ThreatMap {
-    Point dimension;
+/// Threat a single enemy unit adds to an incrementally maintained threat map. Surface types are zero if the threat
+/// covers all tiles within range.
+struct ThreatContribution {
+    UnitInfo *unit;
+    Point position;
+    int32_t damage_potential;
+    int16_t range;
+    int16_t shots;
+    int32_t surface_types;
+};
 
+class ThreatMap {
     void Deinit();
+    void ApplyContribution(const ThreatContribution *contribution, int32_t sign);
 
 public:
     ThreatMap();
     ~ThreatMap();
 
     void Init();
+    void InitIncremental();
+    void Reset();
 
     static uint16_t GetRiskLevel(ResourceID unit_type);
     static uint16_t GetRiskLevel(UnitInfo *unit);
@@ -41,14 +57,35 @@ public:
 
     void Update(int32_t armor);
 
+    static void UpdateMap(int16_t **map, Point position, int32_t range, int32_t damage_potential, bool normalize);
+
+    void UpdateContribution(UnitInfo *unit, const ThreatContribution *contribution);
+    void RemoveContribution(UnitInfo *unit);
+    void MarkUnit(UnitInfo *unit);
+    void AddDirtyBounds(const Rect *bounds);
+    bool IsModified() const;
+    bool CommitDirtyBounds(Rect *bounds);
+
     int16_t team;
     uint16_t id;
     uint8_t risk_level;
     uint8_t caution_level;
     bool for_attacking;
     int16_t armor;
-    int16_t **damage_potential_map;
-    int16_t **shots_map;
+    Grid2D<int16_t> damage_potential_map;
+    Grid2D<int16_t> shots_map;
+
+    /* sum of all recorded contributions before team specific post processing, incremental maps only */
+    Grid2D<int16_t> raw_damage_potential_map;
+    Grid2D<int16_t> raw_shots_map;
+    std::unordered_map<UnitInfo *, ThreatContribution> contributions;
+
+    /* units to be evaluated again and the window of tiles that must be finalized on next use */
+    SmartList<UnitInfo> dirty_units;
+    Rect dirty_bounds;
+
+    /* all contributions must be collected again, e.g. because shots and ammo were refilled by a new turn */
+    bool is_dirty;
 };
 
 #endif /* THREATMAP_HPP */
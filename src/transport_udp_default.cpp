@@ -33,6 +33,7 @@
 #include <utility>
 
 #include "inifile.hpp"
+#include "net_packet_queue.hpp"
 #include "netlog.hpp"
 #include "version.hpp"
 
@@ -89,11 +90,16 @@ struct UpnpDevice {
 struct TransportUdpDefault_Context {
     SDL_Thread* Thread;
     ENetHost* Host;
-    SDL_SpinLock QueueLock;
     SmartObjectArray<ENetPeer*> Peers;
     SmartObjectArray<ENetPeer*> RemotePeers;
-    SmartObjectArray<NetPacket*> TxPackets;
-    SmartObjectArray<NetPacket*> RxPackets;
+    NetPacketQueue TxPackets;
+    NetPacketQueue RxPackets;
+    NetPacket TxPacket;
+    NetPacket RxPacket;
+    ENetSocket WakeupSocket;
+    ENetAddress WakeupAddress;
+    SDL_atomic_t WakeupPort;
+    SDL_atomic_t WakeupPending;
     struct UpnpDevice UpnpDevice;
     ENetAddress ServerAddress;
     bool ExitThread;
@@ -127,7 +133,10 @@ static inline void TransportUdpDefault_ProcessTpPacket(struct TransportUdpDefaul
                                                        ENetPeer* const peer, ENetPacket* const enet_packet);
 static inline void TransportUdpDefault_ProcessApplPacket(struct TransportUdpDefault_Context* const context,
                                                          ENetPeer* const peer, ENetPacket* const enet_packet);
-static inline void TransportUdpDefault_TransmitApplPackets(struct TransportUdpDefault_Context* const context);
+static inline bool TransportUdpDefault_TransmitApplPackets(struct TransportUdpDefault_Context* const context);
+static inline void TransportUdpDefault_SetWakeupAddress(struct TransportUdpDefault_Context* const context);
+static inline void TransportUdpDefault_WakeupServiceThread(struct TransportUdpDefault_Context* const context);
+static inline void TransportUdpDefault_WaitForService(struct TransportUdpDefault_Context* const context);
 
 #if defined(MAX_ENABLE_UPNP)
 static void TransportUdpDefault_UpnpInit(struct TransportUdpDefault_Context* const context) noexcept;
@@ -168,11 +177,11 @@ bool TransportUdpDefault::Init(int32_t mode) {
 
         context->Thread = nullptr;
         context->Host = nullptr;
-        context->QueueLock = 0;
         context->Peers.Clear();
         context->RemotePeers.Clear();
-        context->TxPackets.Clear();
-        context->RxPackets.Clear();
+        context->WakeupSocket = ENET_SOCKET_NULL;
+        SDL_AtomicSet(&context->WakeupPort, 0);
+        SDL_AtomicSet(&context->WakeupPending, 0);
         context->UpnpDevice.Status = TRANSPORT_IGDSTATUS_ERROR;
         context->ServerAddress.host = ENET_HOST_ANY;
         context->ServerAddress.port = TransportUdpDefault_DefaultHostPort;
@@ -192,6 +201,7 @@ bool TransportUdpDefault::Init(int32_t mode) {
 
             // safe write access as thread cannot exist yet
             context->NetState = TRANSPORT_NETSTATE_INITED;
+            context->WakeupSocket = enet_socket_create(ENET_SOCKET_TYPE_DATAGRAM);
 
             SDL_assert(context->Thread == nullptr);
 
@@ -227,12 +237,18 @@ bool TransportUdpDefault::Deinit() {
             int result;
 
             context->ExitThread = true;
+            TransportUdpDefault_WakeupServiceThread(context);
             SDL_WaitThread(context->Thread, &result);
             context->Thread = nullptr;
 
             /// \todo Handle error.
         }
 
+        if (context->WakeupSocket != ENET_SOCKET_NULL) {
+            enet_socket_destroy(context->WakeupSocket);
+            context->WakeupSocket = ENET_SOCKET_NULL;
+        }
+
         if (context->NetState != TRANSPORT_NETSTATE_DEINITED) {
             enet_deinitialize();
             // safe write access as thread cannot exist anymore
@@ -264,19 +280,16 @@ const char* TransportUdpDefault::GetError() const {
 }
 
 bool TransportUdpDefault::TransmitPacket(NetPacket& packet) {
-    SDL_AtomicLock(&context->QueueLock);
     {
-        NetPacket* local = new (std::nothrow) NetPacket(std::move(packet));
-
-        context->TxPackets.PushBack(&local);
-
-        SDL_AtomicUnlock(&context->QueueLock);
-
         NetLog log("Transmit");
-        log.Log(*local);
+        log.Log(packet);
     }
 
-    return true;
+    const bool result = context->TxPackets.Push(packet);
+
+    TransportUdpDefault_WakeupServiceThread(context);
+
+    return result;
 }
 
 bool TransportUdpDefault::ReceivePacket(NetPacket& packet) {
@@ -284,21 +297,13 @@ bool TransportUdpDefault::ReceivePacket(NetPacket& packet) {
 
     packet.Reset();
 
-    SDL_AtomicLock(&context->QueueLock);
-    {
-        if (context->RxPackets.GetCount() > 0) {
-            NetPacket* local = *context->RxPackets[0];
-
-            packet = std::move(*local);
-            delete local;
-            context->RxPackets.Remove(0);
-
-            result = true;
-        }
-
-        SDL_AtomicUnlock(&context->QueueLock);
+    // packets that did not fit into the transmit queue are retried from the game thread that owns them
+    if (!context->TxPackets.Flush()) {
+        TransportUdpDefault_WakeupServiceThread(context);
     }
 
+    result = context->RxPackets.Pop(packet);
+
     if (result) {
         NetLog log("Receive from %4X", packet.GetAddress(0).port);
         log.Log(packet);
@@ -532,52 +537,96 @@ void TransportUdpDefault_ProcessTpPacket(struct TransportUdpDefault_Context* con
 
 void TransportUdpDefault_ProcessApplPacket(struct TransportUdpDefault_Context* const context, ENetPeer* const peer,
                                            ENetPacket* const enet_packet) {
-    NetPacket* packet = new (std::nothrow) NetPacket();
-    uint8_t packet_type;
+    NetPacket& packet = context->RxPacket;
     NetAddress address;
 
     address.host = peer->address.host;
     address.port = peer->address.port;
 
-    packet->AddAddress(address);
-    packet->Write(enet_packet->data, enet_packet->dataLength);
-
-    SDL_AtomicLock(&context->QueueLock);
-    {
-        context->RxPackets.PushBack(&packet);
+    packet.Reset();
+    packet.AddAddress(address);
+    packet.Write(enet_packet->data, enet_packet->dataLength);
 
-        SDL_AtomicUnlock(&context->QueueLock);
-    }
+    context->RxPackets.Push(packet);
 }
 
-void TransportUdpDefault_TransmitApplPackets(struct TransportUdpDefault_Context* const context) {
-    for (bool packets_pending = true; packets_pending;) {
-        ENetPacket* enet_packet{nullptr};
-
-        SDL_AtomicLock(&context->QueueLock);
-        {
-            if (context->TxPackets.GetCount() > 0) {
-                NetPacket* local = *context->TxPackets[0];
+bool TransportUdpDefault_TransmitApplPackets(struct TransportUdpDefault_Context* const context) {
+    bool result{false};
 
-                enet_packet = enet_packet_create(local->GetBuffer(), local->GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
+    while (context->TxPackets.Pop(context->TxPacket)) {
+        NetPacket& packet = context->TxPacket;
+        ENetPacket* enet_packet =
+            enet_packet_create(packet.GetBuffer(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
 
-                context->TxPackets.Remove(0);
+        if (enet_packet) {
+            if (packet.GetAddressCount() == 0) {
+                enet_host_broadcast(context->Host, TRANSPORT_APPL_CHANNEL, enet_packet);
 
             } else {
-                packets_pending = false;
+                // unicast and multicast packets are only sent to the addressed peers
+                for (size_t i = 0; i < context->Host->peerCount; ++i) {
+                    ENetPeer* const peer = &context->Host->peers[i];
+
+                    if (peer->state == ENET_PEER_STATE_CONNECTED) {
+                        for (uint16_t j = 0; j < packet.GetAddressCount(); ++j) {
+                            const NetAddress& address = packet.GetAddress(j);
+
+                            if (peer->address.host == address.host && peer->address.port == address.port) {
+                                (void)enet_peer_send(peer, TRANSPORT_APPL_CHANNEL, enet_packet);
+                                break;
+                            }
+                        }
+                    }
+                }
+
+                if (enet_packet->referenceCount == 0) {
+                    enet_packet_destroy(enet_packet);
+                }
             }
 
-            SDL_AtomicUnlock(&context->QueueLock);
+            result = true;
         }
+    }
 
-        if (enet_packet) {
-            /// \todo Properly support Unicast, Multicast and Broadcast messaging
-            /// \todo Flush buffered packets as soon as a synch packet is found or simply exit loop
-            enet_host_broadcast(context->Host, TRANSPORT_APPL_CHANNEL, enet_packet);
+    return result;
+}
+
+void TransportUdpDefault_SetWakeupAddress(struct TransportUdpDefault_Context* const context) {
+    ENetAddress address;
+
+    if (enet_socket_get_address(context->Host->socket, &address) == 0) {
+        if (address.host == ENET_HOST_ANY) {
+            (void)enet_address_set_host_ip(&address, "127.0.0.1");
         }
+
+        context->WakeupAddress = address;
+
+        // publishes the address to the game thread
+        SDL_AtomicSet(&context->WakeupPort, address.port);
+    }
+}
+
+void TransportUdpDefault_WakeupServiceThread(struct TransportUdpDefault_Context* const context) {
+    // the service thread waits on its host socket, a datagram too short to be an ENet protocol header ends the wait
+    // and is dropped by ENet
+    if (context->WakeupSocket != ENET_SOCKET_NULL && SDL_AtomicGet(&context->WakeupPort) != 0 &&
+        SDL_AtomicCAS(&context->WakeupPending, 0, 1)) {
+        uint8_t data{0};
+        ENetBuffer buffer;
+
+        buffer.data = &data;
+        buffer.dataLength = sizeof(data);
+
+        (void)enet_socket_send(context->WakeupSocket, &context->WakeupAddress, &buffer, 1);
     }
 }
 
+void TransportUdpDefault_WaitForService(struct TransportUdpDefault_Context* const context) {
+    enet_uint32 condition{ENET_SOCKET_WAIT_RECEIVE};
+
+    (void)enet_socket_wait(context->Host->socket, &condition, TransportUdpDefault_ServiceTickPeriod);
+}
+
 #if defined(MAX_ENABLE_UPNP)
 void TransportUdpDefault_UpnpInit(struct TransportUdpDefault_Context* const context) noexcept {
     struct UPNPDev* device_list{nullptr};
@@ -710,10 +759,12 @@ int TransportUdpDefault_ServerFunction(void* data) noexcept {
 #if defined(MAX_ENABLE_UPNP)
         TransportUdpDefault_UpnpInit(context);
 #endif
+        TransportUdpDefault_SetWakeupAddress(context);
+
         context->NetState = TRANSPORT_NETSTATE_CONNECTED;
 
         for (;;) {
-            if (enet_host_service(context->Host, &event, TransportUdpDefault_ServiceTickPeriod) > 0) {
+            while (enet_host_service(context->Host, &event, 0) > 0) {
                 switch (event.type) {
                     case ENET_EVENT_TYPE_CONNECT: {
                     } break;
@@ -738,18 +789,28 @@ int TransportUdpDefault_ServerFunction(void* data) noexcept {
                 }
             }
 
-            TransportUdpDefault_TransmitApplPackets(context);
+            SDL_AtomicSet(&context->WakeupPending, 0);
+
+            if (TransportUdpDefault_TransmitApplPackets(context)) {
+                enet_host_flush(context->Host);
+            }
+
+            (void)context->RxPackets.Flush();
 
             if (context->ExitThread) {
                 TransportUdpDefault_RemoveClients(context);
                 break;
             }
+
+            TransportUdpDefault_WaitForService(context);
         }
 
 #if defined(MAX_ENABLE_UPNP)
         TransportUdpDefault_UpnpDeinit(context);
 #endif
 
+        SDL_AtomicSet(&context->WakeupPort, 0);
+
         enet_host_destroy(context->Host);
 
         context->NetRole = -1;
@@ -762,9 +823,16 @@ int TransportUdpDefault_ServerFunction(void* data) noexcept {
 int TransportUdpDefault_ClientFunction(void* data) noexcept {
     struct TransportUdpDefault_Context* context = reinterpret_cast<struct TransportUdpDefault_Context*>(data);
 
+    ENetAddress client_address;
+
     context->NetRole = TRANSPORT_CLIENT;
 
-    context->Host = enet_host_create(nullptr, TransportUdpDefault_MaximumPeers, TransportUdpDefault_Channels, 0, 0);
+    // bind to an ephemeral port right away, an unbound socket has no local address for the wakeup datagrams
+    client_address.host = ENET_HOST_ANY;
+    client_address.port = 0;
+
+    context->Host =
+        enet_host_create(&client_address, TransportUdpDefault_MaximumPeers, TransportUdpDefault_Channels, 0, 0);
 
     if (context->Host) {
 #if defined(MAX_ENABLE_UPNP)
@@ -774,11 +842,13 @@ int TransportUdpDefault_ClientFunction(void* data) noexcept {
         ENetPeer* server_peer =
             enet_host_connect(context->Host, &context->ServerAddress, TransportUdpDefault_Channels, 0);
 
+        TransportUdpDefault_SetWakeupAddress(context);
+
         if (server_peer) {
             for (;;) {
                 ENetEvent event;
 
-                while (enet_host_service(context->Host, &event, TransportUdpDefault_ServiceTickPeriod) > 0) {
+                while (enet_host_service(context->Host, &event, 0) > 0) {
                     switch (event.type) {
                         case ENET_EVENT_TYPE_CONNECT: {
                             if (event.peer == server_peer) {
@@ -816,12 +886,20 @@ int TransportUdpDefault_ClientFunction(void* data) noexcept {
                     }
                 }
 
-                TransportUdpDefault_TransmitApplPackets(context);
+                SDL_AtomicSet(&context->WakeupPending, 0);
+
+                if (TransportUdpDefault_TransmitApplPackets(context)) {
+                    enet_host_flush(context->Host);
+                }
+
+                (void)context->RxPackets.Flush();
 
                 if (context->ExitThread) {
                     TransportUdpDefault_RemoveClients(context);
                     break;
                 }
+
+                TransportUdpDefault_WaitForService(context);
             }
         }
 
@@ -829,6 +907,8 @@ int TransportUdpDefault_ClientFunction(void* data) noexcept {
         TransportUdpDefault_UpnpDeinit(context);
 #endif
 
+        SDL_AtomicSet(&context->WakeupPort, 0);
+
         enet_host_destroy(context->Host);
 
         context->RemotePeers.Clear();
@@ -806,441 +806,449 @@ static RegisterClass UnitInfo_ClassRegister("UnitInfo", &UnitInfo_TypeIndex, &Un
 
 uint16_t UnitInfo::GetTypeIndex() const { return UnitInfo_TypeIndex; }
 
-void UnitInfo::Init() {
-    BaseUnit* base_unit;
-    uint32_t data_size;
-
-    base_unit = &UnitsManager_BaseUnits[unit_type];
-
-    if (!base_unit->sprite) {
-        base_unit->sprite = ResourceManager_LoadResource(UnitsManager_AbstractUnits[unit_type].sprite);
-        base_unit->shadows = ResourceManager_LoadResource(UnitsManager_AbstractUnits[unit_type].shadows);
-
-        if (ResourceManager_DisableEnhancedGraphics) {
-            if (base_unit->sprite) {
-                base_unit->sprite = Gfx_RescaleSprite(base_unit->sprite, &data_size, 0, 2);
-
-                ResourceManager_Realloc(UnitsManager_AbstractUnits[unit_type].sprite, base_unit->sprite, data_size);
-            }
-
-            if (base_unit->shadows) {
-                base_unit->shadows = Gfx_RescaleSprite(base_unit->shadows, &data_size, 1, 2);
-
-                ResourceManager_Realloc(UnitsManager_AbstractUnits[unit_type].shadows, base_unit->shadows, data_size);
-            }
-        }
-    }
-
-    switch (unit_type) {
-        case COMMTWR: {
-            popup = &UnitsManager_PopupCallbacks[22];
-        } break;
-
-        case POWERSTN:
-        case POWGEN: {
-            popup = &UnitsManager_PopupCallbacks[19];
-        } break;
-
-        case BARRACKS:
-        case DEPOT:
-        case HANGAR:
-        case DOCK: {
-            popup = &UnitsManager_PopupCallbacks[12];
-        } break;
-
-        case ADUMP: {
-            popup = &UnitsManager_PopupCallbacks[9];
-        } break;
-
-        case FDUMP: {
-            popup = &UnitsManager_PopupCallbacks[10];
-        } break;
-
-        case SHIPYARD:
-        case LIGHTPLT:
-        case LANDPLT:
-        case AIRPLT:
-        case TRAINHAL: {
-            popup = &UnitsManager_PopupCallbacks[14];
-        } break;
-
-        case RESEARCH: {
-            popup = &UnitsManager_PopupCallbacks[18];
-        } break;
-
-        case GREENHSE: {
-            popup = &UnitsManager_PopupCallbacks[17];
-        } break;
-
-        case RECCENTR: {
-            popup = &UnitsManager_PopupCallbacks[15];
-        } break;
-
-        case GUNTURRT:
-        case ANTIAIR:
-        case ARTYTRRT:
-        case ANTIMSSL:
-        case SCOUT:
-        case TANK:
-        case ARTILLRY:
-        case ROCKTLCH:
-        case MISSLLCH:
-        case SP_FLAK:
-        case INFANTRY:
-        case FASTBOAT:
-        case CORVETTE:
-        case BATTLSHP:
-        case SUBMARNE:
-        case MSSLBOAT:
-        case FIGHTER:
-        case BOMBER:
-        case JUGGRNT:
-        case ALNTANK:
-        case ALNASGUN:
-        case ALNPLANE: {
-            popup = &UnitsManager_PopupCallbacks[3];
-        } break;
-
-        case MININGST: {
-            popup = &UnitsManager_PopupCallbacks[16];
-        } break;
-
-        case MASTER: {
-            popup = &UnitsManager_PopupCallbacks[21];
-        } break;
-
-        case CONSTRCT:
-        case ENGINEER: {
-            popup = &UnitsManager_PopupCallbacks[13];
-        } break;
-
-        case MINELAYR:
-        case SEAMNLYR: {
-            popup = &UnitsManager_PopupCallbacks[6];
-        } break;
-
-        case SURVEYOR: {
-            popup = &UnitsManager_PopupCallbacks[2];
-        } break;
-
-        case SCANNER:
-        case GOLDTRCK: {
-            popup = &UnitsManager_PopupCallbacks[1];
-        } break;
-
-        case SPLYTRCK:
-        case CARGOSHP: {
-            popup = &UnitsManager_PopupCallbacks[5];
-        } break;
-
-        case BULLDOZR: {
-            popup = &UnitsManager_PopupCallbacks[20];
-        } break;
-
-        case REPAIR: {
-            popup = &UnitsManager_PopupCallbacks[8];
-        } break;
-
-        case FUELTRCK: {
-            popup = &UnitsManager_PopupCallbacks[7];
-        } break;
-
-        case CLNTRANS:
-        case SEATRANS:
-        case AIRTRANS: {
-            popup = &UnitsManager_PopupCallbacks[11];
-        } break;
-
-        case COMMANDO: {
-            popup = &UnitsManager_PopupCallbacks[4];
-        } break;
-
-        default: {
-            popup = &UnitsManager_PopupCallbacks[0];
-        } break;
-    }
+const std::vector<SoundElement>* UnitInfo_GetSoundTable(ResourceID unit_type) {
+    const std::vector<SoundElement>* result;
 
     switch (unit_type) {
         case COMMTWR: {
-            sound_table = &UnitInfo_SfxMonopoleMine;
+            result = &UnitInfo_SfxMonopoleMine;
         } break;
 
         case POWERSTN: {
-            sound_table = &UnitInfo_SfxPowerStation;
+            result = &UnitInfo_SfxPowerStation;
         } break;
 
         case POWGEN: {
-            sound_table = &UnitInfo_SfxPowerGenerator;
+            result = &UnitInfo_SfxPowerGenerator;
         } break;
 
         case BARRACKS: {
-            sound_table = &UnitInfo_SfxBarracks;
+            result = &UnitInfo_SfxBarracks;
         } break;
 
         case SHIELDGN: {
-            sound_table = &UnitInfo_SfxGoldRefinery;
+            result = &UnitInfo_SfxGoldRefinery;
         } break;
 
         case RADAR: {
-            sound_table = &UnitInfo_SfxRadar;
+            result = &UnitInfo_SfxRadar;
         } break;
 
         case ADUMP: {
-            sound_table = &UnitInfo_SfxMaterialStorage;
+            result = &UnitInfo_SfxMaterialStorage;
         } break;
 
         case FDUMP: {
-            sound_table = &UnitInfo_SfxFuelStorage;
+            result = &UnitInfo_SfxFuelStorage;
         } break;
 
         case GOLDSM: {
-            sound_table = &UnitInfo_SfxGoldVault;
+            result = &UnitInfo_SfxGoldVault;
         } break;
 
         case DEPOT: {
-            sound_table = &UnitInfo_SfxDepot;
+            result = &UnitInfo_SfxDepot;
         } break;
 
         case HANGAR: {
-            sound_table = &UnitInfo_SfxHangar;
+            result = &UnitInfo_SfxHangar;
         } break;
 
         case DOCK: {
-            sound_table = &UnitInfo_SfxDock;
+            result = &UnitInfo_SfxDock;
         } break;
 
         case ROAD: {
-            sound_table = &UnitInfo_SfxRoad;
+            result = &UnitInfo_SfxRoad;
         } break;
 
         case LANDPAD: {
-            sound_table = &UnitInfo_SfxLandingPad;
+            result = &UnitInfo_SfxLandingPad;
         } break;
 
         case SHIPYARD: {
-            sound_table = &UnitInfo_SfxShipyard;
+            result = &UnitInfo_SfxShipyard;
         } break;
 
         case LIGHTPLT: {
-            sound_table = &UnitInfo_SfxLightVehiclePlant;
+            result = &UnitInfo_SfxLightVehiclePlant;
         } break;
 
         case LANDPLT: {
-            sound_table = &UnitInfo_SfxHeavyVehiclePlant;
+            result = &UnitInfo_SfxHeavyVehiclePlant;
         } break;
 
         case AIRPLT: {
-            sound_table = &UnitInfo_SfxAirUnitsPlant;
+            result = &UnitInfo_SfxAirUnitsPlant;
         } break;
 
         case HABITAT: {
-            sound_table = &UnitInfo_SfxHabitat;
+            result = &UnitInfo_SfxHabitat;
         } break;
 
         case RESEARCH: {
-            sound_table = &UnitInfo_SfxResearchCentre;
+            result = &UnitInfo_SfxResearchCentre;
         } break;
 
         case GREENHSE: {
-            sound_table = &UnitInfo_SfxEcoSphere;
+            result = &UnitInfo_SfxEcoSphere;
         } break;
 
         case TRAINHAL: {
-            sound_table = &UnitInfo_SfxTrainingHall;
+            result = &UnitInfo_SfxTrainingHall;
         } break;
 
         case WTRPLTFM: {
-            sound_table = &UnitInfo_SfxWaterPlatform;
+            result = &UnitInfo_SfxWaterPlatform;
         } break;
 
         case GUNTURRT: {
-            sound_table = &UnitInfo_SfxGunTurret;
+            result = &UnitInfo_SfxGunTurret;
         } break;
 
         case ANTIAIR: {
-            sound_table = &UnitInfo_SfxAntiAir;
+            result = &UnitInfo_SfxAntiAir;
         } break;
 
         case ARTYTRRT: {
-            sound_table = &UnitInfo_SfxArtillery;
+            result = &UnitInfo_SfxArtillery;
         } break;
 
         case ANTIMSSL: {
-            sound_table = &UnitInfo_SfxMissileLauncher;
+            result = &UnitInfo_SfxMissileLauncher;
         } break;
 
         case BLOCK: {
-            sound_table = &UnitInfo_SfxConcreteBlock;
+            result = &UnitInfo_SfxConcreteBlock;
         } break;
 
         case BRIDGE: {
-            sound_table = &UnitInfo_SfxBridge;
+            result = &UnitInfo_SfxBridge;
         } break;
 
         case MININGST: {
-            sound_table = &UnitInfo_SfxMiningStation;
+            result = &UnitInfo_SfxMiningStation;
         } break;
 
         case LANDMINE: {
-            sound_table = &UnitInfo_SfxLandMine;
+            result = &UnitInfo_SfxLandMine;
         } break;
 
         case SEAMINE: {
-            sound_table = &UnitInfo_SfxSeaMine;
+            result = &UnitInfo_SfxSeaMine;
         } break;
 
         case HITEXPLD: {
-            sound_table = &UnitInfo_SfxHitExplosion;
+            result = &UnitInfo_SfxHitExplosion;
         } break;
 
         case MASTER: {
-            sound_table = &UnitInfo_SfxMasterBuilder;
+            result = &UnitInfo_SfxMasterBuilder;
         } break;
 
         case CONSTRCT: {
-            sound_table = &UnitInfo_SfxConstructor;
+            result = &UnitInfo_SfxConstructor;
         } break;
 
         case SCOUT: {
-            sound_table = &UnitInfo_SfxScout;
+            result = &UnitInfo_SfxScout;
         } break;
 
         case TANK: {
-            sound_table = &UnitInfo_SfxTank;
+            result = &UnitInfo_SfxTank;
         } break;
 
         case ARTILLRY: {
-            sound_table = &UnitInfo_SfxAssaultGun;
+            result = &UnitInfo_SfxAssaultGun;
         } break;
 
         case ROCKTLCH: {
-            sound_table = &UnitInfo_SfxRocketLauncher;
+            result = &UnitInfo_SfxRocketLauncher;
         } break;
 
         case MISSLLCH: {
-            sound_table = &UnitInfo_SfxMissileCrawler;
+            result = &UnitInfo_SfxMissileCrawler;
         } break;
 
         case SP_FLAK: {
-            sound_table = &MobileAntiAir;
+            result = &MobileAntiAir;
         } break;
 
         case MINELAYR: {
-            sound_table = &UnitInfo_SfxMineLayer;
+            result = &UnitInfo_SfxMineLayer;
         } break;
 
         case SURVEYOR: {
-            sound_table = &UnitInfo_SfxSurveyor;
+            result = &UnitInfo_SfxSurveyor;
         } break;
 
         case SCANNER: {
-            sound_table = &UnitInfo_SfxScanner;
+            result = &UnitInfo_SfxScanner;
         } break;
 
         case SPLYTRCK: {
-            sound_table = &UnitInfo_SfxSupplyTruck;
+            result = &UnitInfo_SfxSupplyTruck;
         } break;
 
         case GOLDTRCK: {
-            sound_table = &UnitInfo_SfxGoldTruck;
+            result = &UnitInfo_SfxGoldTruck;
         } break;
 
         case ENGINEER: {
-            sound_table = &UnitInfo_SfxEngineer;
+            result = &UnitInfo_SfxEngineer;
         } break;
 
         case BULLDOZR: {
-            sound_table = &UnitInfo_SfxBulldozer;
+            result = &UnitInfo_SfxBulldozer;
         } break;
 
         case REPAIR: {
-            sound_table = &UnitInfo_SfxRepairUnit;
+            result = &UnitInfo_SfxRepairUnit;
         } break;
 
         case FUELTRCK: {
-            sound_table = &UnitInfo_SfxFuelTruck;
+            result = &UnitInfo_SfxFuelTruck;
         } break;
 
         case CLNTRANS: {
-            sound_table = &UnitInfo_SfxArmouredPersonnelCarrier;
+            result = &UnitInfo_SfxArmouredPersonnelCarrier;
         } break;
 
         case COMMANDO: {
-            sound_table = &UnitInfo_SfxInfiltrator;
+            result = &UnitInfo_SfxInfiltrator;
         } break;
 
         case INFANTRY: {
-            sound_table = &UnitInfo_SfxInfantry;
+            result = &UnitInfo_SfxInfantry;
         } break;
 
         case FASTBOAT: {
-            sound_table = &UnitInfo_SfxEscort;
+            result = &UnitInfo_SfxEscort;
         } break;
 
         case CORVETTE: {
-            sound_table = &UnitInfo_SfxCorvette;
+            result = &UnitInfo_SfxCorvette;
         } break;
 
         case BATTLSHP: {
-            sound_table = &UnitInfo_SfxGunBoat;
+            result = &UnitInfo_SfxGunBoat;
         } break;
 
         case SUBMARNE: {
-            sound_table = &UnitInfo_SfxSubmarine;
+            result = &UnitInfo_SfxSubmarine;
         } break;
 
         case SEATRANS: {
-            sound_table = &UnitInfo_SfxSeaTransport;
+            result = &UnitInfo_SfxSeaTransport;
         } break;
 
         case MSSLBOAT: {
-            sound_table = &UnitInfo_SfxMissileCruiser;
+            result = &UnitInfo_SfxMissileCruiser;
         } break;
 
         case SEAMNLYR: {
-            sound_table = &UnitInfo_SfxSeaMineLayer;
+            result = &UnitInfo_SfxSeaMineLayer;
         } break;
 
         case CARGOSHP: {
-            sound_table = &UnitInfo_SfxCargoShip;
+            result = &UnitInfo_SfxCargoShip;
         } break;
 
         case FIGHTER: {
-            sound_table = &UnitInfo_SfxFighter;
+            result = &UnitInfo_SfxFighter;
         } break;
 
         case BOMBER: {
-            sound_table = &UnitInfo_SfxGroundAttackPlane;
+            result = &UnitInfo_SfxGroundAttackPlane;
         } break;
 
         case AIRTRANS: {
-            sound_table = &UnitInfo_SfxAirTransport;
+            result = &UnitInfo_SfxAirTransport;
         } break;
 
         case AWAC: {
-            sound_table = &UnitInfo_SfxAwac;
+            result = &UnitInfo_SfxAwac;
         } break;
 
         case JUGGRNT: {
-            sound_table = &UnitInfo_SfxAlienGunBoat;
+            result = &UnitInfo_SfxAlienGunBoat;
         } break;
 
         case ALNTANK: {
-            sound_table = &UnitInfo_SfxAlienTank;
+            result = &UnitInfo_SfxAlienTank;
         } break;
 
         case ALNASGUN: {
-            sound_table = &UnitInfo_SfxAlienAssaultGun;
+            result = &UnitInfo_SfxAlienAssaultGun;
         } break;
 
         case ALNPLANE: {
-            sound_table = &UnitInfo_SfxAlienAttackPlane;
+            result = &UnitInfo_SfxAlienAttackPlane;
         } break;
 
         default: {
-            sound_table = &UnitInfo_SfxDefaultUnit;
+            result = &UnitInfo_SfxDefaultUnit;
         } break;
     }
+
+    return result;
+}
+
+void UnitInfo::Init() {
+    BaseUnit* base_unit;
+    uint32_t data_size;
+
+    base_unit = &UnitsManager_BaseUnits[unit_type];
+
+    if (!base_unit->sprite) {
+        base_unit->sprite = ResourceManager_LoadResource(UnitsManager_AbstractUnits[unit_type].sprite);
+        base_unit->shadows = ResourceManager_LoadResource(UnitsManager_AbstractUnits[unit_type].shadows);
+
+        if (ResourceManager_DisableEnhancedGraphics) {
+            if (base_unit->sprite) {
+                base_unit->sprite = Gfx_RescaleSprite(base_unit->sprite, &data_size, 0, 2);
+
+                ResourceManager_Realloc(UnitsManager_AbstractUnits[unit_type].sprite, base_unit->sprite, data_size);
+            }
+
+            if (base_unit->shadows) {
+                base_unit->shadows = Gfx_RescaleSprite(base_unit->shadows, &data_size, 1, 2);
+
+                ResourceManager_Realloc(UnitsManager_AbstractUnits[unit_type].shadows, base_unit->shadows, data_size);
+            }
+        }
+    }
+
+    switch (unit_type) {
+        case COMMTWR: {
+            popup = &UnitsManager_PopupCallbacks[22];
+        } break;
+
+        case POWERSTN:
+        case POWGEN: {
+            popup = &UnitsManager_PopupCallbacks[19];
+        } break;
+
+        case BARRACKS:
+        case DEPOT:
+        case HANGAR:
+        case DOCK: {
+            popup = &UnitsManager_PopupCallbacks[12];
+        } break;
+
+        case ADUMP: {
+            popup = &UnitsManager_PopupCallbacks[9];
+        } break;
+
+        case FDUMP: {
+            popup = &UnitsManager_PopupCallbacks[10];
+        } break;
+
+        case SHIPYARD:
+        case LIGHTPLT:
+        case LANDPLT:
+        case AIRPLT:
+        case TRAINHAL: {
+            popup = &UnitsManager_PopupCallbacks[14];
+        } break;
+
+        case RESEARCH: {
+            popup = &UnitsManager_PopupCallbacks[18];
+        } break;
+
+        case GREENHSE: {
+            popup = &UnitsManager_PopupCallbacks[17];
+        } break;
+
+        case RECCENTR: {
+            popup = &UnitsManager_PopupCallbacks[15];
+        } break;
+
+        case GUNTURRT:
+        case ANTIAIR:
+        case ARTYTRRT:
+        case ANTIMSSL:
+        case SCOUT:
+        case TANK:
+        case ARTILLRY:
+        case ROCKTLCH:
+        case MISSLLCH:
+        case SP_FLAK:
+        case INFANTRY:
+        case FASTBOAT:
+        case CORVETTE:
+        case BATTLSHP:
+        case SUBMARNE:
+        case MSSLBOAT:
+        case FIGHTER:
+        case BOMBER:
+        case JUGGRNT:
+        case ALNTANK:
+        case ALNASGUN:
+        case ALNPLANE: {
+            popup = &UnitsManager_PopupCallbacks[3];
+        } break;
+
+        case MININGST: {
+            popup = &UnitsManager_PopupCallbacks[16];
+        } break;
+
+        case MASTER: {
+            popup = &UnitsManager_PopupCallbacks[21];
+        } break;
+
+        case CONSTRCT:
+        case ENGINEER: {
+            popup = &UnitsManager_PopupCallbacks[13];
+        } break;
+
+        case MINELAYR:
+        case SEAMNLYR: {
+            popup = &UnitsManager_PopupCallbacks[6];
+        } break;
+
+        case SURVEYOR: {
+            popup = &UnitsManager_PopupCallbacks[2];
+        } break;
+
+        case SCANNER:
+        case GOLDTRCK: {
+            popup = &UnitsManager_PopupCallbacks[1];
+        } break;
+
+        case SPLYTRCK:
+        case CARGOSHP: {
+            popup = &UnitsManager_PopupCallbacks[5];
+        } break;
+
+        case BULLDOZR: {
+            popup = &UnitsManager_PopupCallbacks[20];
+        } break;
+
+        case REPAIR: {
+            popup = &UnitsManager_PopupCallbacks[8];
+        } break;
+
+        case FUELTRCK: {
+            popup = &UnitsManager_PopupCallbacks[7];
+        } break;
+
+        case CLNTRANS:
+        case SEATRANS:
+        case AIRTRANS: {
+            popup = &UnitsManager_PopupCallbacks[11];
+        } break;
+
+        case COMMANDO: {
+            popup = &UnitsManager_PopupCallbacks[4];
+        } break;
+
+        default: {
+            popup = &UnitsManager_PopupCallbacks[0];
+        } break;
+    }
+
+    sound_table = UnitInfo_GetSoundTable(unit_type);
 }
 
 bool UnitInfo::IsVisibleToTeam(uint16_t team) const { return visible_to_team[team]; }
@@ -3614,7 +3622,7 @@ void UnitInfo::RenderShadow(Point point, int32_t image_id, Rect* bounds) {
                 Gfx_SpriteRowAddresses = reinterpret_cast<uint32_t*>(&frame->rows);
                 Gfx_ColorIndices = color_cycling_lut;
 
-                Gfx_DecodeShadow();
+                Gfx_DecodeCachedShadow(frame);
             }
         }
     }
@@ -3667,7 +3675,7 @@ void UnitInfo::RenderSprite(Point point, int32_t image_base, Rect* bounds) {
                     Gfx_TeamColorIndexBase = COLOR_BLACK;
                 }
 
-                Gfx_DecodeSprite();
+                Gfx_DecodeCachedSprite(frame);
             }
         }
     }
@@ -446,4 +446,6 @@ public:
     uint32_t field_221;
 };
 
+const std::vector<SoundElement>* UnitInfo_GetSoundTable(ResourceID unit_type);
+
 #endif /* UNITINFO_HPP */
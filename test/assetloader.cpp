@@ -0,0 +1,92 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "assetloader.hpp"
+
+#include <SDL_atomic.h>
+#include <gtest/gtest.h>
+
+struct AssetLoaderTestJob {
+    SDL_atomic_t* counter;
+    int32_t order;
+};
+
+static void AssetLoaderTest_Job(void* data) {
+    AssetLoaderTestJob* job = reinterpret_cast<AssetLoaderTestJob*>(data);
+
+    job->order = SDL_AtomicIncRef(job->counter);
+}
+
+TEST(AssetLoaderTest, RunsAllJobs) {
+    AssetLoader loader;
+    SDL_atomic_t counter;
+    AssetLoaderTestJob jobs[ASSETLOADER_MAX_JOBS];
+
+    SDL_AtomicSet(&counter, 0);
+
+    for (int32_t i = 0; i < ASSETLOADER_MAX_JOBS; ++i) {
+        jobs[i].counter = &counter;
+        jobs[i].order = -1;
+
+        EXPECT_EQ(loader.AddJob(&AssetLoaderTest_Job, &jobs[i]), i);
+    }
+
+    loader.Run(nullptr, 0, 100);
+
+    EXPECT_EQ(SDL_AtomicGet(&counter), ASSETLOADER_MAX_JOBS);
+    EXPECT_EQ(loader.GetJobCount(), 0);
+
+    for (int32_t i = 0; i < ASSETLOADER_MAX_JOBS; ++i) {
+        EXPECT_GE(jobs[i].order, 0);
+    }
+
+    loader.Run(nullptr, 0, 100);
+};
+
+TEST(AssetLoaderTest, Dependencies) {
+    AssetLoader loader;
+    SDL_atomic_t counter;
+    AssetLoaderTestJob jobs[6];
+
+    SDL_AtomicSet(&counter, 0);
+
+    for (int32_t i = 0; i < 6; ++i) {
+        jobs[i].counter = &counter;
+        jobs[i].order = -1;
+
+        loader.AddJob(&AssetLoaderTest_Job, &jobs[i], i + 1);
+    }
+
+    /* 0 -> 2 -> 5, 1 -> 2, 3 -> 4 -> 5 */
+    loader.AddDependency(2, 0);
+    loader.AddDependency(2, 1);
+    loader.AddDependency(5, 2);
+    loader.AddDependency(4, 3);
+    loader.AddDependency(5, 4);
+    loader.AddDependency(5, 4);
+
+    loader.Run(nullptr, 0, 100);
+
+    EXPECT_GT(jobs[2].order, jobs[0].order);
+    EXPECT_GT(jobs[2].order, jobs[1].order);
+    EXPECT_GT(jobs[4].order, jobs[3].order);
+    EXPECT_EQ(jobs[5].order, 5);
+};
@@ -0,0 +1,191 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Benchmark of complete computer player turns. Each saved game given on the command line is loaded in headless mode,
+ * all of its teams are handed over to the computer and a fixed number of turns is played. The original game data
+ * files are required. Reported figures are the wall clock time per turn, the number of path requests served and map
+ * tiles evaluated by the path finder, the number of threat maps built from scratch, the peak resident set size of the
+ * process and a checksum of the final game state that reveals whether two runs diverged.
+ *
+ * Usage: benchmark_ai_turns [--turns N] [--seed S] SAVE1.DTA [SAVE2.MLT ...]
+ */
+
+#include <SDL.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#include "aiplayer.hpp"
+#include "game_manager.hpp"
+#include "headless.hpp"
+#include "inifile.hpp"
+#include "paths_manager.hpp"
+#include "resource_manager.hpp"
+#include "saveloadmenu.hpp"
+#include "smartstring.hpp"
+
+#define BENCHMARK_DEFAULT_TURN_COUNT 5
+#define BENCHMARK_DEFAULT_RNG_SEED 1
+#define BENCHMARK_SAVE_SLOT 1
+
+static uint64_t Benchmark_GetPeakMemoryUsage() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+
+    if (K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return counters.PeakWorkingSetSize;
+    }
+
+    return 0;
+#else
+    struct rusage usage;
+
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+        return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+    }
+
+    return 0;
+#endif
+}
+
+static int32_t Benchmark_GetGameFileType(const std::filesystem::path& filepath) {
+    const int32_t game_file_types[] = {GAME_TYPE_CUSTOM, GAME_TYPE_HOT_SEAT, GAME_TYPE_MULTI};
+    const auto extension{filepath.extension().string()};
+
+    for (const auto game_file_type : game_file_types) {
+        if (extension.size() > 1 && SDL_strcasecmp(&extension[1], SaveLoadMenu_SaveFileTypes[game_file_type]) == 0) {
+            return game_file_type;
+        }
+    }
+
+    return -1;
+}
+
+static bool Benchmark_Run(const std::filesystem::path& filepath) {
+    const int32_t game_file_type = Benchmark_GetGameFileType(filepath);
+
+    if (game_file_type < 0) {
+        printf("%s: unsupported saved game type\n", filepath.string().c_str());
+
+        return false;
+    }
+
+    SmartString filename;
+    std::error_code ec;
+
+    filename.Sprintf(20, "save%i.%s", BENCHMARK_SAVE_SLOT, SaveLoadMenu_SaveFileTypes[game_file_type]).Toupper();
+
+    std::filesystem::copy_file(filepath, ResourceManager_FilePathGamePref / filename.GetCStr(),
+                               std::filesystem::copy_options::overwrite_existing, ec);
+
+    if (ec) {
+        printf("%s: %s\n", filepath.string().c_str(), ec.message().c_str());
+
+        return false;
+    }
+
+    ini_set_setting(INI_GAME_FILE_NUMBER, BENCHMARK_SAVE_SLOT);
+    ini_set_setting(INI_GAME_FILE_TYPE, game_file_type);
+
+    const uint32_t served_request_count = PathsManager_GetServedRequestCount();
+    const PathsStatistics paths_statistics = PathsManager_GetStatistics();
+    const uint32_t threat_map_build_count = AiPlayer_ThreatMapBuildCount;
+
+    GameManager_GameLoop(GAME_STATE_10);
+
+    const HeadlessResult& result = Headless_GetResult();
+
+    if (!result.is_complete) {
+        printf("%s: game ended prematurely\n", filepath.string().c_str());
+
+        return false;
+    }
+
+    printf("%s\n", filepath.string().c_str());
+    printf("    turns played       %9i\n", result.turns_played);
+    printf("    ms per turn        %9.1f\n", static_cast<double>(result.elapsed_time) / result.turns_played);
+    printf("    max turn ms        %9u\n", result.max_turn_time);
+    printf("    path requests      %9u\n", PathsManager_GetServedRequestCount() - served_request_count);
+    printf("    evaluated tiles    %9llu\n",
+           static_cast<unsigned long long>(PathsManager_GetStatistics().evaluated_tile_count -
+                                           paths_statistics.evaluated_tile_count));
+    printf("    evaluated squares  %9llu\n",
+           static_cast<unsigned long long>(PathsManager_GetStatistics().evaluated_square_count -
+                                           paths_statistics.evaluated_square_count));
+    printf("    threat map builds  %9u\n", AiPlayer_ThreatMapBuildCount - threat_map_build_count);
+    printf("    peak RSS KiB       %9llu\n", static_cast<unsigned long long>(Benchmark_GetPeakMemoryUsage() / 1024));
+    printf("    checksum            %08X\n", result.checksum);
+
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    int32_t turn_count = BENCHMARK_DEFAULT_TURN_COUNT;
+    uint32_t rng_seed = BENCHMARK_DEFAULT_RNG_SEED;
+    int32_t first_save = argc;
+
+    for (int32_t i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--turns") && i + 1 < argc) {
+            turn_count = SDL_atoi(argv[++i]);
+
+        } else if (!strcmp(argv[i], "--seed") && i + 1 < argc) {
+            rng_seed = SDL_strtoul(argv[++i], nullptr, 10);
+
+        } else {
+            first_save = i;
+            break;
+        }
+    }
+
+    if (first_save == argc) {
+        printf("Usage: %s [--turns N] [--seed S] SAVE1.DTA [SAVE2.MLT ...]\n", argv[0]);
+
+        return EXIT_FAILURE;
+    }
+
+    Headless_Init(rng_seed, turn_count);
+
+    ResourceManager_InitResources();
+
+    /* keep the saved games of the user out of reach */
+    ResourceManager_FilePathGamePref = std::filesystem::temp_directory_path() / "max_benchmark_ai_turns";
+
+    std::filesystem::create_directories(ResourceManager_FilePathGamePref);
+
+    int32_t result = EXIT_SUCCESS;
+
+    for (int32_t i = first_save; i < argc; ++i) {
+        if (!Benchmark_Run(argv[i])) {
+            result = EXIT_FAILURE;
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,139 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Micro-benchmark of the reference count traffic of SmartPointer based containers. Every scenario is run once with
+ * copy semantics and once with move semantics so that the cost of the avoided increment/decrement pairs is visible.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <utility>
+
+#include "smartlist.hpp"
+#include "testobject.hpp"
+
+#define BENCHMARK_OBJECT_COUNT 200
+#define BENCHMARK_PASS_COUNT 20000
+
+static SmartPointer<TestObject> Benchmark_Objects[BENCHMARK_OBJECT_COUNT];
+
+static SmartPointer<TestObject> Benchmark_Pass(SmartPointer<TestObject> object) { return object; }
+
+template <bool Move>
+static double Benchmark_Run(int32_t test) {
+    const auto start = std::chrono::steady_clock::now();
+    uint32_t checksum{0};
+
+    switch (test) {
+        case 0: {
+            for (int32_t i = 0; i < BENCHMARK_PASS_COUNT; ++i) {
+                for (auto& object : Benchmark_Objects) {
+                    SmartPointer<TestObject> local(object);
+
+                    if constexpr (Move) {
+                        local = Benchmark_Pass(std::move(local));
+
+                    } else {
+                        local = Benchmark_Pass(local);
+                    }
+
+                    checksum += local->Get();
+                }
+            }
+        } break;
+
+        case 1: {
+            /* element shifting as done by SmartArray::Insert() and SmartArray::Erase() */
+            SmartPointer<TestObject> array[BENCHMARK_OBJECT_COUNT];
+
+            for (int32_t j = 0; j < BENCHMARK_OBJECT_COUNT; ++j) {
+                array[j] = Benchmark_Objects[j];
+            }
+
+            for (int32_t i = 0; i < BENCHMARK_PASS_COUNT; ++i) {
+                SmartPointer<TestObject> last(std::move(array[BENCHMARK_OBJECT_COUNT - 1]));
+
+                for (int32_t j = BENCHMARK_OBJECT_COUNT - 1; j > 0; --j) {
+                    if constexpr (Move) {
+                        array[j] = std::move(array[j - 1]);
+
+                    } else {
+                        array[j] = array[j - 1];
+                    }
+                }
+
+                array[0] = std::move(last);
+                checksum += array[0]->Get();
+            }
+        } break;
+
+        case 2: {
+            SmartList<TestObject> list;
+
+            for (auto& object : Benchmark_Objects) {
+                list.PushBack(*object);
+            }
+
+            for (int32_t i = 0; i < BENCHMARK_PASS_COUNT; ++i) {
+                SmartList<TestObject>::Iterator it = list.Begin();
+
+                while (it != list.End()) {
+                    SmartList<TestObject>::Iterator next = it;
+
+                    ++next;
+                    checksum += (*it).Get();
+
+                    if constexpr (Move) {
+                        it = std::move(next);
+
+                    } else {
+                        it = next;
+                    }
+                }
+            }
+        } break;
+    }
+
+    if (checksum == 0) {
+        printf("unexpected checksum\n");
+    }
+
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    const char* tests[] = {"pass by value", "array shift", "list iterate"};
+
+    for (int32_t i = 0; i < BENCHMARK_OBJECT_COUNT; ++i) {
+        Benchmark_Objects[i] = new (std::nothrow) TestObject();
+        Benchmark_Objects[i]->Set(i + 1);
+    }
+
+    for (int32_t test = 0; test < static_cast<int32_t>(sizeof(tests) / sizeof(tests[0])); ++test) {
+        const double copy = Benchmark_Run<false>(test);
+        const double move = Benchmark_Run<true>(test);
+
+        printf("%-16s copy %9.2f ms move %9.2f ms (x%.2f)\n", tests[test], copy, move, copy / move);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,110 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Micro-benchmark of the threat map span kernels. Every available instruction set is compared against the scalar
+ * reference implementation on a 112x112 map using the access patterns of AiPlayer::GetThreatMap.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "threatkernels.hpp"
+
+#define BENCHMARK_MAP_SIZE 112
+#define BENCHMARK_DISC_COUNT 200000
+#define BENCHMARK_PASS_COUNT 2000
+
+static int16_t Benchmark_DamageMap[BENCHMARK_MAP_SIZE * BENCHMARK_MAP_SIZE];
+static int16_t Benchmark_ShotsMap[BENCHMARK_MAP_SIZE * BENCHMARK_MAP_SIZE];
+
+static void Benchmark_Fill(int32_t grid_x, int32_t grid_y, int32_t range, int32_t value, bool normalize) {
+    for (int32_t x = std::max(grid_x - range, 0); x <= std::min(grid_x + range, BENCHMARK_MAP_SIZE - 1); ++x) {
+        int32_t half_height = range;
+
+        while (half_height >= 0 && half_height * half_height + (x - grid_x) * (x - grid_x) > range * range) {
+            --half_height;
+        }
+
+        const int32_t y = std::max(grid_y - half_height, 0);
+        const int32_t limit = std::min(grid_y + half_height, BENCHMARK_MAP_SIZE - 1);
+
+        ThreatKernels_AddSpan(&Benchmark_DamageMap[x * BENCHMARK_MAP_SIZE + y], limit - y + 1, value, normalize);
+    }
+}
+
+static double Benchmark_Run(uint8_t instruction_set, int32_t test) {
+    const auto start = std::chrono::steady_clock::now();
+    const size_t size = BENCHMARK_MAP_SIZE * BENCHMARK_MAP_SIZE;
+
+    ThreatKernels_SetInstructionSet(instruction_set);
+    srand(1);
+
+    switch (test) {
+        case 0: {
+            for (int32_t i = 0; i < BENCHMARK_DISC_COUNT; ++i) {
+                Benchmark_Fill(rand() % BENCHMARK_MAP_SIZE, rand() % BENCHMARK_MAP_SIZE, 3 + rand() % 10, 12, i & 1);
+            }
+        } break;
+
+        case 1: {
+            for (int32_t i = 0; i < BENCHMARK_PASS_COUNT; ++i) {
+                ThreatKernels_RebaseSpan(Benchmark_DamageMap, Benchmark_ShotsMap, size, (i & 1) ? 3 : -3);
+            }
+        } break;
+
+        case 2: {
+            for (int32_t i = 0; i < BENCHMARK_PASS_COUNT; ++i) {
+                ThreatKernels_NormalizeSpan(Benchmark_DamageMap, Benchmark_ShotsMap, size);
+                ThreatKernels_SumSpan(Benchmark_DamageMap, Benchmark_ShotsMap, size);
+            }
+        } break;
+    }
+
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    const char* tests[] = {"disc fill", "armor rebase", "normalize + sum"};
+
+    for (int32_t i = 0; i < BENCHMARK_MAP_SIZE * BENCHMARK_MAP_SIZE; ++i) {
+        Benchmark_ShotsMap[i] = rand() % 8;
+    }
+
+    for (int32_t test = 0; test < static_cast<int32_t>(sizeof(tests) / sizeof(tests[0])); ++test) {
+        const double reference = Benchmark_Run(THREAT_KERNELS_SCALAR, test);
+
+        printf("%-16s %-6s %9.2f ms\n", tests[test], ThreatKernels_GetInstructionSetName(THREAT_KERNELS_SCALAR),
+               reference);
+
+        for (uint8_t instruction_set = THREAT_KERNELS_SSE2; instruction_set <= THREAT_KERNELS_AVX2; ++instruction_set) {
+            if (ThreatKernels_SetInstructionSet(instruction_set) == instruction_set) {
+                const double elapsed = Benchmark_Run(instruction_set, test);
+
+                printf("%-16s %-6s %9.2f ms (x%.2f)\n", tests[test],
+                       ThreatKernels_GetInstructionSetName(instruction_set), elapsed, reference / elapsed);
+            }
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,246 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "clustermap.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <queue>
+#include <vector>
+
+#include "resource_manager.hpp"
+
+class ClusterMapTest : public ::testing::Test {
+protected:
+    uint8_t **map{nullptr};
+    ClusterMap cluster_map;
+
+    void SetUp() override {
+        saved_map_size = ResourceManager_MapSize;
+
+        srand(1);
+    }
+
+    void TearDown() override {
+        FreeMap();
+
+        ResourceManager_MapSize = saved_map_size;
+    }
+
+    void CreateMap(int32_t width, int32_t height, int32_t blocked_percentage) {
+        FreeMap();
+
+        ResourceManager_MapSize = Point(width, height);
+
+        map = new (std::nothrow) uint8_t *[width];
+
+        for (int32_t x = 0; x < width; ++x) {
+            map[x] = new (std::nothrow) uint8_t[height];
+
+            for (int32_t y = 0; y < height; ++y) {
+                map[x][y] = (rand() % 100 < blocked_percentage) ? 0 : (rand() % 4 + 1);
+            }
+        }
+    }
+
+    void FreeMap() {
+        if (map) {
+            for (int32_t x = 0; x < ResourceManager_MapSize.x; ++x) {
+                delete[] map[x];
+            }
+
+            delete[] map;
+            map = nullptr;
+        }
+    }
+
+    void Fill(Point ulp, Point lrp, uint8_t cost) {
+        for (int32_t x = ulp.x; x < lrp.x; ++x) {
+            for (int32_t y = ulp.y; y < lrp.y; ++y) {
+                map[x][y] = cost;
+            }
+        }
+    }
+
+    static int32_t GetClusterIndex(Point position) {
+        const int32_t cluster_count_x =
+            (ResourceManager_MapSize.x + CLUSTERMAP_CLUSTER_SIZE - 1) / CLUSTERMAP_CLUSTER_SIZE;
+
+        return (position.y / CLUSTERMAP_CLUSTER_SIZE) * cluster_count_x + (position.x / CLUSTERMAP_CLUSTER_SIZE);
+    }
+
+    /* plain A* over the whole map with the cost model of the Searcher, optionally limited to a corridor of clusters
+     * and to orthogonal steps
+     */
+    bool IsReachable(Point start, Point destination, const bool *corridor, bool is_orthogonal) {
+        static const Point steps[] = {Point(0, -1), Point(1, -1), Point(1, 0), Point(1, 1),
+                                      Point(0, 1),  Point(-1, 1), Point(-1, 0), Point(-1, -1)};
+        const int32_t width = ResourceManager_MapSize.x;
+        const int32_t height = ResourceManager_MapSize.y;
+        std::vector<int32_t> costs(width * height, INT32_MAX);
+        std::priority_queue<std::pair<int32_t, int32_t>, std::vector<std::pair<int32_t, int32_t>>,
+                            std::greater<std::pair<int32_t, int32_t>>>
+            squares;
+
+        costs[start.x * height + start.y] = 0;
+        squares.push({0, start.x * height + start.y});
+
+        while (!squares.empty()) {
+            const int32_t index = squares.top().second;
+            const Point position(index / height, index % height);
+
+            squares.pop();
+
+            if (position == destination) {
+                return true;
+            }
+
+            for (int32_t direction = 0; direction < 8; direction += is_orthogonal ? 2 : 1) {
+                const Point site = position + steps[direction];
+
+                if (site.x >= 0 && site.x < width && site.y >= 0 && site.y < height && map[site.x][site.y] &&
+                    (!corridor || corridor[GetClusterIndex(site)])) {
+                    int32_t cost = map[site.x][site.y];
+
+                    if (direction & 1) {
+                        cost = (cost * 3) / 2;
+                    }
+
+                    cost += costs[index];
+
+                    if (cost < costs[site.x * height + site.y]) {
+                        const int32_t distance_x = labs(site.x - destination.x);
+                        const int32_t distance_y = labs(site.y - destination.y);
+
+                        costs[site.x * height + site.y] = cost;
+                        squares.push({cost + std::min(distance_x, distance_y), site.x * height + site.y});
+                    }
+                }
+            }
+        }
+
+        return false;
+    }
+
+    Point GetPassableSite() {
+        Point site;
+
+        do {
+            site = Point(rand() % ResourceManager_MapSize.x, rand() % ResourceManager_MapSize.y);
+        } while (!map[site.x][site.y]);
+
+        return site;
+    }
+
+    void Verify(Point start, Point destination) {
+        bool corridor[64];
+
+        ASSERT_LE(cluster_map.GetClusterCount(), 64);
+
+        const bool is_found = cluster_map.FindCorridor(start, destination, corridor);
+
+        if (GetClusterIndex(start) == GetClusterIndex(destination)) {
+            EXPECT_FALSE(is_found);
+
+        } else if (is_found) {
+            /* every corridor must contain an actual path */
+            EXPECT_TRUE(corridor[GetClusterIndex(start)]);
+            EXPECT_TRUE(corridor[GetClusterIndex(destination)]);
+            EXPECT_TRUE(IsReachable(start, destination, corridor, false));
+
+        } else {
+            /* portals are placed on straight border crossings, so orthogonal paths are always found */
+            EXPECT_FALSE(IsReachable(start, destination, nullptr, true));
+        }
+    }
+
+private:
+    Point saved_map_size;
+};
+
+TEST_F(ClusterMapTest, MatchesReachability) {
+    for (int32_t blocked_percentage = 0; blocked_percentage <= 50; blocked_percentage += 10) {
+        CreateMap(47, 33, blocked_percentage);
+
+        cluster_map.Update(map);
+
+        for (int32_t i = 0; i < 100; ++i) {
+            Verify(GetPassableSite(), GetPassableSite());
+        }
+    }
+};
+
+TEST_F(ClusterMapTest, BlockedPortals) {
+    bool corridor[16];
+
+    CreateMap(40, 20, 0);
+
+    /* two walls split the map into three regions that are connected by a single gap each */
+    Fill(Point(10, 0), Point(11, 20), 0);
+    Fill(Point(30, 0), Point(31, 20), 0);
+    Fill(Point(10, 15), Point(11, 16), 1);
+    Fill(Point(30, 3), Point(31, 4), 1);
+
+    cluster_map.Update(map);
+
+    ASSERT_TRUE(cluster_map.FindCorridor(Point(2, 2), Point(38, 17), corridor));
+    EXPECT_TRUE(IsReachable(Point(2, 2), Point(38, 17), corridor, false));
+
+    /* the gap in the first wall is closed */
+    map[10][15] = 0;
+
+    cluster_map.Update(map);
+
+    EXPECT_FALSE(cluster_map.FindCorridor(Point(2, 2), Point(38, 17), corridor));
+    EXPECT_FALSE(IsReachable(Point(2, 2), Point(38, 17), nullptr, false));
+
+    /* a new gap in the top clusters opens the map again */
+    map[10][4] = 2;
+
+    cluster_map.Update(map);
+
+    ASSERT_TRUE(cluster_map.FindCorridor(Point(2, 2), Point(38, 17), corridor));
+    EXPECT_TRUE(IsReachable(Point(2, 2), Point(38, 17), corridor, false));
+    EXPECT_TRUE(corridor[1]);
+    EXPECT_FALSE(corridor[5]);
+};
+
+TEST_F(ClusterMapTest, UpdateAfterTileChanges) {
+    CreateMap(50, 30, 35);
+
+    cluster_map.Update(map);
+
+    for (int32_t round = 0; round < 20; ++round) {
+        /* flip a few tiles so that some clusters and their neighbours need to be rebuilt */
+        for (int32_t i = 0; i < 15; ++i) {
+            const Point site(rand() % ResourceManager_MapSize.x, rand() % ResourceManager_MapSize.y);
+
+            map[site.x][site.y] = map[site.x][site.y] ? 0 : (rand() % 4 + 1);
+        }
+
+        cluster_map.Update(map);
+
+        for (int32_t i = 0; i < 20; ++i) {
+            Verify(GetPassableSite(), GetPassableSite());
+        }
+    }
+};
@@ -0,0 +1,101 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "grid2d.hpp"
+
+#include <gtest/gtest.h>
+
+TEST(Grid2DTest, Ctor) {
+    Grid2D<uint8_t> grid1;
+    Grid2D<int16_t> grid2(0, 10);
+    Grid2D<uint16_t> grid3(112, 64);
+
+    EXPECT_FALSE(grid1.IsInited());
+    EXPECT_FALSE(grid2.IsInited());
+    EXPECT_TRUE(grid3.IsInited());
+    EXPECT_EQ(grid3.GetWidth(), 112);
+    EXPECT_EQ(grid3.GetHeight(), 64);
+    EXPECT_EQ(grid3.GetSize(), 112 * 64);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(grid3.GetData()) % 64, 0);
+};
+
+TEST(Grid2DTest, Layout) {
+    Grid2D<int16_t> column_major(3, 2);
+    Grid2D<int16_t, GRID2D_ROW_MAJOR> row_major(3, 2);
+
+    for (int32_t x = 0; x < 3; ++x) {
+        for (int32_t y = 0; y < 2; ++y) {
+            column_major.At(x, y) = x * 10 + y;
+            row_major.At(x, y) = x * 10 + y;
+        }
+    }
+
+    EXPECT_EQ(column_major[2][1], 21);
+    EXPECT_EQ(column_major.GetMap()[1][0], 10);
+    EXPECT_EQ(column_major.GetData()[1 * 2 + 1], 11);
+
+    EXPECT_EQ(row_major[1][2], 21);
+    EXPECT_EQ(row_major.GetMap()[0][1], 10);
+    EXPECT_EQ(row_major.GetData()[1 * 3 + 1], 11);
+};
+
+TEST(Grid2DTest, Init) {
+    Grid2D<uint8_t> grid(10, 10);
+    uint8_t* data = grid.GetData();
+
+    EXPECT_TRUE(grid.Init(10, 10));
+    EXPECT_EQ(grid.GetData(), data);
+
+    EXPECT_TRUE(grid.Init(20, 5));
+    EXPECT_EQ(grid.GetWidth(), 20);
+    EXPECT_EQ(grid.GetHeight(), 5);
+    EXPECT_EQ(grid[19] - grid[0], 19 * 5);
+
+    grid.Deinit();
+
+    EXPECT_FALSE(grid.IsInited());
+    EXPECT_EQ(grid.GetMap(), nullptr);
+    EXPECT_EQ(grid.GetSize(), 0);
+};
+
+TEST(Grid2DTest, FillAndCopy) {
+    Grid2D<uint16_t> grid1(7, 9);
+    Grid2D<uint16_t> grid2(7, 9);
+    Grid2D<uint8_t> grid3(4, 4);
+
+    grid1.Fill(0x3FFF);
+    grid3.Fill(0xFF);
+
+    EXPECT_EQ(grid1[0][0], 0x3FFF);
+    EXPECT_EQ(grid1[6][8], 0x3FFF);
+    EXPECT_EQ(grid3[3][3], 0xFF);
+
+    grid1[3][4] = 42;
+    grid2.Copy(grid1);
+
+    EXPECT_EQ(grid2[3][4], 42);
+    EXPECT_EQ(grid2[6][8], 0x3FFF);
+
+    grid2.Clear();
+
+    EXPECT_EQ(grid2[3][4], 0);
+    EXPECT_EQ(grid1[3][4], 42);
+};
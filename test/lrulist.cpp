@@ -0,0 +1,96 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "lrulist.hpp"
+
+#include <gtest/gtest.h>
+
+struct LruListTestEntry : public LruListNode<LruListTestEntry> {
+    int32_t value;
+};
+
+TEST(LruListTest, Order) {
+    LruList<LruListTestEntry> list;
+    LruListTestEntry entries[4];
+
+    EXPECT_EQ(list.Front(), nullptr);
+    EXPECT_EQ(list.Back(), nullptr);
+
+    for (int32_t i = 0; i < 4; ++i) {
+        entries[i].value = i;
+        list.PushFront(&entries[i]);
+    }
+
+    EXPECT_EQ(list.GetCount(), 4);
+    EXPECT_EQ(list.Front(), &entries[3]);
+    EXPECT_EQ(list.Back(), &entries[0]);
+
+    list.MoveToFront(&entries[0]);
+
+    EXPECT_EQ(list.Front(), &entries[0]);
+    EXPECT_EQ(list.Back(), &entries[1]);
+
+    list.MoveToFront(&entries[0]);
+
+    EXPECT_EQ(list.Front(), &entries[0]);
+    EXPECT_EQ(list.GetCount(), 4);
+
+    int32_t expected[] = {0, 3, 2, 1};
+    int32_t index = 0;
+
+    for (LruListTestEntry* entry = list.Front(); entry; entry = entry->lru_next, ++index) {
+        ASSERT_LT(index, 4);
+        EXPECT_EQ(entry->value, expected[index]);
+    }
+
+    EXPECT_EQ(index, 4);
+};
+
+TEST(LruListTest, Evict) {
+    LruList<LruListTestEntry> list;
+    LruListTestEntry entries[3];
+
+    for (auto& entry : entries) {
+        list.PushFront(&entry);
+    }
+
+    list.MoveToFront(&entries[1]);
+    list.Remove(&entries[2]);
+
+    EXPECT_EQ(list.GetCount(), 2);
+    EXPECT_EQ(list.Front(), &entries[1]);
+    EXPECT_EQ(list.Back(), &entries[0]);
+    EXPECT_EQ(entries[2].lru_previous, nullptr);
+    EXPECT_EQ(entries[2].lru_next, nullptr);
+
+    while (list.Back()) {
+        list.Remove(list.Back());
+    }
+
+    EXPECT_EQ(list.GetCount(), 0);
+    EXPECT_EQ(list.Front(), nullptr);
+
+    list.PushFront(&entries[2]);
+    list.Clear();
+
+    EXPECT_EQ(list.GetCount(), 0);
+    EXPECT_EQ(list.Back(), nullptr);
+};
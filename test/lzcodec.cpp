@@ -0,0 +1,101 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "lzcodec.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+
+static void LzCodecTest_RoundTrip(const std::vector<uint8_t>& source) {
+    std::vector<uint8_t> packed(LzCodec_GetBound(source.size()));
+    std::vector<uint8_t> unpacked(source.size());
+
+    size_t packed_size = LzCodec_Compress(source.data(), source.size(), packed.data(), packed.size());
+
+    ASSERT_GT(packed_size, 0u);
+    EXPECT_EQ(LzCodec_Decompress(packed.data(), packed_size, unpacked.data(), unpacked.size()), true);
+    EXPECT_EQ(unpacked, source);
+}
+
+TEST(LzCodecTest, RoundTrip) {
+    std::vector<uint8_t> source;
+    uint32_t seed{1};
+
+    LzCodecTest_RoundTrip(source);
+
+    for (size_t i = 0; i < 300000; ++i) {
+        seed = seed * 1103515245 + 12345;
+
+        /* runs of zeros, repeated records and noise like in save files */
+        if ((i / 4096) % 3 == 0) {
+            source.push_back(0);
+
+        } else if ((i / 4096) % 3 == 1) {
+            source.push_back(i % 37);
+
+        } else {
+            source.push_back(seed >> 24);
+        }
+    }
+
+    LzCodecTest_RoundTrip(source);
+
+    for (size_t size = 1; size < 40; ++size) {
+        LzCodecTest_RoundTrip(std::vector<uint8_t>(&source[8000], &source[8000 + size]));
+        LzCodecTest_RoundTrip(std::vector<uint8_t>(&source[9000], &source[9000 + size]));
+    }
+};
+
+TEST(LzCodecTest, Compresses) {
+    std::vector<uint8_t> source(100000, 0x5A);
+    std::vector<uint8_t> packed(LzCodec_GetBound(source.size()));
+
+    size_t packed_size = LzCodec_Compress(source.data(), source.size(), packed.data(), packed.size());
+
+    EXPECT_GT(packed_size, 0u);
+    EXPECT_LT(packed_size, source.size() / 100);
+};
+
+TEST(LzCodecTest, RejectsDamagedInput) {
+    std::vector<uint8_t> source(10000);
+    std::vector<uint8_t> packed(LzCodec_GetBound(source.size()));
+    std::vector<uint8_t> unpacked(source.size());
+
+    for (size_t i = 0; i < source.size(); ++i) {
+        source[i] = (i * i) % 251;
+    }
+
+    size_t packed_size = LzCodec_Compress(source.data(), source.size(), packed.data(), packed.size());
+
+    EXPECT_EQ(LzCodec_Decompress(packed.data(), packed_size - 1, unpacked.data(), unpacked.size()), false);
+    EXPECT_EQ(LzCodec_Decompress(packed.data(), packed_size, unpacked.data(), unpacked.size() - 1), false);
+
+    for (size_t i = 0; i < packed_size; i += 7) {
+        std::vector<uint8_t> damaged(packed.begin(), packed.begin() + packed_size);
+
+        damaged[i] ^= 0xFF;
+
+        /* must never overrun, the result itself may be either */
+        (void)LzCodec_Decompress(damaged.data(), damaged.size(), unpacked.data(), unpacked.size());
+    }
+};
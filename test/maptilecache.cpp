@@ -0,0 +1,99 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "maptilecache.hpp"
+
+#include <gtest/gtest.h>
+
+TEST(MapTileCacheTest, Configure) {
+    MapTileCache cache;
+
+    EXPECT_EQ(cache.Find(0), nullptr);
+    EXPECT_FALSE(cache.Configure(0, 16, 0, 64));
+
+    EXPECT_TRUE(cache.Configure(100, 16, 0, 64));
+    EXPECT_EQ(cache.GetSlotCount(), 100);
+    EXPECT_EQ(cache.GetUsedSlotCount(), 0);
+
+    EXPECT_NE(cache.Insert(5), nullptr);
+    EXPECT_TRUE(cache.Configure(100, 16, 0, 64));
+    EXPECT_NE(cache.Find(5), nullptr);
+
+    EXPECT_TRUE(cache.Configure(100, 16, 32, 64));
+    EXPECT_EQ(cache.Find(5), nullptr);
+    EXPECT_EQ(cache.GetUsedSlotCount(), 0);
+
+    EXPECT_TRUE(cache.Configure(40000, 64, 32, 64));
+    EXPECT_EQ(cache.GetSlotCount(), MAPTILECACHE_ARENA_SIZE / (64 * 64));
+
+    EXPECT_EQ(cache.Insert(40000), nullptr);
+};
+
+TEST(MapTileCacheTest, FindAndInsert) {
+    MapTileCache cache;
+
+    EXPECT_TRUE(cache.Configure(10, 8, 0, 64));
+
+    uint8_t* slot1 = cache.Insert(1);
+    uint8_t* slot2 = cache.Insert(2);
+
+    ASSERT_NE(slot1, nullptr);
+    ASSERT_NE(slot2, nullptr);
+    EXPECT_EQ(std::abs(slot2 - slot1), 8 * 8);
+
+    slot1[63] = 42;
+
+    EXPECT_EQ(cache.Find(1), slot1);
+    EXPECT_EQ(cache.Find(1)[63], 42);
+    EXPECT_EQ(cache.Insert(1), slot1);
+    EXPECT_EQ(cache.Find(3), nullptr);
+    EXPECT_EQ(cache.GetUsedSlotCount(), 2);
+};
+
+TEST(MapTileCacheTest, SlotReuse) {
+    MapTileCache cache;
+    const int32_t slot_size = 64 * 64;
+    const int32_t slot_count = MAPTILECACHE_ARENA_SIZE / slot_size;
+
+    EXPECT_TRUE(cache.Configure(slot_count * 2, 64, 0, 64));
+
+    uint8_t* const arena = cache.Insert(0);
+
+    ASSERT_NE(arena, nullptr);
+
+    /* slots are handed out in arena order until the arena is full */
+    for (int32_t tile_id = 1; tile_id < slot_count; ++tile_id) {
+        EXPECT_EQ(cache.Insert(tile_id), &arena[tile_id * slot_size]);
+    }
+
+    /* afterwards each new tile takes over the slot of the oldest tile */
+    for (int32_t tile_id = slot_count; tile_id < slot_count * 2; ++tile_id) {
+        EXPECT_EQ(cache.Insert(tile_id), &arena[(tile_id - slot_count) * slot_size]);
+        EXPECT_EQ(cache.Find(tile_id - slot_count), nullptr);
+    }
+
+    EXPECT_EQ(cache.GetUsedSlotCount(), slot_count);
+
+    /* a different source tile size flushes the cache */
+    EXPECT_TRUE(cache.Configure(slot_count * 2, 64, 0, 32));
+    EXPECT_EQ(cache.Find(slot_count), nullptr);
+    EXPECT_EQ(cache.GetUsedSlotCount(), 0);
+};
@@ -0,0 +1,149 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "net_packet_batch.hpp"
+
+#include <gtest/gtest.h>
+
+static void NetPacketBatchTest_MakeUnitPacket(NetPacket& packet, uint16_t unit_id, uint16_t grid_x, uint16_t grid_y) {
+    packet.Reset();
+    packet << static_cast<uint8_t>(8);
+    packet << unit_id;
+    packet << grid_x;
+    packet << grid_y;
+
+    for (uint8_t i = 0; i < 32; ++i) {
+        packet << i;
+    }
+}
+
+TEST(NetPacketBatchTest, RoundTrip) {
+    NetPacketBatch sender(53);
+    NetPacketBatch receiver(53);
+    NetPacket packet;
+    NetPacket source;
+    uint8_t packet_type;
+    uint32_t value;
+
+    packet << static_cast<uint8_t>(4) << static_cast<uint32_t>(0xDEADBEEF);
+    EXPECT_EQ(sender.Add(packet, false), true);
+
+    for (uint16_t i = 0; i < 4; ++i) {
+        NetPacketBatchTest_MakeUnitPacket(packet, 7, i, 10);
+        EXPECT_EQ(sender.Add(packet, true), true);
+    }
+
+    EXPECT_EQ(sender.GetCount(), 5);
+
+    packet.Reset();
+    EXPECT_EQ(sender.Add(packet, false), false);
+
+    source.Write(sender.GetPacket().GetBuffer(), sender.GetDataSize());
+    source >> packet_type;
+    EXPECT_EQ(packet_type, 53);
+
+    EXPECT_EQ(receiver.Extract(source, packet), true);
+    packet >> packet_type >> value;
+    EXPECT_EQ(packet_type, 4);
+    EXPECT_EQ(value, 0xDEADBEEF);
+
+    for (uint16_t i = 0; i < 4; ++i) {
+        NetPacket expected;
+
+        NetPacketBatchTest_MakeUnitPacket(expected, 7, i, 10);
+
+        EXPECT_EQ(receiver.Extract(source, packet), true);
+        ASSERT_EQ(packet.GetDataSize(), expected.GetDataSize());
+        EXPECT_EQ(memcmp(packet.GetBuffer(), expected.GetBuffer(), expected.GetDataSize()), 0);
+    }
+
+    EXPECT_EQ(source.GetDataSize(), 0);
+    EXPECT_EQ(receiver.Extract(source, packet), false);
+};
+
+TEST(NetPacketBatchTest, DeltaSize) {
+    NetPacketBatch batch(53);
+    NetPacket packet;
+    int32_t keyed_size;
+
+    NetPacketBatchTest_MakeUnitPacket(packet, 3, 20, 20);
+    batch.Add(packet, true);
+    keyed_size = batch.GetDataSize();
+
+    NetPacketBatchTest_MakeUnitPacket(packet, 3, 21, 20);
+    batch.Add(packet, true);
+
+    EXPECT_LT(batch.GetDataSize() - keyed_size, keyed_size / 3);
+
+    batch.Clear();
+    EXPECT_EQ(batch.GetCount(), 0);
+    EXPECT_EQ(batch.GetDataSize(), 1);
+
+    NetPacketBatchTest_MakeUnitPacket(packet, 4, 20, 20);
+    batch.Add(packet, true);
+
+    EXPECT_GT(batch.GetDataSize(), packet.GetDataSize());
+};
+
+TEST(NetPacketBatchTest, MissingReference) {
+    NetPacketBatch sender(53);
+    NetPacketBatch receiver(53);
+    NetPacket packet;
+    NetPacket source;
+    uint8_t packet_type;
+
+    NetPacketBatchTest_MakeUnitPacket(packet, 9, 1, 1);
+    sender.Add(packet, true);
+    sender.Clear();
+
+    NetPacketBatchTest_MakeUnitPacket(packet, 9, 2, 1);
+    sender.Add(packet, true);
+
+    source.Write(sender.GetPacket().GetBuffer(), sender.GetDataSize());
+    source >> packet_type;
+
+    EXPECT_EQ(receiver.Extract(source, packet), false);
+};
+
+TEST(NetPacketBatchTest, ResetAfterLostBatch) {
+    NetPacketBatch sender(53);
+    NetPacketBatch receiver(53);
+    NetPacket packet;
+    NetPacket expected;
+    NetPacket source;
+    uint8_t packet_type;
+
+    /* the first batch never reaches the receiver, the sender drops its references */
+    NetPacketBatchTest_MakeUnitPacket(packet, 9, 1, 1);
+    sender.Add(packet, true);
+    sender.Reset();
+
+    NetPacketBatchTest_MakeUnitPacket(packet, 9, 2, 1);
+    NetPacketBatchTest_MakeUnitPacket(expected, 9, 2, 1);
+    sender.Add(packet, true);
+
+    source.Write(sender.GetPacket().GetBuffer(), sender.GetDataSize());
+    source >> packet_type;
+
+    EXPECT_EQ(receiver.Extract(source, packet), true);
+    ASSERT_EQ(packet.GetDataSize(), expected.GetDataSize());
+    EXPECT_EQ(memcmp(packet.GetBuffer(), expected.GetBuffer(), expected.GetDataSize()), 0);
+};
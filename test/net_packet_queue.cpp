@@ -0,0 +1,135 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "net_packet_queue.hpp"
+
+#include <SDL_thread.h>
+#include <SDL_timer.h>
+#include <gtest/gtest.h>
+
+#define NET_PACKET_QUEUE_TEST_PACKETS 20000
+
+static int NetPacketQueueTest_Producer(void* data) {
+    NetPacketQueue* queue = reinterpret_cast<NetPacketQueue*>(data);
+    NetPacket packet;
+
+    for (uint32_t i = 0; i < NET_PACKET_QUEUE_TEST_PACKETS; ++i) {
+        packet << i;
+        queue->Push(packet);
+
+        while (!queue->Flush()) {
+            SDL_Delay(1);
+        }
+    }
+
+    return 0;
+}
+
+TEST(NetPacketQueueTest, Order) {
+    NetPacketQueue queue(4);
+    NetPacket packet;
+    uint32_t value;
+
+    EXPECT_EQ(queue.IsEmpty(), true);
+    EXPECT_EQ(queue.Pop(packet), false);
+
+    for (uint32_t i = 0; i < 10; ++i) {
+        packet << i;
+        queue.Push(packet);
+        EXPECT_EQ(packet.GetDataSize(), 0);
+    }
+
+    EXPECT_EQ(queue.IsEmpty(), false);
+    EXPECT_EQ(queue.Flush(), false);
+
+    for (uint32_t i = 0; i < 10; ++i) {
+        if (i % 4 == 0) {
+            queue.Flush();
+        }
+
+        EXPECT_EQ(queue.Pop(packet), true);
+        EXPECT_EQ(packet.GetDataSize(), static_cast<int32_t>(sizeof(value)));
+        packet >> value;
+        EXPECT_EQ(value, i);
+    }
+
+    EXPECT_EQ(queue.Flush(), true);
+    EXPECT_EQ(queue.Pop(packet), false);
+    EXPECT_EQ(queue.IsEmpty(), true);
+};
+
+TEST(NetPacketQueueTest, Threads) {
+    NetPacketQueue queue(64);
+    NetPacket packet;
+    uint32_t expected{0};
+
+    SDL_Thread* thread = SDL_CreateThread(&NetPacketQueueTest_Producer, "NetPacketQueueTest", &queue);
+    ASSERT_NE(thread, nullptr);
+
+    while (expected < NET_PACKET_QUEUE_TEST_PACKETS) {
+        if (queue.Pop(packet)) {
+            uint32_t value;
+
+            packet >> value;
+            ASSERT_EQ(value, expected);
+            ++expected;
+
+        } else {
+            SDL_Delay(1);
+        }
+    }
+
+    SDL_WaitThread(thread, nullptr);
+
+    EXPECT_EQ(queue.IsEmpty(), true);
+};
+
+TEST(NetPacketQueueTest, BacklogGrowth) {
+    NetPacketQueue queue(4);
+    NetPacket packet;
+    uint32_t value;
+    uint32_t expected{0};
+
+    /* interleave pushes and pops so that the backlog wraps around before it has to grow */
+    for (uint32_t i = 0; i < 200; ++i) {
+        packet << i;
+        EXPECT_EQ(queue.Push(packet), true);
+
+        if (i % 3 == 0) {
+            EXPECT_EQ(queue.Pop(packet), true);
+            packet >> value;
+            EXPECT_EQ(value, expected++);
+            packet.Reset();
+        }
+    }
+
+    while (expected < 200) {
+        queue.Flush();
+
+        ASSERT_EQ(queue.Pop(packet), true);
+        packet >> value;
+        EXPECT_EQ(value, expected++);
+        packet.Reset();
+    }
+
+    EXPECT_EQ(queue.Flush(), true);
+    EXPECT_EQ(queue.IsEmpty(), true);
+};
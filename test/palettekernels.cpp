@@ -0,0 +1,74 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "palettekernels.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <cstring>
+
+#define PALETTE_KERNELS_TEST_SIZE (640 + 13)
+
+class PaletteKernelsTest : public ::testing::Test {
+protected:
+    uint32_t colors[256];
+    uint8_t source[PALETTE_KERNELS_TEST_SIZE];
+    uint32_t expected[PALETTE_KERNELS_TEST_SIZE];
+    uint32_t target[PALETTE_KERNELS_TEST_SIZE];
+
+    void SetUp() override {
+        srand(1);
+
+        for (int32_t i = 0; i < 256; ++i) {
+            colors[i] = (static_cast<uint32_t>(rand()) << 16) ^ static_cast<uint32_t>(rand());
+        }
+
+        for (int32_t i = 0; i < PALETTE_KERNELS_TEST_SIZE; ++i) {
+            source[i] = rand() % 256;
+            expected[i] = colors[source[i]];
+        }
+    }
+
+    void TearDown() override { PaletteKernels_SetInstructionSet(PALETTE_KERNELS_AVX2); }
+};
+
+TEST_F(PaletteKernelsTest, ExpandSpan) {
+    for (uint8_t instruction_set = PALETTE_KERNELS_SCALAR; instruction_set <= PALETTE_KERNELS_AVX2;
+         ++instruction_set) {
+        PaletteKernels_SetInstructionSet(instruction_set);
+
+        const char* name = PaletteKernels_GetInstructionSetName(PaletteKernels_GetInstructionSet());
+
+        for (size_t count = 0; count < 40; ++count) {
+            memset(target, 0, sizeof(target));
+
+            PaletteKernels_ExpandSpan(&target[3], &source[3], count, colors);
+
+            EXPECT_EQ(memcmp(&target[3], &expected[3], count * sizeof(uint32_t)), 0) << name << " " << count;
+            EXPECT_EQ(target[3 + count], 0u) << name << " " << count;
+        }
+
+        PaletteKernels_ExpandSpan(target, source, PALETTE_KERNELS_TEST_SIZE, colors);
+
+        EXPECT_EQ(memcmp(target, expected, sizeof(target)), 0) << name;
+    }
+}
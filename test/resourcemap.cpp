@@ -0,0 +1,117 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "resourcemap.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+static FILE* ResourceMapTest_CreateFile(size_t size) {
+    FILE* fp = tmpfile();
+
+    if (fp) {
+        for (size_t i = 0; i < size; ++i) {
+            fputc(static_cast<uint8_t>(i * 7), fp);
+        }
+
+        fflush(fp);
+    }
+
+    return fp;
+}
+
+TEST(ResourceMapTest, Open) {
+    ResourceMap map;
+    FILE* empty_file = tmpfile();
+
+    ASSERT_NE(empty_file, nullptr);
+
+    EXPECT_FALSE(map.Open(nullptr));
+    EXPECT_FALSE(map.Open(empty_file));
+    EXPECT_FALSE(map.IsMapped());
+    EXPECT_EQ(map.GetData(0, 0), nullptr);
+
+    FILE* fp = ResourceMapTest_CreateFile(10000);
+
+    ASSERT_NE(fp, nullptr);
+    ASSERT_TRUE(map.Open(fp));
+    EXPECT_EQ(map.GetSize(), 10000u);
+
+    map.Close();
+
+    EXPECT_FALSE(map.IsMapped());
+
+    fclose(fp);
+    fclose(empty_file);
+};
+
+TEST(ResourceMapTest, GetData) {
+    ResourceMap map;
+    FILE* fp = ResourceMapTest_CreateFile(10000);
+
+    ASSERT_NE(fp, nullptr);
+    ASSERT_TRUE(map.Open(fp));
+
+    const uint8_t* data = map.GetData(5000, 100);
+
+    ASSERT_NE(data, nullptr);
+
+    for (int32_t i = 0; i < 100; ++i) {
+        EXPECT_EQ(data[i], static_cast<uint8_t>((5000 + i) * 7));
+    }
+
+    EXPECT_EQ(map.GetData(0, 10000), map.GetData(0, 0));
+    EXPECT_EQ(map.GetData(9999, 2), nullptr);
+    EXPECT_EQ(map.GetData(-1, 2), nullptr);
+    EXPECT_EQ(map.GetData(0, -1), nullptr);
+
+    map.Close();
+    fclose(fp);
+};
+
+TEST(ResourceMapTest, CopyOnWrite) {
+    ResourceMap map;
+    FILE* fp = ResourceMapTest_CreateFile(10000);
+    uint8_t buffer[100];
+
+    ASSERT_NE(fp, nullptr);
+    ASSERT_TRUE(map.Open(fp));
+
+    uint8_t* data = map.GetData(100, 100);
+
+    ASSERT_NE(data, nullptr);
+
+    memset(data, 0xFF, 100);
+
+    EXPECT_EQ(map.GetData(100, 100)[50], 0xFF);
+
+    fseek(fp, 100, SEEK_SET);
+    ASSERT_EQ(fread(buffer, sizeof(buffer), 1, fp), 1);
+    EXPECT_EQ(buffer[50], static_cast<uint8_t>(150 * 7));
+
+    ASSERT_TRUE(map.Reset());
+
+    EXPECT_EQ(map.GetData(100, 100)[50], static_cast<uint8_t>(150 * 7));
+
+    map.Close();
+    fclose(fp);
+};
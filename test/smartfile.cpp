@@ -154,3 +154,202 @@ TEST_F(SmartFileTest, ReadWrite) {
 
     EXPECT_EQ(object_readback == object_readback_copy, true);
 }
+
+TEST_F(SmartFileTest, LargeFile) {
+    SmartFileWriter writer;
+    EXPECT_EQ(writer.Open(file_path.c_str()), true);
+
+    for (uint32_t i = 0; i < 100000; ++i) {
+        EXPECT_EQ(writer.Write(i), true);
+    }
+
+    EXPECT_EQ(writer.Close(), true);
+    EXPECT_EQ(writer.Write(UINT32_C(0)), false);
+
+    SmartFileReader reader;
+    EXPECT_EQ(reader.Open(file_path.c_str()), true);
+
+    for (uint32_t i = 0; i < 100000; ++i) {
+        uint32_t value{0};
+
+        EXPECT_EQ(reader.Read(value), true);
+        EXPECT_EQ(value, i);
+    }
+
+    uint16_t value{0};
+    EXPECT_EQ(reader.Read(value), false);
+    EXPECT_EQ(reader.Close(), true);
+    EXPECT_EQ(reader.Close(), false);
+}
+
+TEST_F(SmartFileTest, MemoryWriter) {
+    SmartPointer<TestSmartFileObject> object = dynamic_cast<TestSmartFileObject*>(TestSmartFileObject::Allocate());
+    SmartFileImage image;
+
+    object->SetInt32(INT32_MIN);
+
+    SmartFileWriter writer;
+    EXPECT_EQ(writer.ReleaseBuffer(image), false);
+    EXPECT_EQ(writer.OpenMemory(), true);
+    EXPECT_EQ(writer.ReleaseBuffer(image), false);
+    EXPECT_EQ(writer.Write(UINT32_C(123456)), true);
+    writer.WriteObject(object.Get());
+    EXPECT_EQ(writer.ReleaseBuffer(image), true);
+    EXPECT_EQ(writer.Close(), true);
+    EXPECT_EQ(object->GetIndex(), 0);
+
+    ASSERT_EQ(image.Pack(), true);
+    ASSERT_NE(image.GetData(), nullptr);
+    EXPECT_GT(image.GetSize(), sizeof(uint32_t));
+
+    FILE* fp = fopen(file_path.c_str(), "wb");
+    ASSERT_NE(fp, nullptr);
+    EXPECT_EQ(fwrite(image.GetData(), image.GetSize(), 1, fp), 1u);
+    fclose(fp);
+
+    uint32_t integer{0};
+
+    SmartFileReader reader;
+    EXPECT_EQ(reader.Open(file_path.c_str()), true);
+    EXPECT_EQ(reader.Read(integer), true);
+    SmartPointer<TestSmartFileObject> object_readback = dynamic_cast<TestSmartFileObject*>(reader.ReadObject());
+    EXPECT_EQ(reader.Close(), true);
+
+    EXPECT_EQ(integer, 123456);
+    EXPECT_EQ(object_readback->GetInt32(), INT32_MIN);
+}
+
+TEST_F(SmartFileTest, Sections) {
+    uint32_t value{0};
+
+    SmartFileWriter writer;
+    EXPECT_EQ(writer.Open(file_path.c_str()), true);
+    EXPECT_EQ(writer.GetFormat(), SmartFileFormat::V72);
+    EXPECT_EQ(writer.Write(UINT32_C(1)), true);
+    writer.BeginSection(1);
+
+    for (uint32_t i = 0; i < 10000; ++i) {
+        EXPECT_EQ(writer.Write(i % 16), true);
+    }
+
+    writer.BeginSection(2);
+    EXPECT_EQ(writer.Write(UINT32_C(3)), true);
+    EXPECT_EQ(writer.Close(), true);
+
+    SmartFileReader header;
+    EXPECT_EQ(header.Open(file_path.c_str(), 1), true);
+    EXPECT_EQ(header.GetFormat(), SmartFileFormat::V72);
+    EXPECT_EQ(header.Read(value), true);
+    EXPECT_EQ(value, 1u);
+    EXPECT_EQ(header.Read(value), false);
+    EXPECT_EQ(header.Close(), true);
+
+    SmartFileReader reader;
+    EXPECT_EQ(reader.Open(file_path.c_str()), true);
+    EXPECT_EQ(reader.Read(value), true);
+    EXPECT_EQ(value, 1u);
+
+    for (uint32_t i = 0; i < 10000; ++i) {
+        EXPECT_EQ(reader.Read(value), true);
+        EXPECT_EQ(value, i % 16);
+    }
+
+    EXPECT_EQ(reader.Read(value), true);
+    EXPECT_EQ(value, 3u);
+    EXPECT_EQ(reader.Read(value), false);
+    EXPECT_EQ(reader.Close(), true);
+
+    FILE* fp = fopen(file_path.c_str(), "rb");
+    ASSERT_NE(fp, nullptr);
+    fseek(fp, 0, SEEK_END);
+    EXPECT_LT(ftell(fp), 10000);
+    fclose(fp);
+}
+
+TEST_F(SmartFileTest, MemoryWriterV70) {
+    const uint16_t format{static_cast<uint16_t>(SmartFileFormat::V70)};
+    uint16_t version{0};
+    uint32_t value{0};
+    SmartFileImage image;
+
+    SmartFileWriter writer;
+    EXPECT_EQ(writer.SetFormat(format), true);
+    EXPECT_EQ(writer.OpenMemory(), true);
+    EXPECT_EQ(writer.GetFormat(), SmartFileFormat::V70);
+    EXPECT_EQ(writer.Write(format), true);
+    writer.BeginSection(1);
+
+    for (uint32_t i = 0; i < 1000; ++i) {
+        EXPECT_EQ(writer.Write(i % 16), true);
+    }
+
+    EXPECT_EQ(writer.ReleaseBuffer(image), true);
+    EXPECT_EQ(writer.Close(), true);
+
+    /* sections are ignored, the image is the plain object stream that earlier releases read */
+    ASSERT_EQ(image.Pack(), true);
+    ASSERT_EQ(image.GetSize(), sizeof(format) + 1000 * sizeof(uint32_t));
+    EXPECT_EQ(memcmp(image.GetData(), &format, sizeof(format)), 0);
+
+    FILE* fp = fopen(file_path.c_str(), "wb");
+    ASSERT_NE(fp, nullptr);
+    EXPECT_EQ(fwrite(image.GetData(), image.GetSize(), 1, fp), 1u);
+    fclose(fp);
+
+    SmartFileReader reader;
+    EXPECT_EQ(reader.Open(file_path.c_str()), true);
+    EXPECT_EQ(reader.GetFormat(), SmartFileFormat::V70);
+    EXPECT_EQ(reader.Read(version), true);
+    EXPECT_EQ(version, format);
+
+    for (uint32_t i = 0; i < 1000; ++i) {
+        EXPECT_EQ(reader.Read(value), true);
+        EXPECT_EQ(value, i % 16);
+    }
+
+    EXPECT_EQ(reader.Read(value), false);
+    EXPECT_EQ(reader.Close(), true);
+}
+
+TEST_F(SmartFileTest, DamagedSectionTable) {
+    const uint16_t format{static_cast<uint16_t>(SmartFileFormat::V72)};
+    const uint16_t section_count{1};
+    const size_t header_size{sizeof(format) + sizeof(section_count) + sizeof(SmartFileSection)};
+    const uint32_t payload{UINT32_C(7)};
+    SmartFileSection section{0, header_size, sizeof(payload), sizeof(payload)};
+    uint32_t value{0};
+
+    auto write_file = [&]() {
+        FILE* fp = fopen(file_path.c_str(), "wb");
+        ASSERT_NE(fp, nullptr);
+        fwrite(&format, sizeof(format), 1, fp);
+        fwrite(&section_count, sizeof(section_count), 1, fp);
+        fwrite(&section, sizeof(section), 1, fp);
+        fwrite(&payload, sizeof(payload), 1, fp);
+        fclose(fp);
+    };
+
+    SmartFileReader reader;
+
+    write_file();
+    EXPECT_EQ(reader.Open(file_path.c_str()), true);
+    EXPECT_EQ(reader.Read(value), true);
+    EXPECT_EQ(value, payload);
+
+    /* packed data beyond the end of the file */
+    section.offset = header_size + 1;
+    write_file();
+    EXPECT_EQ(reader.Open(file_path.c_str()), false);
+
+    /* decompressed size that the packed bytes cannot produce */
+    section.offset = header_size;
+    section.size = UINT32_MAX;
+    write_file();
+    EXPECT_EQ(reader.Open(file_path.c_str()), false);
+
+    /* offset inside the section table */
+    section.size = sizeof(payload);
+    section.offset = 0;
+    write_file();
+    EXPECT_EQ(reader.Open(file_path.c_str()), false);
+}
@@ -209,6 +209,42 @@ TEST_F(SmartListTest, IteratorAssign) {
     EXPECT_EQ(list2.GetCount(), 6);
 }
 
+TEST_F(SmartListTest, IteratorMove) {
+    SmartList<TestObject>::Iterator it1 = list1.Begin();
+    SmartList<TestObject>::Iterator it2(std::move(it1));
+
+    EXPECT_EQ(it1.Get(), nullptr);
+    EXPECT_EQ((*it2).Get(), 2);
+
+    ++it2;
+
+    it1 = std::move(it2);
+
+    EXPECT_EQ(it2.Get(), nullptr);
+    EXPECT_EQ((*it1).Get(), 5);
+
+    it2 = it1;
+
+    EXPECT_EQ(it1, it2);
+    EXPECT_EQ((*it2).Get(), 5);
+}
+
+TEST_F(SmartListTest, IteratorCopyEmpty) {
+    SmartList<TestObject>::Iterator it1;
+    SmartList<TestObject>::Iterator it2(it1);
+
+    EXPECT_EQ(it2.Get(), nullptr);
+
+    it1 = list1.Begin();
+    it2 = std::move(it1);
+
+    const SmartList<TestObject>::Iterator& moved = it1;
+    SmartList<TestObject>::Iterator it3(moved);
+
+    EXPECT_EQ(it3.Get(), nullptr);
+    EXPECT_EQ((*it2).Get(), 2);
+}
+
 TEST_F(SmartListTest, IteratorRemoveAll) {
     SmartList<TestObject> list2;
 
@@ -345,3 +381,107 @@ TEST_F(SmartListTest, IteratorMisuse) {
     EXPECT_EQ(list1[4].Get(), 2);
     EXPECT_EQ(list1[5].Get(), 3);
 }
+
+TEST_F(SmartListTest, NodePoolReuse) {
+    void* node1 = SmartListNodePool<48>::Allocate();
+    void* node2 = SmartListNodePool<48>::Allocate();
+
+    ASSERT_NE(node1, nullptr);
+    ASSERT_NE(node2, nullptr);
+    EXPECT_NE(node1, node2);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(node1) % alignof(std::max_align_t), 0);
+
+    SmartListNodePool<48>::Free(node2);
+
+    EXPECT_EQ(SmartListNodePool<48>::Allocate(), node2);
+
+    SmartListNodePool<48>::Free(node2);
+    SmartListNodePool<48>::Free(node1);
+}
+
+TEST_F(SmartListTest, RemoveWhileIterating) {
+    SmartList<TestObject> list2;
+    uint32_t status{TEST_CLASS_UNDEFINED};
+
+    // later cycles allocate their nodes from the slots that the previous cycle returned to the pool
+    for (int32_t cycle = 0; cycle < 4; ++cycle) {
+        for (int32_t i = 0; i < 1000; ++i) {
+            TestObject* to = new (std::nothrow) TestObject(cycle ? nullptr : &status);
+
+            to->Set(i);
+            list2.PushBack(*to);
+        }
+
+        EXPECT_EQ(list2.GetCount(), 1000);
+
+        // the list pins the removed node for the iterator, which keeps its links valid until the iterator advances
+        for (auto it = list2.Begin(), end = list2.End(); it != end; ++it) {
+            if ((*it).Get() % 2) {
+                list2.Remove(*it);
+            }
+        }
+
+        EXPECT_EQ(list2.GetCount(), 500);
+
+        int32_t index = 0;
+
+        for (auto it = list2.Begin(); it != list2.End(); ++it, index += 2) {
+            EXPECT_EQ((*it).Get(), index);
+        }
+
+        list2.Clear();
+    }
+
+    EXPECT_EQ(status, TEST_CLASS_DESTRUCTED);
+}
+
+TEST_F(SmartListTest, RemoveAheadWhileIterating) {
+    auto it = list1.Begin();
+
+    ++it;
+
+    // both the current node and its successor are unlinked, the iterator has to walk through the removed nodes
+    list1.Remove(*to5);
+    list1.Remove(*to4);
+
+    EXPECT_EQ(list1.GetCount(), 4);
+    EXPECT_EQ((*it).Get(), 5);
+
+    ++it;
+
+    EXPECT_EQ((*it).Get(), 4);
+
+    ++it;
+
+    EXPECT_EQ((*it).Get(), 1);
+
+    --it;
+
+    EXPECT_EQ((*it).Get(), 2);
+    EXPECT_EQ(list1[0].Get(), 2);
+    EXPECT_EQ(list1[1].Get(), 1);
+};
+
+TEST_F(SmartListTest, IteratorOutlivesList) {
+    uint32_t status{TEST_CLASS_UNDEFINED};
+    SmartList<TestObject>::Iterator it;
+
+    {
+        SmartList<TestObject> list2;
+        TestObject* to = new (std::nothrow) TestObject(&status);
+
+        to->Set(7);
+        list2.PushBack(*to);
+        list2.PushBack(*to1);
+
+        it = list2.Begin();
+    }
+
+    EXPECT_EQ(status, TEST_CLASS_CONSTRUCTED);
+    EXPECT_EQ((*it).Get(), 7);
+
+    ++it;
+
+    EXPECT_EQ(status, TEST_CLASS_DESTRUCTED);
+    EXPECT_EQ((*it).Get(), 1);
+};
@@ -218,6 +218,31 @@ TEST(SmartObjectArrayTest, CopyCtor) {
     EXPECT_EQ(*array3[1], uint1);
 };
 
+TEST(SmartObjectArrayTest, Move) {
+    SmartObjectArray<uint16_t> array1;
+    const uint16_t uint1{UINT16_MAX};
+
+    array1.PushBack(&uint1);
+
+    SmartObjectArray<uint16_t> array2(std::move(array1));
+
+    EXPECT_EQ(array1.Get(), nullptr);
+    EXPECT_EQ(array2.GetCount(), 1);
+
+    SmartObjectArray<uint16_t> array3;
+
+    array3 = std::move(array2);
+
+    EXPECT_EQ(array2.Get(), nullptr);
+    EXPECT_EQ(array3.GetCount(), 1);
+    EXPECT_EQ(*array3[0], uint1);
+
+    array1 = array3;
+    array1.Clear();
+
+    EXPECT_EQ(array3.GetCount(), 0);
+}
+
 TEST(SmartObjectArrayTest, MixedUse) {
     SmartObjectArray<int16_t> array;
 
@@ -96,6 +96,71 @@ TEST(SmartPointer, Shared) {
     EXPECT_EQ(status, TEST_CLASS_DESTRUCTED);
 }
 
+TEST(SmartPointer, Move) {
+    uint32_t status{TEST_CLASS_UNDEFINED};
+    TestObject* obj = new (std::nothrow) TestObject(&status);
+    SmartPointer<TestObject> sp1(obj);
+    SmartPointer<TestObject> sp2(std::move(sp1));
+
+    EXPECT_EQ(sp1.Get(), nullptr);
+    EXPECT_EQ(sp2.Get(), obj);
+
+    SmartPointer<TestObject> sp3;
+
+    sp3 = std::move(sp2);
+
+    EXPECT_EQ(sp2.Get(), nullptr);
+    EXPECT_EQ(sp3.Get(), obj);
+
+    SmartPointer<TestObject>& sp4 = sp3;
+
+    sp3 = std::move(sp4);
+
+    EXPECT_EQ(sp3.Get(), obj);
+    EXPECT_EQ(status, TEST_CLASS_CONSTRUCTED);
+
+    sp3 = SmartPointer<TestObject>();
+
+    EXPECT_EQ(status, TEST_CLASS_DESTRUCTED);
+}
+
+TEST(SmartPointer, MoveReleasesTarget) {
+    uint32_t status1{TEST_CLASS_UNDEFINED};
+    uint32_t status2{TEST_CLASS_UNDEFINED};
+    SmartPointer<TestObject> sp1(new (std::nothrow) TestObject(&status1));
+    SmartPointer<TestObject> sp2(new (std::nothrow) TestObject(&status2));
+
+    sp1 = std::move(sp2);
+
+    EXPECT_EQ(status1, TEST_CLASS_DESTRUCTED);
+    EXPECT_EQ(status2, TEST_CLASS_CONSTRUCTED);
+    EXPECT_EQ(sp2.Get(), nullptr);
+
+    sp1 = nullptr;
+
+    EXPECT_EQ(status2, TEST_CLASS_DESTRUCTED);
+}
+
+TEST(SmartPointer, ReleaseAdopt) {
+    uint32_t status{TEST_CLASS_UNDEFINED};
+    SmartPointer<TestObject> sp1(new (std::nothrow) TestObject(&status));
+    TestObject* obj = sp1.Release();
+
+    EXPECT_EQ(sp1.Get(), nullptr);
+    EXPECT_EQ(status, TEST_CLASS_CONSTRUCTED);
+
+    {
+        SmartPointer<TestObject> sp2;
+
+        sp2.Adopt(obj);
+
+        EXPECT_EQ(sp2.Get(), obj);
+        EXPECT_EQ(status, TEST_CLASS_CONSTRUCTED);
+    }
+
+    EXPECT_EQ(status, TEST_CLASS_DESTRUCTED);
+}
+
 TEST(SmartPointer, Compare) {
     TestObject* obj1 = new (std::nothrow) TestObject();
     TestObject* obj2 = new (std::nothrow) TestObject();
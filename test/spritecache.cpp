@@ -0,0 +1,98 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "spritecache.hpp"
+
+#include <gtest/gtest.h>
+
+static const uint8_t SpriteCacheTest_Frames[4] = {};
+
+static SpriteCacheKey SpriteCacheTest_GetKey(int32_t frame, uint16_t width, uint16_t height) {
+    return {&SpriteCacheTest_Frames[frame], nullptr, width, height, 0, 0};
+}
+
+TEST(SpriteCacheTest, FindAndInsert) {
+    SpriteCache cache;
+    const uint8_t pixels[3 * 2] = {1, 2, 3, 4, 5, 6};
+    const SpriteSpan spans[] = {{1, 2}, {3, 1}, {5, 1}};
+
+    EXPECT_EQ(cache.Find(SpriteCacheTest_GetKey(0, 3, 2)), nullptr);
+
+    const SpriteCacheEntry* entry = cache.Insert(SpriteCacheTest_GetKey(0, 3, 2), pixels, spans, 3);
+
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(cache.Find(SpriteCacheTest_GetKey(0, 3, 2)), entry);
+    EXPECT_EQ(cache.Find(SpriteCacheTest_GetKey(0, 3, 3)), nullptr);
+    EXPECT_EQ(cache.Find(SpriteCacheTest_GetKey(1, 3, 2)), nullptr);
+    EXPECT_EQ(cache.GetEntryCount(), 1);
+
+    EXPECT_EQ(entry->pixels[5], 6);
+    EXPECT_EQ(entry->span_count, 3u);
+    EXPECT_EQ(entry->row_spans[0], 0u);
+    EXPECT_EQ(entry->row_spans[1], 1u);
+    EXPECT_EQ(entry->row_spans[2], 3u);
+
+    const SpriteCacheEntry* shadow = cache.Insert(SpriteCacheTest_GetKey(1, 3, 2), nullptr, spans, 3);
+
+    ASSERT_NE(shadow, nullptr);
+    EXPECT_EQ(shadow->pixels, nullptr);
+
+    cache.Clear();
+
+    EXPECT_EQ(cache.Find(SpriteCacheTest_GetKey(0, 3, 2)), nullptr);
+    EXPECT_EQ(cache.GetEntryCount(), 0);
+    EXPECT_EQ(cache.GetMemoryUsage(), 0u);
+};
+
+TEST(SpriteCacheTest, MemoryLimit) {
+    uint8_t pixels[32 * 32] = {};
+    const SpriteSpan span = {0, 16};
+    SpriteCache reference;
+    const SpriteCacheEntry* sprite = reference.Insert(SpriteCacheTest_GetKey(0, 16, 16), pixels, &span, 1);
+    const SpriteCacheEntry* shadow = reference.Insert(SpriteCacheTest_GetKey(1, 16, 16), nullptr, &span, 1);
+    const SpriteCacheEntry* large = reference.Insert(SpriteCacheTest_GetKey(2, 32, 32), pixels, &span, 1);
+
+    ASSERT_NE(sprite, nullptr);
+    ASSERT_NE(shadow, nullptr);
+    ASSERT_NE(large, nullptr);
+
+    /* shadows only hold spans, every entry is accounted with its full size */
+    EXPECT_EQ(sprite->size - shadow->size, 16u * 16u);
+    EXPECT_EQ(reference.GetMemoryUsage(), sprite->size + shadow->size + large->size);
+
+    SpriteCache cache(sprite->size * 3);
+
+    EXPECT_EQ(cache.Insert(SpriteCacheTest_GetKey(0, 64, 64), pixels, &span, 1), nullptr);
+    EXPECT_EQ(cache.GetMemoryUsage(), 0u);
+
+    for (int32_t frame = 0; frame < 3; ++frame) {
+        EXPECT_NE(cache.Insert(SpriteCacheTest_GetKey(frame, 16, 16), pixels, &span, 1), nullptr);
+    }
+
+    EXPECT_EQ(cache.GetMemoryUsage(), sprite->size * 3);
+
+    /* a large frame evicts as many entries as needed to fit */
+    ASSERT_LE(large->size, sprite->size * 3);
+    ASSERT_GT(large->size, sprite->size * 2);
+    EXPECT_NE(cache.Insert(SpriteCacheTest_GetKey(3, 32, 32), pixels, &span, 1), nullptr);
+    EXPECT_EQ(cache.GetEntryCount(), 1);
+    EXPECT_EQ(cache.GetMemoryUsage(), large->size);
+};
@@ -0,0 +1,164 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "survey.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+
+#include "access.hpp"
+#include "resource_manager.hpp"
+#include "units_manager.hpp"
+
+class SurveyTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        saved_map_size = ResourceManager_MapSize;
+        saved_surface_map = ResourceManager_MapSurfaceMap;
+        saved_cargo_map = ResourceManager_CargoMap;
+        saved_team_units = UnitsManager_TeamInfo[PLAYER_TEAM_RED].team_units;
+
+        team_units.hash_team_id = HASH_TEAM_RED;
+        UnitsManager_TeamInfo[PLAYER_TEAM_RED].team_units = &team_units;
+
+        srand(1);
+    }
+
+    void TearDown() override {
+        Survey_FreeResourceTables();
+
+        delete[] ResourceManager_MapSurfaceMap;
+        delete[] ResourceManager_CargoMap;
+
+        ResourceManager_MapSize = saved_map_size;
+        ResourceManager_MapSurfaceMap = saved_surface_map;
+        ResourceManager_CargoMap = saved_cargo_map;
+        UnitsManager_TeamInfo[PLAYER_TEAM_RED].team_units = saved_team_units;
+    }
+
+    void CreateMap(int32_t width, int32_t height) {
+        delete[] ResourceManager_MapSurfaceMap;
+        delete[] ResourceManager_CargoMap;
+
+        ResourceManager_MapSize = Point(width, height);
+        ResourceManager_MapSurfaceMap = new (std::nothrow) uint8_t[width * height];
+        ResourceManager_CargoMap = new (std::nothrow) uint16_t[width * height];
+
+        for (int32_t i = 0; i < width * height; ++i) {
+            ResourceManager_MapSurfaceMap[i] = (rand() % 8) ? SURFACE_TYPE_LAND : SURFACE_TYPE_AIR;
+            ResourceManager_CargoMap[i] = CreateCargo();
+        }
+    }
+
+    static uint16_t CreateCargo() {
+        static const uint16_t types[] = {CARGO_MATERIALS, CARGO_GOLD, CARGO_FUEL};
+        uint16_t value = types[rand() % 3] | (rand() % 32);
+
+        if (rand() % 2) {
+            value |= HASH_TEAM_RED;
+        }
+
+        return value;
+    }
+
+    /* the tile by tile scan that the summed-area tables replaced */
+    static void ScanArea(int32_t grid_x, int32_t grid_y, int32_t radius, int32_t resource_limit, int16_t* raw,
+                         int16_t* gold, int16_t* fuel, bool mode) {
+        const uint16_t mask = mode ? 0xFFFF : HASH_TEAM_RED;
+
+        *raw = 0;
+        *gold = 0;
+        *fuel = 0;
+
+        for (int32_t i = grid_x; i <= std::min(ResourceManager_MapSize.x - 1, grid_x + radius); ++i) {
+            for (int32_t j = grid_y; j <= std::min(ResourceManager_MapSize.y - 1, grid_y + radius); ++j) {
+                const uint16_t value = ResourceManager_CargoMap[ResourceManager_MapSize.x * j + i];
+
+                if ((value & mask) && Access_GetSurfaceType(i, j) != SURFACE_TYPE_AIR) {
+                    if (value & CARGO_GOLD) {
+                        *gold += std::min(value & CARGO_MASK, 16);
+
+                    } else if (value & CARGO_FUEL) {
+                        *fuel += std::min(value & CARGO_MASK, 16);
+
+                    } else {
+                        *raw += std::min(value & CARGO_MASK, 16);
+                    }
+                }
+            }
+        }
+
+        *raw = std::min<int16_t>(*raw, resource_limit);
+        *gold = std::min<int16_t>(*gold, resource_limit);
+        *fuel = std::min<int16_t>(*fuel, resource_limit);
+    }
+
+    static void CompareQueries(int32_t count) {
+        for (int32_t i = 0; i < count; ++i) {
+            const int32_t grid_x = rand() % ResourceManager_MapSize.x;
+            const int32_t grid_y = rand() % ResourceManager_MapSize.y;
+            const int32_t radius = rand() % 12;
+            const int32_t resource_limit = (rand() % 2) ? 255 : rand() % 64;
+            const bool mode = rand() % 2;
+            int16_t raw[2];
+            int16_t gold[2];
+            int16_t fuel[2];
+
+            Survey_GetResourcesInArea(grid_x, grid_y, radius, resource_limit, &raw[0], &gold[0], &fuel[0], mode,
+                                      PLAYER_TEAM_RED);
+            ScanArea(grid_x, grid_y, radius, resource_limit, &raw[1], &gold[1], &fuel[1], mode);
+
+            ASSERT_EQ(raw[0], raw[1]) << grid_x << ", " << grid_y << ", " << radius;
+            ASSERT_EQ(gold[0], gold[1]) << grid_x << ", " << grid_y << ", " << radius;
+            ASSERT_EQ(fuel[0], fuel[1]) << grid_x << ", " << grid_y << ", " << radius;
+        }
+    }
+
+    TeamUnits team_units;
+
+private:
+    Point saved_map_size;
+    uint8_t* saved_surface_map;
+    uint16_t* saved_cargo_map;
+    TeamUnits* saved_team_units;
+};
+
+TEST_F(SurveyTest, MatchesScan) {
+    CreateMap(37, 29);
+    CompareQueries(30000);
+
+    /* a new map with a different size replaces the tables */
+    CreateMap(64, 48);
+    CompareQueries(30000);
+};
+
+TEST_F(SurveyTest, Invalidate) {
+    CreateMap(32, 32);
+    CompareQueries(1000);
+
+    for (int32_t i = 0; i < 200; ++i) {
+        ResourceManager_CargoMap[rand() % (32 * 32)] = CreateCargo();
+    }
+
+    Survey_InvalidateResourceTables();
+    CompareQueries(1000);
+};
@@ -0,0 +1,134 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "threatkernels.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <cstring>
+
+#define THREAT_KERNELS_TEST_SIZE (112 * 112 + 5)
+
+class ThreatKernelsTest : public ::testing::Test {
+protected:
+    int16_t source_damage[THREAT_KERNELS_TEST_SIZE];
+    int16_t source_shots[THREAT_KERNELS_TEST_SIZE];
+    int16_t expected_damage[THREAT_KERNELS_TEST_SIZE];
+    int16_t expected_shots[THREAT_KERNELS_TEST_SIZE];
+    int16_t damage[THREAT_KERNELS_TEST_SIZE];
+    int16_t shots[THREAT_KERNELS_TEST_SIZE];
+
+    void SetUp() override {
+        srand(1);
+
+        for (int32_t i = 0; i < THREAT_KERNELS_TEST_SIZE; ++i) {
+            source_damage[i] = rand() % 4000 - 2000;
+            source_shots[i] = rand() % 40;
+        }
+
+        memcpy(expected_damage, source_damage, sizeof(expected_damage));
+        memcpy(expected_shots, source_shots, sizeof(expected_shots));
+    }
+
+    void TearDown() override { ThreatKernels_SetInstructionSet(THREAT_KERNELS_AVX2); }
+
+    void Reset(uint8_t instruction_set) {
+        ThreatKernels_SetInstructionSet(instruction_set);
+
+        memcpy(damage, source_damage, sizeof(damage));
+        memcpy(shots, source_shots, sizeof(shots));
+    }
+
+    void Verify() {
+        const char* name = ThreatKernels_GetInstructionSetName(ThreatKernels_GetInstructionSet());
+
+        EXPECT_EQ(memcmp(damage, expected_damage, sizeof(damage)), 0) << name;
+        EXPECT_EQ(memcmp(shots, expected_shots, sizeof(shots)), 0) << name;
+    }
+};
+
+TEST_F(ThreatKernelsTest, AddSpan) {
+    for (int32_t i = 3; i < THREAT_KERNELS_TEST_SIZE - 7; ++i) {
+        expected_damage[i] += 40000;
+    }
+
+    for (uint8_t instruction_set = THREAT_KERNELS_SCALAR; instruction_set <= THREAT_KERNELS_AVX2; ++instruction_set) {
+        Reset(instruction_set);
+        ThreatKernels_AddSpan(&damage[3], THREAT_KERNELS_TEST_SIZE - 10, 40000, false);
+        Verify();
+    }
+};
+
+TEST_F(ThreatKernelsTest, AddSpanNormalized) {
+    for (int32_t i = 3; i < THREAT_KERNELS_TEST_SIZE - 7; ++i) {
+        if (expected_damage[i] < 0) {
+            expected_damage[i] = 0;
+        }
+
+        expected_damage[i] += 35;
+    }
+
+    for (uint8_t instruction_set = THREAT_KERNELS_SCALAR; instruction_set <= THREAT_KERNELS_AVX2; ++instruction_set) {
+        Reset(instruction_set);
+        ThreatKernels_AddSpan(&damage[3], THREAT_KERNELS_TEST_SIZE - 10, 35, true);
+        Verify();
+    }
+};
+
+TEST_F(ThreatKernelsTest, NormalizeSpan) {
+    for (int32_t i = 0; i < THREAT_KERNELS_TEST_SIZE; ++i) {
+        if (expected_damage[i] < 0) {
+            expected_damage[i] = 0;
+            expected_shots[i] = 0;
+        }
+    }
+
+    for (uint8_t instruction_set = THREAT_KERNELS_SCALAR; instruction_set <= THREAT_KERNELS_AVX2; ++instruction_set) {
+        Reset(instruction_set);
+        ThreatKernels_NormalizeSpan(damage, shots, THREAT_KERNELS_TEST_SIZE);
+        Verify();
+    }
+};
+
+TEST_F(ThreatKernelsTest, RebaseSpan) {
+    for (int32_t i = 0; i < THREAT_KERNELS_TEST_SIZE; ++i) {
+        expected_damage[i] += expected_shots[i] * -57;
+    }
+
+    for (uint8_t instruction_set = THREAT_KERNELS_SCALAR; instruction_set <= THREAT_KERNELS_AVX2; ++instruction_set) {
+        Reset(instruction_set);
+        ThreatKernels_RebaseSpan(damage, shots, THREAT_KERNELS_TEST_SIZE, -57);
+        Verify();
+    }
+};
+
+TEST_F(ThreatKernelsTest, SumSpan) {
+    for (int32_t i = 0; i < THREAT_KERNELS_TEST_SIZE; ++i) {
+        expected_damage[i] += expected_shots[i];
+    }
+
+    for (uint8_t instruction_set = THREAT_KERNELS_SCALAR; instruction_set <= THREAT_KERNELS_AVX2; ++instruction_set) {
+        Reset(instruction_set);
+        ThreatKernels_SumSpan(damage, shots, THREAT_KERNELS_TEST_SIZE);
+        Verify();
+    }
+};
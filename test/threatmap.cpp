@@ -0,0 +1,257 @@
+/* Copyright (c) 2022 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "threatmap.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#include "access.hpp"
+#include "resource_manager.hpp"
+
+#define THREAT_MAP_TEST_UNITS 16
+
+class ThreatMapTest : public ::testing::Test {
+protected:
+    SmartPointer<UnitInfo> units[THREAT_MAP_TEST_UNITS];
+    ThreatContribution expected[THREAT_MAP_TEST_UNITS];
+    bool is_alive[THREAT_MAP_TEST_UNITS];
+    ThreatMap threat_map;
+
+    void SetUp() override {
+        saved_map_size = ResourceManager_MapSize;
+        saved_surface_map = ResourceManager_MapSurfaceMap;
+
+        ResourceManager_MapSize = Point(40, 36);
+        ResourceManager_MapSurfaceMap = new (std::nothrow) uint8_t[40 * 36];
+
+        srand(1);
+
+        for (int32_t i = 0; i < 40 * 36; ++i) {
+            ResourceManager_MapSurfaceMap[i] = (rand() % 3) ? SURFACE_TYPE_LAND : SURFACE_TYPE_WATER;
+        }
+
+        for (int32_t i = 0; i < THREAT_MAP_TEST_UNITS; ++i) {
+            units[i] = new (std::nothrow) UnitInfo();
+            is_alive[i] = false;
+        }
+
+        threat_map.InitIncremental();
+        threat_map.is_dirty = false;
+    }
+
+    void TearDown() override {
+        threat_map.Reset();
+
+        delete[] ResourceManager_MapSurfaceMap;
+
+        ResourceManager_MapSize = saved_map_size;
+        ResourceManager_MapSurfaceMap = saved_surface_map;
+    }
+
+    void Spawn(int32_t index) {
+        ThreatContribution* contribution = &expected[index];
+
+        /* padding is cleared as well since contributions are compared as a whole */
+        memset(static_cast<void*>(contribution), 0, sizeof(*contribution));
+
+        contribution->unit = &*units[index];
+        contribution->position = Point(rand() % ResourceManager_MapSize.x, rand() % ResourceManager_MapSize.y);
+        contribution->shots = rand() % 3 + 1;
+        contribution->damage_potential = (rand() % 20 + 4) * contribution->shots;
+        contribution->range = rand() % 7 + 2;
+        contribution->surface_types = (index % 4) ? 0 : (SURFACE_TYPE_WATER | SURFACE_TYPE_COAST);
+
+        is_alive[index] = true;
+
+        threat_map.UpdateContribution(&*units[index], contribution);
+    }
+
+    void Move(int32_t index) {
+        ThreatContribution* contribution = &expected[index];
+
+        contribution->position.x =
+            std::clamp<int32_t>(contribution->position.x + rand() % 5 - 2, 0, ResourceManager_MapSize.x - 1);
+        contribution->position.y =
+            std::clamp<int32_t>(contribution->position.y + rand() % 5 - 2, 0, ResourceManager_MapSize.y - 1);
+
+        threat_map.MarkUnit(&*units[index]);
+    }
+
+    void Destroy(int32_t index) {
+        is_alive[index] = false;
+
+        threat_map.RemoveContribution(&*units[index]);
+    }
+
+    /* evaluates marked units again in the way AiPlayer::SyncThreatMap() does */
+    void Sync() {
+        for (SmartList<UnitInfo>::Iterator it = threat_map.dirty_units.Begin(); it != threat_map.dirty_units.End();
+             ++it) {
+            for (int32_t i = 0; i < THREAT_MAP_TEST_UNITS; ++i) {
+                if (&*units[i] == &*it) {
+                    threat_map.UpdateContribution(&*it, is_alive[i] ? &expected[i] : nullptr);
+                }
+            }
+        }
+
+        threat_map.dirty_units.Clear();
+    }
+
+    /* full rebuild in the way AiPlayer::DetermineThreats() stamps each unit onto an empty map */
+    void Rebuild(Grid2D<int16_t>& damage_potential_map, Grid2D<int16_t>& shots_map) {
+        damage_potential_map.Init(ResourceManager_MapSize.x, ResourceManager_MapSize.y);
+        shots_map.Init(ResourceManager_MapSize.x, ResourceManager_MapSize.y);
+        damage_potential_map.Clear();
+        shots_map.Clear();
+
+        for (int32_t i = 0; i < THREAT_MAP_TEST_UNITS; ++i) {
+            if (is_alive[i]) {
+                const ThreatContribution* contribution = &expected[i];
+
+                for (int32_t x = 0; x < ResourceManager_MapSize.x; ++x) {
+                    for (int32_t y = 0; y < ResourceManager_MapSize.y; ++y) {
+                        const int32_t dx = x - contribution->position.x;
+                        const int32_t dy = y - contribution->position.y;
+
+                        if (dx * dx + dy * dy <= contribution->range * contribution->range &&
+                            (!contribution->surface_types ||
+                             (ResourceManager_MapSurfaceMap[y * ResourceManager_MapSize.x + x] &
+                              contribution->surface_types))) {
+                            damage_potential_map[x][y] += contribution->damage_potential;
+                            shots_map[x][y] += contribution->shots;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    void Verify() {
+        Grid2D<int16_t> damage_potential_map;
+        Grid2D<int16_t> shots_map;
+        Rect bounds;
+
+        Rebuild(damage_potential_map, shots_map);
+        Sync();
+
+        (void)threat_map.CommitDirtyBounds(&bounds);
+
+        EXPECT_FALSE(threat_map.IsModified());
+
+        /* the finalized maps are only refreshed within the dirty window, so they match if the window was complete */
+        EXPECT_EQ(memcmp(threat_map.raw_damage_potential_map.GetData(), damage_potential_map.GetData(),
+                         damage_potential_map.GetSize() * sizeof(int16_t)),
+                  0);
+        EXPECT_EQ(
+            memcmp(threat_map.raw_shots_map.GetData(), shots_map.GetData(), shots_map.GetSize() * sizeof(int16_t)), 0);
+        EXPECT_EQ(memcmp(threat_map.damage_potential_map.GetData(), damage_potential_map.GetData(),
+                         damage_potential_map.GetSize() * sizeof(int16_t)),
+                  0);
+        EXPECT_EQ(memcmp(threat_map.shots_map.GetData(), shots_map.GetData(), shots_map.GetSize() * sizeof(int16_t)),
+                  0);
+    }
+
+private:
+    Point saved_map_size;
+    uint8_t* saved_surface_map;
+};
+
+TEST_F(ThreatMapTest, MatchesRebuild) {
+    for (int32_t i = 0; i < THREAT_MAP_TEST_UNITS; ++i) {
+        Spawn(i);
+    }
+
+    Verify();
+
+    for (int32_t step = 0; step < 200; ++step) {
+        const int32_t index = rand() % THREAT_MAP_TEST_UNITS;
+
+        if (!is_alive[index]) {
+            Spawn(index);
+
+        } else if (rand() % 4) {
+            Move(index);
+
+        } else {
+            Destroy(index);
+        }
+
+        if (step % 7 == 0) {
+            Verify();
+        }
+    }
+
+    Verify();
+};
+
+TEST_F(ThreatMapTest, DirtyBounds) {
+    Rect bounds;
+
+    Spawn(1);
+
+    ASSERT_TRUE(threat_map.CommitDirtyBounds(&bounds));
+
+    EXPECT_FALSE(threat_map.CommitDirtyBounds(&bounds));
+
+    const ThreatContribution previous = expected[1];
+
+    expected[1].position = Point(20, 18);
+    expected[1].range = 3;
+    threat_map.UpdateContribution(&*units[1], &expected[1]);
+
+    ASSERT_TRUE(threat_map.CommitDirtyBounds(&bounds));
+
+    /* the window covers the withdrawn and the added disc, clipped to the map */
+    EXPECT_EQ(bounds.ulx, std::max(std::min(previous.position.x - previous.range, 17), 0));
+    EXPECT_EQ(bounds.uly, std::max(std::min(previous.position.y - previous.range, 15), 0));
+    EXPECT_EQ(bounds.lrx, std::min(std::max(previous.position.x + previous.range + 1, 24), 40));
+    EXPECT_EQ(bounds.lry, std::min(std::max(previous.position.y + previous.range + 1, 22), 36));
+
+    /* unchanged contributions do not touch the maps */
+    threat_map.UpdateContribution(&*units[1], &expected[1]);
+
+    EXPECT_FALSE(threat_map.CommitDirtyBounds(&bounds));
+};
+
+TEST_F(ThreatMapTest, DirtyUnits) {
+    Spawn(2);
+    Spawn(3);
+
+    threat_map.MarkUnit(&*units[2]);
+    threat_map.MarkUnit(&*units[3]);
+    threat_map.MarkUnit(&*units[2]);
+
+    EXPECT_EQ(threat_map.dirty_units.GetCount(), 2);
+
+    /* destroyed units are withdrawn right away and are not evaluated again */
+    Destroy(2);
+
+    EXPECT_EQ(threat_map.dirty_units.GetCount(), 1);
+    EXPECT_EQ(threat_map.contributions.size(), 1u);
+    EXPECT_TRUE(threat_map.contributions.find(&*units[2]) == threat_map.contributions.end());
+    EXPECT_TRUE(&threat_map.dirty_units.Front() == &*units[3]);
+
+    Verify();
+};